@@ -0,0 +1,202 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#ifndef MAXOS_DRIVERS_AHCI_H
+#define MAXOS_DRIVERS_AHCI_H
+
+#include <common/types.h>
+#include <hardwarecommunication/interrupts.h>
+#include <hardwarecommunication/pci.h>
+#include <drivers/driver.h>
+#include <drivers/blockdevice.h>
+#include <drivers/ata.h>
+
+namespace maxOS{
+
+    namespace drivers{
+
+        //Port registers, as offsets from the start of the port's 0x80 bytes
+        enum AHCIPortRegister{
+            AHCI_PORT_COMMAND_LIST = 0x00,
+            AHCI_PORT_COMMAND_LIST_UPPER = 0x04,
+            AHCI_PORT_FIS = 0x08,
+            AHCI_PORT_FIS_UPPER = 0x0C,
+            AHCI_PORT_INTERRUPT_STATUS = 0x10,
+            AHCI_PORT_INTERRUPT_ENABLE = 0x14,
+            AHCI_PORT_COMMAND = 0x18,
+            AHCI_PORT_TASK_FILE = 0x20,
+            AHCI_PORT_SIGNATURE = 0x24,
+            AHCI_PORT_SATA_STATUS = 0x28,
+            AHCI_PORT_SATA_CONTROL = 0x2C,
+            AHCI_PORT_SATA_ERROR = 0x30,
+            AHCI_PORT_SATA_ACTIVE = 0x34,
+            AHCI_PORT_COMMAND_ISSUE = 0x38
+        };
+
+        enum AHCIPortCommand{
+            AHCI_PORT_START = 0x0001,
+            AHCI_PORT_FIS_RECEIVE = 0x0010,
+            AHCI_PORT_FIS_RUNNING = 0x4000,
+            AHCI_PORT_LIST_RUNNING = 0x8000
+        };
+
+        enum AHCIPortInterrupt{
+            AHCI_INTERRUPT_REGISTER_FIS = 1 << 0,             //A non queued command completed
+            AHCI_INTERRUPT_PIO_SETUP = 1 << 1,
+            AHCI_INTERRUPT_DEVICE_BITS = 1 << 3,              //Queued commands completed
+            AHCI_INTERRUPT_INTERFACE_NON_FATAL = 1 << 26,
+            AHCI_INTERRUPT_INTERFACE_FATAL = 1 << 27,
+            AHCI_INTERRUPT_BUS_DATA = 1 << 28,
+            AHCI_INTERRUPT_BUS_FATAL = 1 << 29,
+            AHCI_INTERRUPT_TASK_FILE_ERROR = 1 << 30,
+
+            AHCI_INTERRUPT_ERRORS = AHCI_INTERRUPT_INTERFACE_FATAL | AHCI_INTERRUPT_BUS_DATA | AHCI_INTERRUPT_BUS_FATAL | AHCI_INTERRUPT_TASK_FILE_ERROR
+        };
+
+        struct AHCICommandHeader{
+            common::uint16_t flags;                         //FIS length in dwords (bits 0-4), write (bit 6)
+            common::uint16_t numRegions;
+            volatile common::uint32_t bytesTransferred;
+            common::uint32_t table;                         //Physical address, 128 byte aligned
+            common::uint32_t tableUpper;
+            common::uint32_t reserved[4];
+        } __attribute__((packed));
+
+        struct AHCIPhysicalRegionDescriptor{
+            common::uint32_t address;
+            common::uint32_t addressUpper;
+            common::uint32_t reserved;
+            common::uint32_t byteCount;                     //Bytes - 1 (bits 0-21), interrupt when done (bit 31)
+        } __attribute__((packed));
+
+        //Host to device register FIS, what a command is sent as
+        struct AHCIRegisterFIS{
+            common::uint8_t type;                           //0x27
+            common::uint8_t flags;                          //Bit 7: this is a command
+            common::uint8_t command;
+            common::uint8_t featureLow;                     //Sector count (low) for queued commands
+            common::uint8_t lba0;
+            common::uint8_t lba1;
+            common::uint8_t lba2;
+            common::uint8_t device;
+            common::uint8_t lba3;
+            common::uint8_t lba4;
+            common::uint8_t lba5;
+            common::uint8_t featureHigh;
+            common::uint8_t countLow;                       //The tag (bits 3-7) for queued commands
+            common::uint8_t countHigh;
+            common::uint8_t icc;
+            common::uint8_t control;
+            common::uint32_t reserved;
+        } __attribute__((packed));
+
+        //One per command slot, a page each so big scattered requests still fit
+        static const int AHCI_MAX_REGIONS = 248;
+        struct AHCICommandTable{
+            common::uint8_t commandFIS[64];
+            common::uint8_t atapiCommand[16];
+            common::uint8_t reserved[48];
+            AHCIPhysicalRegionDescriptor regions[AHCI_MAX_REGIONS];
+        } __attribute__((packed));
+
+        struct AHCIIdentity{
+            char model[41];
+            common::uint64_t sectors;
+            bool lba48;
+            bool ncq;
+            common::uint8_t queueDepth;                     //Commands the device can queue, 1 without NCQ
+        };
+
+        class AdvancedHostControllerInterface;
+
+        /**
+         * @details A SATA disk on one port of an AHCI controller. Requests are put in command slots and, with native command queuing, up to 32 of
+         * them run on the device at once, it completes them in whatever order suits it
+         */
+        class AdvancedHostControllerInterfacePort : public BlockDevice{
+
+            protected:
+                static const int maxSlots = 32;
+
+                volatile common::uint32_t* registers;
+                int index;
+                common::uint32_t numSlots;
+
+                AHCICommandHeader* commandList;
+                common::uint8_t* receivedFIS;
+                AHCICommandTable* tables[maxSlots];
+
+                //A slot is busy from when a request gets it until it completes, a request bigger than a descriptor table goes in several commands
+                BlockRequest* slotRequests[maxSlots];
+                common::uint32_t slotDone[maxSlots];            //Sectors of the request done by earlier commands
+                common::uint32_t slotChunk[maxSlots];           //Sectors of the command in flight
+                common::uint32_t busySlots;
+                common::uint32_t issuedSlots;
+
+                bool present;
+                AHCIIdentity identity;
+
+                common::uint32_t Read(common::uint32_t reg);
+                void Write(common::uint32_t reg, common::uint32_t value);
+
+                void StartEngine();
+                bool StopEngine();
+
+                int BuildRegions(int slot, BlockRequest* request);
+                void BuildCommand(int slot, common::uint8_t command, common::uint64_t lba, common::uint32_t count, bool write, int numRegions);
+                void Issue(int slot, bool queued);
+                bool IssueNext(int slot);
+                void Advance(int slot);
+                void Finish(int slot, bool failed);
+                void Recover();
+
+                void StartRequest(BlockRequest* request);
+                void Poll();
+
+            public:
+                AdvancedHostControllerInterfacePort(volatile common::uint32_t* registers, int index, common::uint32_t numSlots);
+                ~AdvancedHostControllerInterfacePort();
+
+                bool Initialize();
+                bool Identify();
+                bool IsPresent();
+                AHCIIdentity* Identity();
+
+                void Service();
+        };
+
+        /**
+         * @details An AHCI SATA controller (PCI class 01:06:01), its registers are in memory BAR 5. Every port with a disk on it becomes a block device
+         */
+        class AdvancedHostControllerInterface : public Driver, public hardwarecommunication::InterruptHandler{
+
+            protected:
+                static const int maxPorts = 32;
+
+                hardwarecommunication::PeripheralComponentInterconnectDeviceDescriptor* device;
+                volatile common::uint32_t* registers;
+
+                AdvancedHostControllerInterfacePort* ports[maxPorts];
+                int numPorts;
+
+                void TakeOwnership();
+
+            public:
+                static AdvancedHostControllerInterface* activeController;
+
+                AdvancedHostControllerInterface(hardwarecommunication::PeripheralComponentInterconnectDeviceDescriptor* device, hardwarecommunication::InterruptManager* interruptManager);
+                ~AdvancedHostControllerInterface();
+
+                void Activate();
+                int NumPorts();
+                AdvancedHostControllerInterfacePort* GetPort(int index);
+
+                common::uint32_t HandleInterrupt(common::uint32_t esp);
+        };
+
+    }
+
+}
+
+#endif //MAXOS_DRIVERS_AHCI_H
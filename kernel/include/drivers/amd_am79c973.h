@@ -10,6 +10,7 @@
 #include <hardwarecommunication/pci.h>
 #include <hardwarecommunication/interrupts.h>
 #include <hardwarecommunication/port.h>
+#include <system/iouring.h>
 
 
 namespace maxOS{
@@ -31,7 +32,7 @@ namespace maxOS{
 
         };
 
-        class amd_am79c973 : public Driver, public hardwarecommunication::InterruptHandler{
+        class amd_am79c973 : public Driver, public hardwarecommunication::InterruptHandler, public system::IORingFile{
 
             struct InitializationBlock{
 
@@ -88,6 +89,8 @@ namespace maxOS{
             RawDataHandler* handler;
 
             public:
+                static amd_am79c973* activeNetworkCard;     //The card the network stack uses, the last one found
+
                 amd_am79c973(hardwarecommunication::PeripheralComponentInterconnectDeviceDescriptor* deviceDescriptor, hardwarecommunication::InterruptManager* interruptManager);
                 ~amd_am79c973();
 
@@ -101,6 +104,9 @@ namespace maxOS{
                 void Send(common::uint8_t* buffer, int size);
                 void Receive();
 
+                //IO Ring
+                common::int32_t Send(common::uint8_t* buffer, common::uint32_t length);
+
                 void SetHandler(RawDataHandler* handler);
                 common::uint64_t GetMACAddress();
                 common::uint32_t GetIPAddress();
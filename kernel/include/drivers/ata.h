@@ -7,14 +7,147 @@
 
 #include <common/types.h>
 #include <hardwarecommunication/port.h>
+#include <hardwarecommunication/interrupts.h>
+#include <system/iouring.h>
+#include <system/paging.h>
+#include <drivers/driver.h>
+#include <drivers/blockdevice.h>
 
 namespace maxOS{
 
     namespace drivers{
 
-        class AdvancedTechnologyAttachment{
+        enum ATACommand{
+            ATA_READ_SECTORS = 0x20,
+            ATA_READ_SECTORS_EXT = 0x24,
+            ATA_READ_DMA_EXT = 0x25,
+            ATA_READ_MULTIPLE_EXT = 0x29,
+            ATA_WRITE_SECTORS = 0x30,
+            ATA_WRITE_SECTORS_EXT = 0x34,
+            ATA_WRITE_DMA_EXT = 0x35,
+            ATA_WRITE_MULTIPLE_EXT = 0x39,
+            ATA_READ_FPDMA_QUEUED = 0x60,                   //Native command queuing (SATA)
+            ATA_WRITE_FPDMA_QUEUED = 0x61,
+            ATA_READ_MULTIPLE = 0xC4,
+            ATA_WRITE_MULTIPLE = 0xC5,
+            ATA_SET_MULTIPLE_MODE = 0xC6,
+            ATA_READ_DMA = 0xC8,
+            ATA_WRITE_DMA = 0xCA,
+            ATA_FLUSH_CACHE = 0xE7,
+            ATA_FLUSH_CACHE_EXT = 0xEA,
+            ATA_IDENTIFY = 0xEC
+        };
+
+        enum ATAStatus{
+            ATA_STATUS_ERROR = 0x01,
+            ATA_STATUS_DATA_REQUEST = 0x08,
+            ATA_STATUS_DEVICE_FAULT = 0x20,
+            ATA_STATUS_BUSY = 0x80
+        };
+
+        //What the IDENTIFY command says about the device
+        struct ATAIdentity{
+            char model[41];
+            char serial[21];
+            common::uint64_t sectors;
+            bool lba48;                                         //The EXT commands can be used (48 bit LBA, up to 65536 sectors per command)
+            bool dma;
+            common::uint8_t maxSectorsPerBlock;                 //Most sectors READ / WRITE MULTIPLE can move per data request, 0 if they aren't supported
+        };
+
+        //One entry of the bus master's scatter / gather list, a region can't cross a 64KB boundary
+        struct PhysicalRegionDescriptor{
+            common::uint32_t address;
+            common::uint16_t byteCount;                         //0 means 64KB
+            common::uint16_t flags;                             //Bit 15: last entry
+        } __attribute__((packed));
+
+        class AdvancedTechnologyAttachment;
+
+        enum ATARequestOperation{
+            ATA_REQUEST_READ,
+            ATA_REQUEST_WRITE,
+            ATA_REQUEST_IDENTIFY,                               //Reads the 512 byte IDENTIFY answer into the buffer
+            ATA_REQUEST_COMMAND                                 //A command without data (flush, set multiple mode...)
+        };
+
+        //A queued transfer, it has to stay valid until it is complete
+        struct ATARequest{
+            ATARequestOperation operation;
+            common::uint8_t command;                            //ATA_REQUEST_COMMAND only
+            common::uint64_t lba;
+            common::uint32_t count;                             //Sectors, or the sector count register for ATA_REQUEST_COMMAND
+            common::uint8_t* buffer;
+            BlockIO* segments;                                  //When set the sectors go to these transfers in turn instead of buffer
+
+            void (*callback)(ATARequest* request);              //Called from the IRQ handler once it is complete, 0 if the submitter waits instead
+            void* context;
+
+            volatile bool complete;
+            int result;                                         //Sectors moved (0 for commands), -1 if nothing was
+
+            //Filled in by the driver
+            AdvancedTechnologyAttachment* device;
+            system::PageDirectory* addressSpace;                //Where the buffer is, PIO only moves data while it is loaded
+            common::uint32_t done;
+            common::uint32_t chunk;                             //Sectors of the command in flight
+            common::uint32_t chunkDone;
+            bool dma;
+            ATARequest* next;
+        };
+
+        /**
+         * @details The two devices sharing a set of ports and an IRQ, and the bus master DMA engine of the IDE controller that serves them.
+         * Requests to either device are queued here and issued one at a time, the IRQ handler moves them along
+         */
+        class AdvancedTechnologyAttachmentChannel : public hardwarecommunication::InterruptHandler{
+
+            protected:
+                common::uint16_t portBase;
+                common::uint8_t irq;
+                hardwarecommunication::Port8Bit statusPort;
+
+                common::uint16_t busMasterBase;                 //0 if there is no DMA
+                PhysicalRegionDescriptor* regions;
+
+                common::uint8_t busMasterStatus;
+                common::uint8_t deviceStatus;
+
+                ATARequest* active;
+                ATARequest* queueHead;
+                ATARequest* queueTail;
+
+                void StartNext();
+                void Service();
+
+            public:
+                static const int maxRegions = 512;              //One page of descriptors
+                static const common::uint32_t maxDMASectors = 2048;    //Fits the descriptor table even if every page is separate
+
+                AdvancedTechnologyAttachmentChannel(common::uint16_t portBase, common::uint8_t irq, hardwarecommunication::InterruptManager* interruptManager);
+                ~AdvancedTechnologyAttachmentChannel();
+
+                common::uint16_t PortBase();
+                bool EnableDMA();
+                bool HasDMA();
+
+                int BuildRegions(common::uint8_t* buffer, common::uint32_t length, bool toMemory, system::PageDirectory* addressSpace, int first = 0);
+                void StartDMA(bool toMemory);
+                bool CheckCompletion();
+                bool StopDMA();
+
+                void Submit(ATARequest* request);
+                void Wait(ATARequest* request);
+                void Poll();
+
+                common::uint32_t HandleInterrupt(common::uint32_t esp);
+        };
+
+        class AdvancedTechnologyAttachment : public Driver, public system::IORingFile, public BlockDevice{
+            friend class AdvancedTechnologyAttachmentChannel;
 
             protected:
+                AdvancedTechnologyAttachmentChannel* channel;
                 hardwarecommunication::Port16Bit dataPort;
                 hardwarecommunication::Port8Bit errorPort;
                 hardwarecommunication::Port8Bit sectorCountPort;
@@ -26,14 +159,53 @@ namespace maxOS{
                 hardwarecommunication::Port8Bit controlPort;
                 bool master;
                 common::uint16_t bytesPerSector;
+
+                bool present;
+                ATAIdentity identity;
+                common::uint8_t sectorsPerBlock;                //Set with SET MULTIPLE MODE, 1 if only single sector commands are used
+
+                //The block layer keeps the next request queued on the channel while one runs
+                static const int blockQueueDepth = 2;
+                ATARequest blockRequests[blockQueueDepth];
+
+                void Delay();
+                bool WaitData();
+                void SelectSector(common::uint64_t lba, common::uint32_t count);
+                common::uint32_t MaxSectorsPerCommand();
+                common::uint8_t* SectorAddress(ATARequest* request, common::uint32_t sector, common::uint32_t* contiguous);
+                void TransferPIO(ATARequest* request, common::uint32_t sector, common::uint32_t count, bool write);
+
+                //Called by the channel with interrupts off, they return true once the request is complete
+                bool Start(ATARequest* request);
+                bool Service(ATARequest* request);
+                bool IssueNext(ATARequest* request);
+                bool Fail(ATARequest* request);
+                bool CanAccess(ATARequest* request);
+                int Execute(ATARequest* request);
+
+                //Block device
+                void StartRequest(BlockRequest* request);
+                void Poll();
+                static void BlockRequestDone(ATARequest* request);
+
             public:
-                AdvancedTechnologyAttachment(common::uint16_t portBase, bool master);
+                AdvancedTechnologyAttachment(AdvancedTechnologyAttachmentChannel* channel, bool master);
                 ~AdvancedTechnologyAttachment();
 
-                void Identify();
-                void Read28(common::uint32_t sector, int count);
-                void Write28(common::uint32_t sector, common::uint8_t* data, int count);
-                void Flush();                                                                               //Flush Cache  //TODO: See also vid 19 24:20
+                void Activate();
+                bool Identify();
+                bool IsPresent();
+                ATAIdentity* Identity();
+
+                void Submit(ATARequest* request);
+                int Read(common::uint64_t lba, common::uint32_t count, common::uint8_t* buffer);
+                int Write(common::uint64_t lba, common::uint32_t count, common::uint8_t* buffer);
+                void Flush();                                                                               //Flush Cache
+
+                //IO Ring
+                common::int32_t Read(common::uint8_t* buffer, common::uint32_t length, common::uint32_t offset);
+                common::int32_t Write(common::uint8_t* buffer, common::uint32_t length, common::uint32_t offset);
+                common::int32_t Sync();
 
 
 
@@ -0,0 +1,267 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#ifndef MAXOS_DRIVERS_BLOCKDEVICE_H
+#define MAXOS_DRIVERS_BLOCKDEVICE_H
+
+#include <common/types.h>
+
+namespace maxOS{
+
+    namespace drivers{
+
+        class BlockDevice;
+
+        enum BlockOperation{
+            BLOCK_READ,
+            BLOCK_WRITE,
+            BLOCK_FLUSH                                         //Everything submitted before it is on the device once it completes
+        };
+
+        /**
+         * @details One transfer asked for by a user of a block device, adjacent ones are merged into a single BlockRequest before they reach the driver
+         */
+        struct BlockIO{
+            BlockOperation operation;
+            common::uint64_t sector;
+            common::uint32_t count;                             //Sectors
+            common::uint8_t* buffer;                            //count * sector size bytes of kernel memory (completion can happen in any address space)
+
+            void (*callback)(BlockIO* io);                      //Called once it is complete (usually from an IRQ handler), 0 if the submitter waits instead
+            void* context;
+
+            volatile bool complete;
+            int result;                                         //Sectors moved, -1 if none were
+
+            //Filled in by the block layer
+            common::uint64_t submitted;                         //TSC value
+            BlockIO* next;                                      //Next transfer of the same request, in sector order
+        };
+
+        /**
+         * @details A range of sectors the driver moves with one command, made of the BlockIOs that were merged into it
+         */
+        struct BlockRequest{
+            BlockOperation operation;
+            common::uint64_t sector;
+            common::uint32_t count;
+
+            BlockIO* head;
+            BlockIO* tail;
+
+            common::uint64_t submitted;                         //TSC value when its oldest transfer was submitted
+            common::uint64_t deadline;                          //TSC value, only used by the deadline scheduler
+            common::uint64_t dispatched;
+
+            //Links of the scheduler's lists
+            BlockRequest* next;
+            BlockRequest* previous;
+            BlockRequest* fifoNext;
+            BlockRequest* fifoPrevious;
+        };
+
+        //What the driver can take, requests are only merged up to these
+        struct BlockQueueLimits{
+            common::uint32_t sectorSize;
+            common::uint32_t maxSectors;                        //Per request
+            common::uint32_t maxDepth;                          //Requests handed to the driver at once
+        };
+
+        struct BlockDeviceStatistics{
+            common::uint32_t reads;                             //Requests sent to the device
+            common::uint32_t writes;
+            common::uint32_t flushes;
+            common::uint64_t sectorsRead;
+            common::uint64_t sectorsWritten;
+            common::uint32_t submitted;                         //Transfers asked for, the difference to the requests is what merging saved
+            common::uint32_t merges;
+            common::uint32_t errors;
+            common::uint32_t queued;                            //Requests waiting in the scheduler right now
+            common::uint32_t inFlight;                          //Requests the driver is working on right now
+            common::uint64_t queueTicks;                        //Total TSC ticks requests waited before being dispatched
+            common::uint64_t serviceTicks;                      //Total TSC ticks the driver took for them
+        };
+
+        /**
+         * @details Decides which queued request the driver gets next and finds the ones a new transfer can be merged into. Every block device has its own
+         */
+        class IOScheduler{
+
+            protected:
+                static void InsertSorted(BlockRequest** head, BlockRequest* request);
+                static void Unlink(BlockRequest** head, BlockRequest* request);
+                static BlockRequest* FindAdjacent(BlockRequest* head, BlockOperation operation, common::uint64_t sector, common::uint32_t count, bool* front);
+
+            public:
+                IOScheduler();
+                ~IOScheduler();
+
+                virtual const char* Name();
+
+                virtual void Add(BlockRequest* request);
+                virtual void Remove(BlockRequest* request);
+                virtual BlockRequest* Next();
+
+                virtual BlockRequest* FindMerge(BlockOperation operation, common::uint64_t sector, common::uint32_t count, bool* front);
+                virtual void Merged(BlockRequest* request);
+        };
+
+        /**
+         * @details Hands requests out in the order they came in, only merging. For devices without a seek penalty
+         */
+        class NoopIOScheduler : public IOScheduler{
+
+            protected:
+                BlockRequest* head;
+                BlockRequest* tail;
+
+            public:
+                NoopIOScheduler();
+                ~NoopIOScheduler();
+
+                const char* Name();
+
+                void Add(BlockRequest* request);
+                void Remove(BlockRequest* request);
+                BlockRequest* Next();
+
+                BlockRequest* FindMerge(BlockOperation operation, common::uint64_t sector, common::uint32_t count, bool* front);
+        };
+
+        /**
+         * @details Sweeps the disk in one direction: the next request is the lowest one at or after the end of the last, then it wraps around to the lowest
+         */
+        class CLOOKIOScheduler : public IOScheduler{
+
+            protected:
+                BlockRequest* sorted;
+                common::uint64_t position;                      //Sector after the last dispatched request
+
+            public:
+                CLOOKIOScheduler();
+                ~CLOOKIOScheduler();
+
+                const char* Name();
+
+                void Add(BlockRequest* request);
+                void Remove(BlockRequest* request);
+                BlockRequest* Next();
+
+                BlockRequest* FindMerge(BlockOperation operation, common::uint64_t sector, common::uint32_t count, bool* front);
+                void Merged(BlockRequest* request);
+        };
+
+        /**
+         * @details Sorted batches like C-LOOK, but reads and writes are kept apart, reads are preferred and no request waits past its expiry time
+         */
+        class DeadlineIOScheduler : public IOScheduler{
+
+            protected:
+                static const common::uint32_t readExpire = 500000;     //Microseconds
+                static const common::uint32_t writeExpire = 5000000;
+                static const common::uint32_t fifoBatch = 16;          //Requests dispatched in sector order before the deadlines are checked
+                static const common::uint32_t writesStarved = 2;       //Read batches that can go before a write batch has to
+
+                //[0] is reads, [1] writes
+                BlockRequest* sorted[2];
+                BlockRequest* fifoHead[2];
+                BlockRequest* fifoTail[2];
+                BlockRequest* nextRequest[2];                   //Where the batch continues
+
+                int direction;
+                common::uint32_t batched;
+                common::uint32_t starved;
+
+                static int Direction(BlockOperation operation);
+                bool Expired(int direction);
+                void InsertFIFO(int direction, BlockRequest* request);
+                void UnlinkFIFO(int direction, BlockRequest* request);
+
+            public:
+                DeadlineIOScheduler();
+                ~DeadlineIOScheduler();
+
+                const char* Name();
+
+                void Add(BlockRequest* request);
+                void Remove(BlockRequest* request);
+                BlockRequest* Next();
+
+                BlockRequest* FindMerge(BlockOperation operation, common::uint64_t sector, common::uint32_t count, bool* front);
+                void Merged(BlockRequest* request);
+        };
+
+        /**
+         * @details What a storage driver implements: it is handed whole requests (StartRequest) and reports them back (Complete), queueing, merging and
+         * ordering happen here. Everything runs with interrupts off as completions come from IRQ handlers
+         */
+        class BlockDevice{
+
+            protected:
+                static const int maxRequests = 64;
+
+                BlockQueueLimits limits;
+                common::uint64_t capacity;                      //Sectors, set by the driver
+
+                IOScheduler* scheduler;
+                NoopIOScheduler defaultScheduler;
+
+                BlockRequest requests[maxRequests];
+                BlockRequest* freeRequests;
+
+                //Transfers that can't be queued yet, because a flush is waiting for the queue to drain or there are no free requests
+                BlockIO* heldHead;
+                BlockIO* heldTail;
+
+                BlockRequest* barrier;                          //Pending flush, dispatched once nothing else is in flight
+                bool barrierIssued;
+
+                int plugged;
+                bool running;
+
+                BlockDeviceStatistics statistics;
+
+                BlockRequest* AllocateRequest(BlockIO* io);
+                void FreeRequest(BlockRequest* request);
+
+                bool Queue(BlockIO* io);
+                bool Merge(BlockIO* io);
+                void Coalesce(BlockRequest* request);
+                void ReleaseHeld();
+                void Run();
+
+                void Complete(BlockRequest* request, int result);
+
+                //Driver side
+                virtual void StartRequest(BlockRequest* request);
+                virtual void CommitRequests();
+                virtual void Poll();
+
+            public:
+                BlockDevice();
+                ~BlockDevice();
+
+                void SubmitIO(BlockIO* io);
+                void Wait(BlockIO* io);
+
+                int ReadSectors(common::uint64_t sector, common::uint32_t count, common::uint8_t* buffer);
+                int WriteSectors(common::uint64_t sector, common::uint32_t count, common::uint8_t* buffer);
+                int FlushCache();
+
+                void Plug();
+                void Unplug();
+
+                void SetScheduler(IOScheduler* scheduler);
+                IOScheduler* Scheduler();
+
+                BlockQueueLimits* Limits();
+                common::uint64_t Capacity();
+                BlockDeviceStatistics* Statistics();
+        };
+
+    }
+
+}
+
+#endif //MAXOS_DRIVERS_BLOCKDEVICE_H
@@ -22,16 +22,45 @@ namespace maxOS
                 virtual int Reset();
         };
 
+        enum DriverState {
+            DRIVER_PENDING,
+            DRIVER_ACTIVATING,          //Claimed by a thread, the others have to wait for it
+            DRIVER_ACTIVE
+        };
+
         class DriverManager {
             public:                     //Public For testing
                 Driver *drivers[255];   //Fixed length for now as there is dynamic memory in the OS but I haven't setup drivers this way yet.
                 int numDrivers;
+
+            protected:
+                static const int maxDependencies = 4;
+
+                volatile int states[255];
+                bool required[255];     //Boot has to wait for these, the rest are activated by the worker threads
+                int dependencies[255][maxDependencies];
+                int numDependencies[255];
+
+                bool DependenciesActive(int driver);
+                bool Claim(int driver);
+                void Activate(int driver);
+
             public:
+                static DriverManager* activeDriverManager;
+
                 DriverManager();
+                ~DriverManager();
 
-                void AddDriver(Driver *);
+                int AddDriver(Driver *, bool required = true);
+                bool AddDependency(int driver, int dependency);
 
                 void ActivateAll();
+                void ActivateRequired();
+                int ActivatePending();
+                bool IsActive(int driver);
+                void WaitFor(int driver);
+
+                static void Worker();
         };
     }
 }
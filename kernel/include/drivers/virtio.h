@@ -0,0 +1,190 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#ifndef MAXOS_DRIVERS_VIRTIO_H
+#define MAXOS_DRIVERS_VIRTIO_H
+
+#include <common/types.h>
+#include <hardwarecommunication/pci.h>
+
+namespace maxOS{
+
+    namespace drivers{
+
+        enum VirtualIODeviceStatus{
+            VIRTIO_STATUS_ACKNOWLEDGE = 0x01,               //The OS noticed the device
+            VIRTIO_STATUS_DRIVER = 0x02,                    //and knows how to drive it
+            VIRTIO_STATUS_DRIVER_OK = 0x04,
+            VIRTIO_STATUS_FEATURES_OK = 0x08,               //Modern devices only: the device accepted the features
+            VIRTIO_STATUS_FAILED = 0x80
+        };
+
+        //Feature bits every type of device can have, the bits below 24 depend on the type
+        enum VirtualIOFeature{
+            VIRTIO_F_INDIRECT_DESC = 28,                    //A descriptor can point to a table of descriptors
+            VIRTIO_F_EVENT_IDX = 29,                        //Notifications are suppressed with ring indices instead of flags
+            VIRTIO_F_VERSION_1 = 32                         //Modern (virtio 1.0) interface
+        };
+
+        enum VirtualIODescriptorFlags{
+            VIRTIO_DESCRIPTOR_NEXT = 0x1,
+            VIRTIO_DESCRIPTOR_WRITE = 0x2,                  //The device writes the buffer
+            VIRTIO_DESCRIPTOR_INDIRECT = 0x4
+        };
+
+        //The vendor specific PCI capabilities of a modern device, each says where one structure is
+        enum VirtualIOCapabilityType{
+            VIRTIO_CAPABILITY_COMMON = 1,
+            VIRTIO_CAPABILITY_NOTIFY = 2,
+            VIRTIO_CAPABILITY_ISR = 3,
+            VIRTIO_CAPABILITY_DEVICE = 4
+        };
+
+        static const common::uint16_t VIRTIO_NO_VECTOR = 0xFFFF;
+
+        struct VirtualIODescriptor{
+            common::uint64_t address;                       //Physical
+            common::uint32_t length;
+            common::uint16_t flags;
+            common::uint16_t next;
+        } __attribute__((packed));
+
+        struct VirtualIOUsedElement{
+            common::uint32_t id;                            //Head descriptor of the chain
+            common::uint32_t length;                        //Bytes the device wrote
+        } __attribute__((packed));
+
+        //One piece of a buffer chain, the ones the device reads have to come before the ones it writes
+        struct VirtualIOBuffer{
+            common::uint32_t address;                       //Physical
+            common::uint32_t length;
+            bool deviceWrites;
+        };
+
+        class VirtualIODevice;
+
+        /**
+         * @details A split virtqueue: the driver puts descriptor chains in the available ring and the device returns them in the used ring. Chains are
+         * only published and the device only notified when Kick is called, so a batch costs a single doorbell write
+         */
+        class VirtualIOQueue{
+
+            friend class VirtualIODevice;
+
+            public:
+                static const int maxIndirect = 32;          //Buffers per chain when indirect descriptors are used
+
+            protected:
+                VirtualIODevice* device;
+                common::uint16_t index;
+                common::uint16_t size;
+                common::uint16_t notifyOffset;              //Modern devices: where in the notify area its doorbell is
+
+                //Descriptors, the available ring and (page aligned) the used ring, in one block as legacy devices want
+                common::uint8_t* memory;
+                VirtualIODescriptor* descriptors;
+                volatile common::uint16_t* available;       //Flags, index, ring[size], used event
+                volatile common::uint16_t* used;            //Flags, index, elements[size], available event
+                volatile VirtualIOUsedElement* usedRing;
+
+                VirtualIODescriptor* indirectTables;        //maxIndirect descriptors for every head descriptor
+                void** tokens;                              //What the submitter gave each chain, by head descriptor
+
+                common::uint16_t freeHead;                  //Free descriptors are linked with next
+                common::uint16_t numFree;
+                common::uint16_t nextAvailable;             //Available index once the added chains are published
+                common::uint16_t lastKicked;                //Available index at the last Kick
+                common::uint16_t lastUsed;                  //Used elements taken so far
+
+                bool eventIndex;
+                bool indirect;
+
+                void FreeChain(common::uint16_t head);
+
+            public:
+                VirtualIOQueue(VirtualIODevice* device, common::uint16_t index, common::uint16_t size, bool eventIndex, bool indirect);
+                ~VirtualIOQueue();
+
+                static common::uint32_t UsedOffset(common::uint16_t size);
+
+                bool IsValid();
+                common::uint16_t Index();
+                common::uint16_t Size();
+                common::uint16_t NumFree();
+                bool HasIndirect();
+
+                int Add(VirtualIOBuffer* buffers, int count, void* token);
+                bool Kick();
+                void* NextUsed(common::uint32_t* length);
+
+                void DisableCallbacks();
+                bool EnableCallbacks();
+
+                common::uint32_t DescriptorAddress();
+                common::uint32_t AvailableAddress();
+                common::uint32_t UsedAddress();
+        };
+
+        /**
+         * @details The virtio PCI transport, what every virtio driver talks to the device through. Modern devices are found through their vendor
+         * capabilities and used through memory BARs, legacy (and transitional) devices through the I/O registers in BAR 0
+         */
+        class VirtualIODevice{
+
+            protected:
+                hardwarecommunication::PeripheralComponentInterconnectDeviceDescriptor* device;
+
+                bool modern;
+                bool msix;
+
+                //Legacy
+                common::uint16_t ioBase;
+                common::uint16_t configOffset;              //The device config is after the MSI-X registers when MSI-X is on
+
+                //Modern
+                volatile common::uint8_t* commonConfig;
+                volatile common::uint8_t* notify;
+                common::uint32_t notifyMultiplier;
+                volatile common::uint8_t* isr;
+                volatile common::uint8_t* config;
+
+                common::uint64_t features;
+
+                bool FindCapabilities();
+                void SelectQueue(common::uint16_t index);
+
+            public:
+                VirtualIODevice(hardwarecommunication::PeripheralComponentInterconnectDeviceDescriptor* device);
+                ~VirtualIODevice();
+
+                bool Initialize(bool msix);
+                bool IsModern();
+
+                common::uint64_t DeviceFeatures();
+                bool SetFeatures(common::uint64_t features);
+                bool HasFeature(int bit);
+
+                common::uint8_t Status();
+                void SetStatus(common::uint8_t status);
+                void Reset();
+                void Ready();
+                void Fail();
+
+                common::uint8_t ReadConfig8(common::uint32_t offset);
+                common::uint16_t ReadConfig16(common::uint32_t offset);
+                common::uint32_t ReadConfig32(common::uint32_t offset);
+                common::uint64_t ReadConfig64(common::uint32_t offset);
+                common::uint8_t ReadISR();
+
+                common::uint16_t NumQueues();
+                VirtualIOQueue* CreateQueue(common::uint16_t index, common::uint16_t maxSize, common::uint16_t vector);
+                bool SetConfigVector(common::uint16_t vector);
+                void Notify(VirtualIOQueue* queue);
+        };
+
+    }
+
+}
+
+#endif //MAXOS_DRIVERS_VIRTIO_H
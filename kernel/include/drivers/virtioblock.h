@@ -0,0 +1,132 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#ifndef MAXOS_DRIVERS_VIRTIOBLOCK_H
+#define MAXOS_DRIVERS_VIRTIOBLOCK_H
+
+#include <common/types.h>
+#include <hardwarecommunication/interrupts.h>
+#include <hardwarecommunication/pci.h>
+#include <drivers/driver.h>
+#include <drivers/blockdevice.h>
+#include <drivers/virtio.h>
+
+namespace maxOS{
+
+    namespace drivers{
+
+        enum VirtualIOBlockFeature{
+            VIRTIO_BLK_F_SIZE_MAX = 1,                      //Longest buffer the device takes is in the config
+            VIRTIO_BLK_F_SEG_MAX = 2,                       //Most data buffers per request is in the config
+            VIRTIO_BLK_F_RO = 5,
+            VIRTIO_BLK_F_FLUSH = 9,                         //The device has a write cache that can be flushed
+            VIRTIO_BLK_F_MQ = 12                            //More than one request queue
+        };
+
+        //Where the values are in the device configuration
+        enum VirtualIOBlockConfig{
+            VIRTIO_BLK_CONFIG_CAPACITY = 0,                 //In 512 byte sectors
+            VIRTIO_BLK_CONFIG_SIZE_MAX = 8,
+            VIRTIO_BLK_CONFIG_SEG_MAX = 12,
+            VIRTIO_BLK_CONFIG_NUM_QUEUES = 34
+        };
+
+        enum VirtualIOBlockRequestType{
+            VIRTIO_BLK_T_IN = 0,
+            VIRTIO_BLK_T_OUT = 1,
+            VIRTIO_BLK_T_FLUSH = 4
+        };
+
+        //What the device reads first for every request
+        struct VirtualIOBlockHeader{
+            common::uint32_t type;
+            common::uint32_t reserved;
+            common::uint64_t sector;
+        } __attribute__((packed));
+
+        /**
+         * @details A request of the block layer that the device is working on, a request that is too scattered for one chain goes in several
+         */
+        struct VirtualIOBlockRequest{
+            BlockRequest* request;                          //0 if the slot is free
+            VirtualIOBlockHeader header;
+            volatile common::uint8_t status;                //Written by the device, 0 is OK
+            common::uint32_t done;                          //Sectors moved by earlier chains
+            common::uint32_t chunk;                         //Sectors of the chain in flight
+        };
+
+        class VirtualIOBlockDevice;
+
+        /**
+         * @details Gets a queue's interrupts to the driver, every queue has its own MSI-X vector. Without MSI-X there is one on the INTx line for all of them.
+         * The driver deletes these itself and InterruptHandler's destructor isn't virtual, so nothing may derive from it
+         */
+        class VirtualIOBlockInterruptHandler final : public hardwarecommunication::InterruptHandler{
+
+            protected:
+                VirtualIOBlockDevice* device;
+                int queue;                                  //-1 for the INTx line
+
+            public:
+                VirtualIOBlockInterruptHandler(common::uint8_t interrupt, hardwarecommunication::InterruptManager* interruptManager, VirtualIOBlockDevice* device, int queue);
+                ~VirtualIOBlockInterruptHandler();
+
+                common::uint32_t HandleInterrupt(common::uint32_t esp);
+        };
+
+        /**
+         * @details A virtio disk. When the device has several request queues each CPU submits to its own, so they don't contend for one ring, and
+         * the requests of a dispatch batch are announced to the device with one doorbell write per queue
+         */
+        class VirtualIOBlockDevice : public Driver, public BlockDevice{
+
+            protected:
+                static const int maxQueues = 8;
+                static const common::uint16_t maxQueueSize = 256;
+
+                hardwarecommunication::PeripheralComponentInterconnectDeviceDescriptor* device;
+                hardwarecommunication::InterruptManager* interruptManager;
+                VirtualIODevice transport;
+
+                VirtualIOQueue* queues[maxQueues];
+                VirtualIOBlockInterruptHandler* handlers[maxQueues];
+                int numQueues;
+                common::uint32_t pendingKicks;              //Queues with chains the device hasn't been told about
+
+                VirtualIOBlockRequest slots[maxRequests];
+                common::uint32_t maxSegments;               //Data buffers per chain
+                common::uint32_t maxSegmentSize;
+
+                bool present;
+                bool readOnly;
+                bool hasFlush;
+
+                int CurrentQueue();
+                int BuildSegments(VirtualIOBlockRequest* slot, VirtualIOBuffer* buffers);
+                bool IssueNext(VirtualIOBlockRequest* slot);
+                void Advance(VirtualIOBlockRequest* slot);
+                void Finish(VirtualIOBlockRequest* slot, bool failed);
+
+                void StartRequest(BlockRequest* request);
+                void CommitRequests();
+                void Poll();
+
+            public:
+                VirtualIOBlockDevice(hardwarecommunication::PeripheralComponentInterconnectDeviceDescriptor* device, hardwarecommunication::InterruptManager* interruptManager);
+                ~VirtualIOBlockDevice();
+
+                void Activate();
+
+                void Service(int queue);
+                void ServiceShared();
+
+                bool IsPresent();
+                int NumQueues();
+        };
+
+    }
+
+}
+
+#endif //MAXOS_DRIVERS_VIRTIOBLOCK_H
@@ -0,0 +1,286 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#ifndef MAXOS_HARDWARECOMMUNICATION_ACPI_H
+#define MAXOS_HARDWARECOMMUNICATION_ACPI_H
+
+#include <common/types.h>
+
+namespace maxOS{
+
+    namespace hardwarecommunication{
+
+        struct RootSystemDescriptionPointer{
+            char signature[8];                              //"RSD PTR "
+            common::uint8_t checksum;
+            char oemID[6];
+            common::uint8_t revision;                       //0 = ACPI 1.0, 2 = ACPI 2.0+ (has the XSDT)
+            common::uint32_t rootTableAddress;
+
+            //ACPI 2.0+ only
+            common::uint32_t length;
+            common::uint64_t extendedTableAddress;
+            common::uint8_t extendedChecksum;
+            common::uint8_t reserved[3];
+        } __attribute__((packed));
+
+        struct SystemDescriptionTableHeader{
+            char signature[4];
+            common::uint32_t length;                        //Including the header
+            common::uint8_t revision;
+            common::uint8_t checksum;
+            char oemID[6];
+            char oemTableID[8];
+            common::uint32_t oemRevision;
+            common::uint32_t creatorID;
+            common::uint32_t creatorRevision;
+        } __attribute__((packed));
+
+        struct GenericAddress{
+            common::uint8_t addressSpace;                   //0 = memory, 1 = IO port
+            common::uint8_t bitWidth;
+            common::uint8_t bitOffset;
+            common::uint8_t accessSize;
+            common::uint64_t address;
+        } __attribute__((packed));
+
+        enum GenericAddressSpace{
+            ADDRESS_SPACE_MEMORY = 0,
+            ADDRESS_SPACE_IO = 1
+        };
+
+        ///__MADT__
+
+        struct MADTHeader{
+            SystemDescriptionTableHeader header;
+            common::uint32_t localAPICAddress;
+            common::uint32_t flags;                         //Bit 0: there are also 8259 PICs
+        } __attribute__((packed));
+
+        enum MADTEntryType{
+            MADT_LOCAL_APIC = 0,
+            MADT_IO_APIC = 1,
+            MADT_INTERRUPT_OVERRIDE = 2,
+            MADT_LOCAL_APIC_ADDRESS_OVERRIDE = 5
+        };
+
+        struct MADTEntry{
+            common::uint8_t type;
+            common::uint8_t length;
+        } __attribute__((packed));
+
+        struct MADTLocalAPIC{
+            MADTEntry entry;
+            common::uint8_t processorID;
+            common::uint8_t apicID;
+            common::uint32_t flags;                         //Bit 0: enabled
+        } __attribute__((packed));
+
+        struct MADTIOAPIC{
+            MADTEntry entry;
+            common::uint8_t ioAPICID;
+            common::uint8_t reserved;
+            common::uint32_t address;
+            common::uint32_t globalSystemInterruptBase;
+        } __attribute__((packed));
+
+        struct MADTInterruptOverride{
+            MADTEntry entry;
+            common::uint8_t bus;                            //0 = ISA
+            common::uint8_t source;                         //The ISA IRQ
+            common::uint32_t globalSystemInterrupt;         //The IO APIC input it is wired to
+            common::uint16_t flags;                         //Polarity (bits 0-1) and trigger mode (bits 2-3)
+        } __attribute__((packed));
+
+        struct MADTLocalAPICAddressOverride{
+            MADTEntry entry;
+            common::uint16_t reserved;
+            common::uint64_t address;
+        } __attribute__((packed));
+
+        enum InterruptOverrideFlags{
+            INTERRUPT_POLARITY_MASK = 0x3,
+            INTERRUPT_ACTIVE_HIGH = 0x1,
+            INTERRUPT_ACTIVE_LOW = 0x3,
+            INTERRUPT_TRIGGER_MASK = 0xC,
+            INTERRUPT_EDGE_TRIGGERED = 0x4,
+            INTERRUPT_LEVEL_TRIGGERED = 0xC
+        };
+
+        //What the MADT describes, in a form that doesn't need walking the table again
+        struct ProcessorDescription{
+            common::uint8_t processorID;
+            common::uint8_t apicID;
+        };
+
+        struct IOAPICDescription{
+            common::uint8_t id;
+            common::uint32_t address;
+            common::uint32_t globalSystemInterruptBase;
+        };
+
+        struct InterruptOverrideDescription{
+            common::uint8_t source;
+            common::uint32_t globalSystemInterrupt;
+            common::uint16_t flags;
+        };
+
+        struct MultipleAPICDescription{
+            common::uint32_t localAPICAddress;
+            bool hasLegacyPIC;
+
+            ProcessorDescription processors[16];
+            int numProcessors;
+
+            IOAPICDescription ioAPICs[4];
+            int numIOAPICs;
+
+            InterruptOverrideDescription overrides[16];
+            int numOverrides;
+        };
+
+        ///__HPET__
+
+        struct HPETTable{
+            SystemDescriptionTableHeader header;
+            common::uint32_t eventTimerBlockID;             //Comparators - 1 (bits 8-12), 64 bit counter (bit 13), legacy replacement (bit 15), vendor (bits 16-31)
+            GenericAddress baseAddress;
+            common::uint8_t number;
+            common::uint16_t minimumTick;
+            common::uint8_t pageProtection;
+        } __attribute__((packed));
+
+        struct HighPrecisionEventTimerDescription{
+            common::uint32_t address;                       //Physical address of the registers
+            common::uint8_t numComparators;
+            bool counter64Bit;
+            bool legacyReplacement;                         //Can take over the PIT and RTC interrupts
+            common::uint16_t vendorID;
+            common::uint16_t minimumTick;                   //Smallest period that can be programmed in periodic mode, in counter ticks
+        };
+
+        ///__FADT__
+
+        struct FADTTable{
+            SystemDescriptionTableHeader header;
+            common::uint32_t firmwareControl;
+            common::uint32_t dsdt;
+            common::uint8_t reserved;
+            common::uint8_t preferredPowerProfile;
+            common::uint16_t sciInterrupt;
+            common::uint32_t smiCommandPort;
+            common::uint8_t acpiEnable;
+            common::uint8_t acpiDisable;
+            common::uint8_t s4BIOSRequest;
+            common::uint8_t performanceStateControl;
+            common::uint32_t pm1aEventBlock;
+            common::uint32_t pm1bEventBlock;
+            common::uint32_t pm1aControlBlock;
+            common::uint32_t pm1bControlBlock;
+            common::uint32_t pm2ControlBlock;
+            common::uint32_t pmTimerBlock;
+            common::uint32_t gpe0Block;
+            common::uint32_t gpe1Block;
+            common::uint8_t pm1EventLength;
+            common::uint8_t pm1ControlLength;
+            common::uint8_t pm2ControlLength;
+            common::uint8_t pmTimerLength;
+            common::uint8_t gpe0Length;
+            common::uint8_t gpe1Length;
+            common::uint8_t gpe1Base;
+            common::uint8_t cStateControl;
+            common::uint16_t worstC2Latency;
+            common::uint16_t worstC3Latency;
+            common::uint16_t flushSize;
+            common::uint16_t flushStride;
+            common::uint8_t dutyOffset;
+            common::uint8_t dutyWidth;
+            common::uint8_t dayAlarm;
+            common::uint8_t monthAlarm;
+            common::uint8_t century;                        //CMOS register holding the century, 0 if there isn't one
+
+            //ACPI 2.0+ only
+            common::uint16_t bootArchitectureFlags;
+            common::uint8_t reserved2;
+            common::uint32_t flags;
+            GenericAddress resetRegister;
+            common::uint8_t resetValue;
+        } __attribute__((packed));
+
+        enum BootArchitectureFlags{
+            BOOT_LEGACY_DEVICES = 0x1,
+            BOOT_8042 = 0x2,                                //There is a PS/2 controller
+            BOOT_NO_VGA = 0x4,
+            BOOT_NO_MSI = 0x8,                              //MSI must not be enabled
+            BOOT_NO_ASPM = 0x10,
+            BOOT_NO_CMOS_RTC = 0x20
+        };
+
+        struct FixedACPIDescription{
+            common::uint16_t sciInterrupt;
+            common::uint32_t smiCommandPort;
+            common::uint8_t acpiEnable;
+            common::uint8_t acpiDisable;
+            common::uint32_t pm1aControlBlock;
+            common::uint32_t pmTimerBlock;                  //IO port of the 3.579545MHz power management timer, 0 if there isn't one
+            bool pmTimer32Bit;
+            common::uint8_t century;
+            common::uint16_t bootArchitectureFlags;         //Only valid for ACPI 2.0+, 0 otherwise
+            bool hasResetRegister;
+            GenericAddress resetRegister;
+            common::uint8_t resetValue;
+        };
+
+        ///__MCFG__
+
+        struct MCFGTable{
+            SystemDescriptionTableHeader header;
+            common::uint64_t reserved;
+        } __attribute__((packed));
+
+        struct MCFGAllocation{
+            common::uint64_t baseAddress;                   //Config space of bus 0 (even if startBus isn't 0)
+            common::uint16_t segment;
+            common::uint8_t startBus;
+            common::uint8_t endBus;
+            common::uint32_t reserved;
+        } __attribute__((packed));
+
+        struct PCIExpressDescription{
+            common::uint32_t baseAddress;                   //Physical address of the config space of startBus
+            common::uint8_t startBus;
+            common::uint8_t endBus;
+        };
+
+        class AdvancedConfigurationAndPowerInterface{
+
+            protected:
+                RootSystemDescriptionPointer* rootPointer;
+                SystemDescriptionTableHeader* rootTable;
+                bool extended;                              //The root table is the XSDT (64 bit entries)
+
+                static RootSystemDescriptionPointer* FindRootPointer(common::uint32_t start, common::uint32_t length);
+                static bool ValidChecksum(common::uint8_t* data, common::uint32_t length);
+                static SystemDescriptionTableHeader* MapTable(common::uint32_t physicalAddress);
+
+            public:
+                static AdvancedConfigurationAndPowerInterface* activeACPI;
+
+                AdvancedConfigurationAndPowerInterface();
+                ~AdvancedConfigurationAndPowerInterface();
+
+                bool IsPresent();
+                SystemDescriptionTableHeader* FindTable(const char* signature);
+
+                bool ParseMADT(MultipleAPICDescription* description);
+                bool ParseHPET(HighPrecisionEventTimerDescription* description);
+                bool ParseFADT(FixedACPIDescription* description);
+                bool ParseMCFG(PCIExpressDescription* description);
+        };
+
+    }
+
+}
+
+#endif //MAXOS_HARDWARECOMMUNICATION_ACPI_H
@@ -0,0 +1,93 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#ifndef MAXOS_HARDWARECOMMUNICATION_APIC_H
+#define MAXOS_HARDWARECOMMUNICATION_APIC_H
+
+#include <common/types.h>
+#include <hardwarecommunication/acpi.h>
+#include <hardwarecommunication/interrupts.h>
+
+namespace maxOS{
+
+    namespace hardwarecommunication{
+
+        /**
+         * @details The interrupt controller built into each CPU
+         */
+        class LocalAPIC{
+
+            protected:
+                volatile common::uint32_t* registers;
+
+            public:
+                LocalAPIC(common::uint32_t address);
+                ~LocalAPIC();
+
+                common::uint32_t Read(common::uint32_t reg);
+                void Write(common::uint32_t reg, common::uint32_t value);
+
+                common::uint8_t ID();
+                void SetTaskPriority(common::uint8_t priority);
+
+                //Called on every hardware interrupt, so keep it to a single MMIO write
+                inline void EndOfInterrupt(){
+                    registers[0xB0 / 4] = 0;
+                }
+        };
+
+        /**
+         * @details Routes device interrupt lines (global system interrupts) to vectors on any CPU
+         */
+        class IOAPIC{
+
+            protected:
+                volatile common::uint32_t* registers;
+                common::uint32_t globalSystemInterruptBase;
+                common::uint32_t numRedirections;
+
+                common::uint32_t Read(common::uint8_t reg);
+                void Write(common::uint8_t reg, common::uint32_t value);
+
+            public:
+                IOAPIC(common::uint32_t address, common::uint32_t globalSystemInterruptBase);
+                ~IOAPIC();
+
+                bool Handles(common::uint32_t globalSystemInterrupt);
+                void SetRedirection(common::uint32_t globalSystemInterrupt, common::uint8_t vector, common::uint8_t destination, common::uint16_t flags);
+                void Mask(common::uint32_t globalSystemInterrupt);
+        };
+
+        class AdvancedProgrammableInterruptController{
+
+            protected:
+                MultipleAPICDescription description;
+
+                LocalAPIC* localAPIC;
+                IOAPIC* ioAPICs[4];
+                int numIOAPICs;
+
+                IOAPIC* FindIOAPIC(common::uint32_t globalSystemInterrupt);
+
+            public:
+                static AdvancedProgrammableInterruptController* activeAPIC;
+
+                AdvancedProgrammableInterruptController(InterruptManager* interruptManager, AdvancedConfigurationAndPowerInterface* acpi);
+                ~AdvancedProgrammableInterruptController();
+
+                bool IsAvailable();
+                LocalAPIC* Local();
+                MultipleAPICDescription* Description();
+                int CurrentCPU();
+
+                common::uint32_t GlobalSystemInterrupt(common::uint8_t irq, common::uint16_t* flags);
+                bool RouteIRQ(common::uint8_t irq, common::uint8_t vector, common::uint8_t destination);
+                void MaskIRQ(common::uint8_t irq);
+        };
+
+    }
+
+}
+
+#endif //MAXOS_HARDWARECOMMUNICATION_APIC_H
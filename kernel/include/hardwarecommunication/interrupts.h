@@ -15,6 +15,19 @@ namespace maxOS {
     namespace hardwarecommunication {
 
         class InterruptManager;
+        class LocalAPIC;
+        class serial;
+
+        /**
+         * @details What the dispatcher measured for one vector, times are TSC ticks spent in the handler
+         */
+        struct InterruptStatistics{
+            common::uint64_t count;
+            common::uint64_t totalTicks;
+            common::uint64_t maxTicks;
+            common::uint32_t unhandled;                     //Raised with no handler installed
+            common::uint32_t histogram[32];                 //Bucket n counts handlers that took 2^n to 2^(n+1) ticks
+        };
 
         class InterruptHandler {
         protected:
@@ -101,6 +114,40 @@ namespace maxOS {
 
             static void HandleInterruptRequest0x31();
 
+            //Message signalled interrupts (MSI / MSI-X)
+            static void HandleInterruptRequest0x10();
+            static void HandleInterruptRequest0x11();
+            static void HandleInterruptRequest0x12();
+            static void HandleInterruptRequest0x13();
+            static void HandleInterruptRequest0x14();
+            static void HandleInterruptRequest0x15();
+            static void HandleInterruptRequest0x16();
+            static void HandleInterruptRequest0x17();
+            static void HandleInterruptRequest0x18();
+            static void HandleInterruptRequest0x19();
+            static void HandleInterruptRequest0x1A();
+            static void HandleInterruptRequest0x1B();
+            static void HandleInterruptRequest0x1C();
+            static void HandleInterruptRequest0x1D();
+            static void HandleInterruptRequest0x1E();
+            static void HandleInterruptRequest0x1F();
+            static void HandleInterruptRequest0x20();
+            static void HandleInterruptRequest0x21();
+            static void HandleInterruptRequest0x22();
+            static void HandleInterruptRequest0x23();
+            static void HandleInterruptRequest0x24();
+            static void HandleInterruptRequest0x25();
+            static void HandleInterruptRequest0x26();
+            static void HandleInterruptRequest0x27();
+            static void HandleInterruptRequest0x28();
+            static void HandleInterruptRequest0x29();
+            static void HandleInterruptRequest0x2A();
+            static void HandleInterruptRequest0x2B();
+            static void HandleInterruptRequest0x2C();
+            static void HandleInterruptRequest0x2D();
+            static void HandleInterruptRequest0x2E();
+            static void HandleInterruptRequest0x2F();
+
             static void HandleException0x00();
 
             static void HandleException0x01();
@@ -144,6 +191,7 @@ namespace maxOS {
             static maxOS::common::uint32_t HandleInterrupt(maxOS::common::uint8_t interrupt, maxOS::common::uint32_t esp);
 
             maxOS::common::uint32_t DoHandleInterrupt(maxOS::common::uint8_t interrupt, maxOS::common::uint32_t esp);
+            maxOS::common::uint32_t HandleFault(maxOS::common::uint8_t interrupt, maxOS::common::uint32_t esp);
 
             //PIC Cominunication
             Port8BitSlow programmableInterruptControllerMasterCommandPort;
@@ -151,6 +199,16 @@ namespace maxOS {
             Port8BitSlow programmableInterruptControllerSlaveCommandPort;
             Port8BitSlow programmableInterruptControllerSlaveDataPort;
 
+            //Once the APIC is in use interrupts are acknowledged through it instead of the PICs
+            LocalAPIC* localAPIC;
+
+            //Vectors after the 16 legacy IRQs are handed out to devices using message signalled interrupts
+            common::uint32_t usedMessageVectors;
+
+            //Filled in by the dispatcher, only ever read outside of interrupt context
+            static InterruptStatistics statistics[256];
+            common::uint32_t unhandledInterrupts;
+
 
         public:
             InterruptManager(maxOS::common::uint16_t hardwareInterruptOffset, system::GlobalDescriptorTable *globalDescriptorTable, ThreadManager* threadManager);
@@ -163,7 +221,41 @@ namespace maxOS {
 
             void Deactivate();
 
+            void UseAPIC(LocalAPIC* localAPIC);
+
+            static const int numMessageVectors = 32;
+            int AllocateMessageVectors(int count);
+            void FreeMessageVectors(common::uint8_t interrupt, int count);
+
+            InterruptStatistics* Statistics(common::uint8_t interrupt);
+            common::uint32_t UnhandledInterrupts();
+            void ResetStatistics();
+            void DumpStatistics(serial* log);
+
         };
+
+        /**
+         * @details Stop interrupts, remembering if they were on (syscalls already run with them off)
+         * @return The flags to pass to RestoreInterrupts
+         */
+        inline common::uint32_t DisableInterrupts(){
+
+            common::uint32_t flags;
+            asm volatile("pushfl; popl %0; cli" : "=r"(flags) : : "memory");
+            return flags;
+
+        }
+
+        /**
+         * @details Turn interrupts back on if they were on before DisableInterrupts
+         * @param flags What DisableInterrupts returned
+         */
+        inline void RestoreInterrupts(common::uint32_t flags){
+
+            if(flags & (1 << 9))
+                asm volatile("sti" : : : "memory");
+
+        }
     }
 }
 
@@ -22,13 +22,35 @@ namespace maxOS
             InputOutput = 1
         };
 
+        enum PeripheralComponentInterconnectCapability{
+            PCI_CAPABILITY_MSI = 0x05,
+            PCI_CAPABILITY_EXPRESS = 0x10,
+            PCI_CAPABILITY_MSIX = 0x11
+        };
+
+        //Capabilities in the extended config space (offset 0x100 onwards), only reachable through ECAM
+        enum PeripheralComponentInterconnectExtendedCapability{
+            PCI_EXTENDED_CAPABILITY_AER = 0x0001,
+            PCI_EXTENDED_CAPABILITY_SRIOV = 0x0010
+        };
+
+        enum PeripheralComponentInterconnectVendor{
+            PCI_VENDOR_AMD = 0x1022,
+            PCI_VENDOR_INTEL = 0x8086,
+            PCI_VENDOR_VIRTIO = 0x1AF4,             //Red Hat, every virtio device
+            PCI_VENDOR_ANY = 0xFFFF                 //Matches every vendor / device in a match table
+        };
+
         class BaseAdressRegister{
             public:
                 bool preFetchable;
-                common::uint8_t* adress;
-                common::uint32_t size;
+                bool is64Bit;                           //Memory BARs only, it also takes the next BAR slot
+                common::uint8_t* adress;                //Port number (I/O) or physical address (memory), 0 if unused or above 4GB
+                common::uint64_t physicalAddress;
+                common::uint64_t size;
                 BaseAdressRegisterType type;
 
+                BaseAdressRegister();
         };
 
 
@@ -49,29 +71,93 @@ namespace maxOS
                 common::uint8_t interface_id;
 
                 common::uint8_t revision;
+                common::uint8_t headerType;         //0 = device, 1 = PCI-to-PCI bridge
+
+                drivers::Driver* driver;            //The driver bound to it, 0 if there isn't one
+
+                //Set up by EnableMSIX
+                volatile common::uint32_t* msixTable;
+                common::uint16_t msixTableSize;
 
                 PeripheralComponentInterconnectDeviceDescriptor();
                 ~PeripheralComponentInterconnectDeviceDescriptor();
         };
 
 
+        //One line of a driver's match table, a device matches if the IDs match (or are PCI_VENDOR_ANY) and so do the class bits in the mask
+        struct PeripheralComponentInterconnectDeviceID{
+            common::uint16_t vendor_ID;
+            common::uint16_t device_ID;
+            common::uint32_t classCode;             //Class << 16 | subclass << 8 | interface
+            common::uint32_t classMask;
+        };
+
+        typedef drivers::Driver* (*PeripheralComponentInterconnectDriverFactory)(PeripheralComponentInterconnectDeviceDescriptor* dev, InterruptManager* interruptManager);
+
+        struct PeripheralComponentInterconnectDriverEntry{
+            char* name;
+            const PeripheralComponentInterconnectDeviceID* ids;
+            int numIDs;
+            PeripheralComponentInterconnectDriverFactory create;
+        };
+
+        //Put a driver in the .pci_drivers section, the linker collects them into one table so the PCI code doesn't need to know every driver
+        #define REGISTER_PCI_DRIVER(variable, name, ids, create) \
+            static maxOS::hardwarecommunication::PeripheralComponentInterconnectDriverEntry variable \
+            __attribute__((section(".pci_drivers"), used)) = { name, ids, sizeof(ids) / sizeof(ids[0]), create }
+
         class PeripheralComponentInterconnectController
         {
                 Port32Bit dataPort;
                 Port32Bit commandPort;
+
+                //Memory mapped config space (PCIe ECAM), 4KB per function. Buses it doesn't cover use the ports
+                static const int maxECAMBuses = 32;
+                volatile common::uint8_t* ecam;
+                common::uint16_t ecamStartBus;
+                common::uint16_t ecamEndBus;
+
+                volatile common::uint32_t* ECAMAddress(common::uint16_t bus, common::uint16_t device, common::uint16_t function, common::uint32_t registeroffset);
+
+                static const int maxDevices = 64;
+                PeripheralComponentInterconnectDeviceDescriptor devices[maxDevices];
+                int numDevices;
+                bool enumerated;
+
+                void EnumerateBus(common::uint16_t bus, int depth);
+                void EnumerateFunction(common::uint16_t bus, common::uint16_t device, common::uint16_t function, int depth);
+
             public:
+                static PeripheralComponentInterconnectController* activeController;
+
                 PeripheralComponentInterconnectController();
                 ~PeripheralComponentInterconnectController();
 
                 common::uint32_t Read(common::uint16_t bus, common::uint16_t device, common::uint16_t function, common::uint32_t registeroffset);
                 void Write(common::uint16_t bus, common::uint16_t device, common::uint16_t function, common::uint32_t registeroffset, common::uint32_t value);
                 bool DeviceHasFunctions(common::uint16_t bus, common::uint16_t device);
+                bool HasExtendedConfigSpace();
+
+                void Enumerate();
+                int NumDevices();
+                PeripheralComponentInterconnectDeviceDescriptor* GetDevice(int index);
+                PeripheralComponentInterconnectDeviceDescriptor* FindDevice(common::uint16_t vendor_ID, common::uint16_t device_ID);
+                PeripheralComponentInterconnectDeviceDescriptor* FindClass(common::uint8_t class_id, common::uint8_t subclass_id, PeripheralComponentInterconnectDeviceDescriptor* after = 0);
 
                 void SelectDrivers(drivers::DriverManager* driverManager, InterruptManager* interruptManager);
-                drivers::Driver* GetDriver(PeripheralComponentInterconnectDeviceDescriptor dev, InterruptManager* interruptManager);
+                static bool Matches(const PeripheralComponentInterconnectDeviceID* id, PeripheralComponentInterconnectDeviceDescriptor* dev);
+                drivers::Driver* GetDriver(PeripheralComponentInterconnectDeviceDescriptor* dev, InterruptManager* interruptManager);
+
+                common::uint8_t FindCapability(common::uint16_t bus, common::uint16_t device, common::uint16_t function, common::uint8_t id);
+                common::uint16_t FindExtendedCapability(common::uint16_t bus, common::uint16_t device, common::uint16_t function, common::uint16_t id);
+
+                int EnableMSI(PeripheralComponentInterconnectDeviceDescriptor* dev, InterruptManager* interruptManager, int count);
+                bool EnableMSIX(PeripheralComponentInterconnectDeviceDescriptor* dev);
+                int AllocateMSIXVector(PeripheralComponentInterconnectDeviceDescriptor* dev, InterruptManager* interruptManager, common::uint16_t entry);
 
                 PeripheralComponentInterconnectDeviceDescriptor GetDeviceDescriptor(common::uint16_t bus, common::uint16_t device, common::uint16_t function);
                 BaseAdressRegister GetBaseAdressRegister(common::uint16_t bus, common::uint16_t device, common::uint16_t function, common::uint16_t bar);       // bar = 0-5 in case of header type 0 [or]  bar = 0-1 in case of header type 1
+                void* MapBaseAdressRegister(PeripheralComponentInterconnectDeviceDescriptor* dev, common::uint16_t bar);
         };
     }
 }
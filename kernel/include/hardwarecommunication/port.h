@@ -6,11 +6,91 @@
 #define MAX_OS_HARDWARECOMMUNICATION_PORT_H
 
 #include <common/types.h>
+
+//The kernel is built without optimisation, so port access has to be forced inline to not cost a call per inb / outb
+#define PORT_INLINE inline __attribute__((always_inline))
+
 namespace maxOS {
     namespace hardwarecommunication {
+
+        //Port I/O instructions for each width, String transfers move a whole buffer with one rep ins / outs
+        template<typename T> class PortIO;
+
+        template<> class PortIO<maxOS::common::uint8_t> {
+        public:
+            static PORT_INLINE void Write(maxOS::common::uint16_t port, maxOS::common::uint8_t data){
+                __asm__ volatile("outb %0, %1" : : "a" (data), "Nd" (port));      //Nd--> d:The d register & N:Unsigned 8-bit integer constant
+            }
+
+            static PORT_INLINE maxOS::common::uint8_t Read(maxOS::common::uint16_t port){
+                maxOS::common::uint8_t result;
+                __asm__ volatile("inb %1, %0" : "=a" (result) : "Nd" (port));
+                return result;
+            }
+
+            static PORT_INLINE void ReadString(maxOS::common::uint16_t port, maxOS::common::uint8_t* buffer, maxOS::common::uint32_t count){
+                __asm__ volatile("rep insb" : "+D" (buffer), "+c" (count) : "d" (port) : "memory");
+            }
+
+            static PORT_INLINE void WriteString(maxOS::common::uint16_t port, const maxOS::common::uint8_t* buffer, maxOS::common::uint32_t count){
+                __asm__ volatile("rep outsb" : "+S" (buffer), "+c" (count) : "d" (port) : "memory");
+            }
+        };
+
+        template<> class PortIO<maxOS::common::uint16_t> {
+        public:
+            static PORT_INLINE void Write(maxOS::common::uint16_t port, maxOS::common::uint16_t data){
+                __asm__ volatile("outw %0, %1" : : "a" (data), "Nd" (port));
+            }
+
+            static PORT_INLINE maxOS::common::uint16_t Read(maxOS::common::uint16_t port){
+                maxOS::common::uint16_t result;
+                __asm__ volatile("inw %1, %0" : "=a" (result) : "Nd" (port));
+                return result;
+            }
+
+            static PORT_INLINE void ReadString(maxOS::common::uint16_t port, maxOS::common::uint16_t* buffer, maxOS::common::uint32_t count){
+                __asm__ volatile("rep insw" : "+D" (buffer), "+c" (count) : "d" (port) : "memory");
+            }
+
+            static PORT_INLINE void WriteString(maxOS::common::uint16_t port, const maxOS::common::uint16_t* buffer, maxOS::common::uint32_t count){
+                __asm__ volatile("rep outsw" : "+S" (buffer), "+c" (count) : "d" (port) : "memory");
+            }
+        };
+
+        template<> class PortIO<maxOS::common::uint32_t> {
+        public:
+            static PORT_INLINE void Write(maxOS::common::uint16_t port, maxOS::common::uint32_t data){
+                __asm__ volatile("outl %0, %1" : : "a" (data), "Nd" (port));
+            }
+
+            static PORT_INLINE maxOS::common::uint32_t Read(maxOS::common::uint16_t port){
+                maxOS::common::uint32_t result;
+                __asm__ volatile("inl %1, %0" : "=a" (result) : "Nd" (port));
+                return result;
+            }
+
+            static PORT_INLINE void ReadString(maxOS::common::uint16_t port, maxOS::common::uint32_t* buffer, maxOS::common::uint32_t count){
+                __asm__ volatile("rep insl" : "+D" (buffer), "+c" (count) : "d" (port) : "memory");
+            }
+
+            static PORT_INLINE void WriteString(maxOS::common::uint16_t port, const maxOS::common::uint32_t* buffer, maxOS::common::uint32_t count){
+                __asm__ volatile("rep outsl" : "+S" (buffer), "+c" (count) : "d" (port) : "memory");
+            }
+        };
+
+        //A port whose number is known at compile time (e.g. FixedPort<uint8_t, 0x64>::Read()), doesn't need an object at all
+        template<typename T, maxOS::common::uint16_t Address> class FixedPort {
+        public:
+            static PORT_INLINE void Write(T data){ PortIO<T>::Write(Address, data); }
+            static PORT_INLINE T Read(){ return PortIO<T>::Read(Address); }
+            static PORT_INLINE void ReadString(T* buffer, maxOS::common::uint32_t count){ PortIO<T>::ReadString(Address, buffer, count); }
+            static PORT_INLINE void WriteString(const T* buffer, maxOS::common::uint32_t count){ PortIO<T>::WriteString(Address, buffer, count); }
+        };
+
         //Base Class for ports
         class Port {
-        protected:  //Protected so that it cant be instantiated bc its purely virtual
+        protected:  //Protected so that it cant be instantiated
             maxOS::common::uint16_t portnumber;
 
             Port(maxOS::common::uint16_t portnumber);
@@ -18,6 +98,7 @@ namespace maxOS {
             ~Port();
         };
 
+        //Ports whose number is only known at run time (e.g. from a PCI BAR), thin wrappers around PortIO
         class Port8Bit : public Port {
         public:
             //Constructor / Deconstructor
@@ -26,9 +107,11 @@ namespace maxOS {
             ~Port8Bit();
 
             //Read / Write Method
-            virtual void Write(maxOS::common::uint8_t data);
+            PORT_INLINE void Write(maxOS::common::uint8_t data){ PortIO<maxOS::common::uint8_t>::Write(portnumber, data); }
+            PORT_INLINE maxOS::common::uint8_t Read(){ return PortIO<maxOS::common::uint8_t>::Read(portnumber); }
 
-            virtual maxOS::common::uint8_t Read();
+            PORT_INLINE void ReadString(maxOS::common::uint8_t* buffer, maxOS::common::uint32_t count){ PortIO<maxOS::common::uint8_t>::ReadString(portnumber, buffer, count); }
+            PORT_INLINE void WriteString(const maxOS::common::uint8_t* buffer, maxOS::common::uint32_t count){ PortIO<maxOS::common::uint8_t>::WriteString(portnumber, buffer, count); }
         };
 
         class Port8BitSlow : public Port8Bit {
@@ -38,8 +121,10 @@ namespace maxOS {
 
             ~Port8BitSlow();
 
-            //Read / Write Method
-            virtual void Write(maxOS::common::uint8_t data);
+            //Write Method, gives old devices (PIC, CMOS) time to take the byte
+            PORT_INLINE void Write(maxOS::common::uint8_t data){
+                __asm__ volatile("outb %0, %1\njmp 1f\n1: jmp 1f\n1:" : : "a" (data), "Nd" (portnumber));
+            }
             //---Inherits read methods
         };
 
@@ -51,9 +136,11 @@ namespace maxOS {
             ~Port16Bit();
 
             //Read / Write Method
-            virtual void Write(maxOS::common::uint16_t data);
+            PORT_INLINE void Write(maxOS::common::uint16_t data){ PortIO<maxOS::common::uint16_t>::Write(portnumber, data); }
+            PORT_INLINE maxOS::common::uint16_t Read(){ return PortIO<maxOS::common::uint16_t>::Read(portnumber); }
 
-            virtual maxOS::common::uint16_t Read();
+            PORT_INLINE void ReadString(maxOS::common::uint16_t* buffer, maxOS::common::uint32_t count){ PortIO<maxOS::common::uint16_t>::ReadString(portnumber, buffer, count); }
+            PORT_INLINE void WriteString(const maxOS::common::uint16_t* buffer, maxOS::common::uint32_t count){ PortIO<maxOS::common::uint16_t>::WriteString(portnumber, buffer, count); }
         };
 
         class Port32Bit : public Port {
@@ -64,9 +151,11 @@ namespace maxOS {
             ~Port32Bit();
 
             //Read / Write Method
-            virtual void Write(maxOS::common::uint32_t data);
+            PORT_INLINE void Write(maxOS::common::uint32_t data){ PortIO<maxOS::common::uint32_t>::Write(portnumber, data); }
+            PORT_INLINE maxOS::common::uint32_t Read(){ return PortIO<maxOS::common::uint32_t>::Read(portnumber); }
 
-            virtual maxOS::common::uint32_t Read();
+            PORT_INLINE void ReadString(maxOS::common::uint32_t* buffer, maxOS::common::uint32_t count){ PortIO<maxOS::common::uint32_t>::ReadString(portnumber, buffer, count); }
+            PORT_INLINE void WriteString(const maxOS::common::uint32_t* buffer, maxOS::common::uint32_t count){ PortIO<maxOS::common::uint32_t>::WriteString(portnumber, buffer, count); }
         };
     }
 }
@@ -75,6 +164,6 @@ namespace maxOS {
 
 //NOTES
 //1-protected : members can be used by objects of the derived classes but not by objects of the base class.
-//2-virtual : if the base class and the derived class both have the same function [same name, same input parameters, same return type], then this function is overriden . So to make sure that when calling a member function from an object of the derived class , that this function called is the function that belongs to the derived class not to the base class , we use the virtual keyword to tell the compiler we want to resolve to the most derived class.
+//2-always_inline : the instruction is put where the port is used instead of calling a function, an inb / outb is a single instruction so a call (or a virtual call) would cost more than the access.
 //3-static : static member functions can be called without creating an object for this class .
-//4-inline : when code is compiled , a call to a function is replaced with the function's code rather than calling the function which improves performance .
\ No newline at end of file
+//4-rep ins / outs : repeats the transfer ecx times, moving to / from the buffer at edi / esi, so a whole sector is one instruction.
@@ -103,6 +103,8 @@ namespace maxOS{
                 void printHeader(char* col, char* type, char* msg);
 
             public:
+                static serial* activeSerial;
+
                 serial(InterruptManager* interruptManager);
                 ~serial();
 
@@ -111,6 +113,9 @@ namespace maxOS{
                 void Test();
                 char Read();
                 void Write(char* str, int type = 0);
+                void WriteNumber(common::uint64_t number);
+                void WriteHex(common::uint32_t number);
+                void WriteBytes(common::uint8_t* data, common::uint32_t length);
 
 
         };
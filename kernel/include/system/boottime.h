@@ -0,0 +1,48 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#ifndef MAXOS_SYSTEM_BOOTTIME_H
+#define MAXOS_SYSTEM_BOOTTIME_H
+
+#include <common/types.h>
+#include <hardwarecommunication/serial.h>
+
+namespace maxOS{
+
+    namespace system{
+
+        //A stage of kernelMain or the probe of one device, times are raw TSC values as the clock isn't calibrated for most of boot
+        struct BootEvent{
+            char* name;
+            common::uint32_t id;                            //Which device a probe was for (e.g. PCI bus/device/function)
+            common::uint64_t start;
+            common::uint64_t end;
+            bool probe;
+        };
+
+        /**
+         * @details Records how long each part of boot takes. Everything is static as it starts before there is a heap
+         */
+        class BootTimeline{
+
+            protected:
+                static const int maxEvents = 128;
+                static BootEvent events[maxEvents];
+                static int numEvents;
+                static int currentStage;                    //-1 when no stage is running
+
+            public:
+                static void Stage(char* name);
+                static void Finish();
+                static int BeginProbe(char* name, common::uint32_t id);
+                static void EndProbe(int probe);
+
+                static void Report(hardwarecommunication::serial* log);
+        };
+
+    }
+
+}
+
+#endif //MAXOS_SYSTEM_BOOTTIME_H
@@ -0,0 +1,72 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#ifndef MAXOS_SYSTEM_CLOCK_H
+#define MAXOS_SYSTEM_CLOCK_H
+
+#include <common/types.h>
+#include <hardwarecommunication/port.h>
+#include <hardwarecommunication/interrupts.h>
+
+namespace maxOS{
+
+    namespace system{
+
+        class Clock : public hardwarecommunication::InterruptHandler{
+
+            protected:
+                //The TSC is calibrated against the HPET when ACPI describes one, otherwise PIT channel 2 (its gate can be polled without interrupts)
+                hardwarecommunication::Port8Bit PITChannel2DataPort;
+                hardwarecommunication::Port8Bit PITCommandPort;
+                hardwarecommunication::Port8Bit PITGatePort;
+
+                //CMOS real time clock, read once at boot for CLOCK_REALTIME
+                hardwarecommunication::Port8BitSlow CMOSAddressPort;
+                hardwarecommunication::Port8BitSlow CMOSDataPort;
+
+                common::uint32_t ticksPerMillisecond;           //TSC ticks in a millisecond
+                common::uint32_t mult;                          //ns = (ticks * mult) >> shift
+                common::uint32_t shift;
+                common::uint32_t microsecondMult;               //us = (ticks * microsecondMult) >> shift
+                common::uint32_t ticksPerMicrosecond;           //Scaled by 2^16
+
+                common::uint64_t lastUpdate;                    //TSC value when the time below was last advanced
+                common::uint32_t seconds;                       //Seconds since boot
+                common::uint32_t nanoseconds;                   //Nanoseconds into the current second
+                common::uint32_t bootTime;                      //Unix time (seconds) when the kernel booted
+                common::uint8_t centuryRegister;                //CMOS register with the century (from the FADT), 0 if there isn't one
+
+                void Calibrate();
+                common::uint64_t MeasureWithPIT(common::uint32_t milliseconds);
+                common::uint64_t MeasureWithHPET(common::uint32_t milliseconds);
+                common::uint8_t ReadCMOS(common::uint8_t reg);
+                common::uint32_t ReadRealTimeClock();
+
+            public:
+                static Clock* activeClock;
+
+                Clock(hardwarecommunication::InterruptManager* interruptManager);
+                ~Clock();
+
+                common::uint32_t HandleInterrupt(common::uint32_t esp);
+
+                static inline common::uint64_t ReadTimestampCounter(){
+                    common::uint32_t low, high;
+                    asm volatile("rdtsc" : "=a"(low), "=d"(high));
+                    return ((common::uint64_t)high << 32) | low;
+                }
+
+                void Update();
+                common::uint32_t TicksPerMillisecond();
+                common::uint32_t TicksToMicroseconds(common::uint64_t ticks);
+                common::uint64_t MicrosecondsToTicks(common::uint32_t microseconds);
+                void GetTime(common::uint32_t* seconds, common::uint32_t* nanoseconds);
+                common::uint32_t BootTime();
+        };
+
+    }
+
+}
+
+#endif //MAXOS_SYSTEM_CLOCK_H
@@ -0,0 +1,74 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#ifndef MAXOS_SYSTEM_ELF_H
+#define MAXOS_SYSTEM_ELF_H
+
+#include <common/types.h>
+
+namespace maxOS{
+
+    namespace system{
+
+        struct ElfHeader{
+            common::uint8_t identity[16];                   //0x7F 'E' 'L' 'F', class, data, version...
+            common::uint16_t type;                          //2 = executable
+            common::uint16_t machine;                       //3 = i386
+            common::uint32_t version;
+            common::uint32_t entry;
+            common::uint32_t programHeaderOffset;
+            common::uint32_t sectionHeaderOffset;
+            common::uint32_t flags;
+            common::uint16_t headerSize;
+            common::uint16_t programHeaderSize;
+            common::uint16_t programHeaderCount;
+            common::uint16_t sectionHeaderSize;
+            common::uint16_t sectionHeaderCount;
+            common::uint16_t sectionNameIndex;
+        } __attribute__((packed));
+
+        enum ElfProgramType{
+            ELF_PROGRAM_NULL = 0,
+            ELF_PROGRAM_LOAD = 1
+        };
+
+        enum ElfProgramFlags{
+            ELF_PROGRAM_EXECUTE = 1,
+            ELF_PROGRAM_WRITE   = 2,
+            ELF_PROGRAM_READ    = 4
+        };
+
+        struct ElfProgramHeader{
+            common::uint32_t type;
+            common::uint32_t offset;                        //Where the segment starts in the file
+            common::uint32_t virtualAddress;
+            common::uint32_t physicalAddress;
+            common::uint32_t fileSize;                      //Bytes in the file, the rest of memorySize is zeroed (.bss)
+            common::uint32_t memorySize;
+            common::uint32_t flags;
+            common::uint32_t alignment;
+        } __attribute__((packed));
+
+        class Process;
+
+        class ElfLoader{
+
+            protected:
+                common::uint8_t* image;
+                common::uint32_t size;
+
+            public:
+                ElfLoader(common::uint8_t* image, common::uint32_t size);
+                ~ElfLoader();
+
+                bool IsValid();
+                common::uint32_t EntryPoint();
+                bool Load(Process* process);
+        };
+
+    }
+
+}
+
+#endif //MAXOS_SYSTEM_ELF_H
@@ -8,6 +8,17 @@
 #include <common/types.h>
 namespace maxOS {
     namespace system {
+
+        //Only used to find the kernel stack when an interrupt arrives from ring 3 (no hardware task switching)
+        struct TaskStateSegment{
+            maxOS::common::uint32_t previousTask;
+            maxOS::common::uint32_t esp0;                   //Kernel stack
+            maxOS::common::uint32_t ss0;                    //Kernel stack segment
+            maxOS::common::uint32_t unused[22];
+            maxOS::common::uint16_t trap;
+            maxOS::common::uint16_t ioMapBase;
+        } __attribute__((packed));
+
         class GlobalDescriptorTable {
         public:
             class SegmentDescriptor {
@@ -34,6 +45,11 @@ namespace maxOS {
             SegmentDescriptor unusedSegmentSelector;
             SegmentDescriptor codeSegmentSelector;
             SegmentDescriptor dataSegmentSelector;
+            SegmentDescriptor userCodeSegmentSelector;
+            SegmentDescriptor userDataSegmentSelector;
+            SegmentDescriptor taskStateSegmentSelector;
+
+            static TaskStateSegment taskStateSegment;
 
         public:
 
@@ -44,6 +60,14 @@ namespace maxOS {
             maxOS::common::uint16_t CodeSegmentSelector();
 
             maxOS::common::uint16_t DataSegmentSelector();
+
+            maxOS::common::uint16_t UserCodeSegmentSelector();
+
+            maxOS::common::uint16_t UserDataSegmentSelector();
+
+            maxOS::common::uint16_t TaskStateSegmentSelector();
+
+            void SetKernelStack(maxOS::common::uint32_t esp0);
         };
     }
 }
@@ -0,0 +1,136 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#ifndef MAXOS_SYSTEM_IOURING_H
+#define MAXOS_SYSTEM_IOURING_H
+
+#include <common/types.h>
+#include <system/paging.h>
+
+namespace maxOS{
+
+    namespace system{
+
+        enum IORingOperation{
+            IORING_OP_NOP       = 0,
+            IORING_OP_READ      = 1,
+            IORING_OP_WRITE     = 2,
+            IORING_OP_SEND      = 3,
+            IORING_OP_RECV      = 4,
+            IORING_OP_FSYNC     = 5,
+            IORING_OP_TIMEOUT   = 6
+        };
+
+        enum IORingSetupFlags{
+            IORING_SETUP_SQPOLL = 1                             //The kernel poller thread consumes submissions, no enter syscall needed
+        };
+
+        //Shared with user space, so these are ABI
+        struct IORingSubmission{
+            common::uint8_t opcode;                             //IORingOperation
+            common::uint8_t flags;
+            common::uint16_t reserved;
+            common::int32_t fd;                                 //Index into the registered files
+            common::uint32_t offset;                            //Sector / byte offset for read and write, microseconds for a timeout
+            common::uint32_t address;                           //Buffer
+            common::uint32_t length;                            //Buffer length
+            common::uint32_t userData;                          //Copied to the completion untouched
+        } __attribute__((packed));
+
+        struct IORingCompletion{
+            common::uint32_t userData;
+            common::int32_t result;                             //Bytes transferred, or -1 on error
+        } __attribute__((packed));
+
+        //The submission queue is produced by user space (tail) and consumed by the kernel (head), the completion queue is the other way around
+        struct IORingQueues{
+            volatile common::uint32_t submissionHead;
+            volatile common::uint32_t submissionTail;
+            volatile common::uint32_t completionHead;
+            volatile common::uint32_t completionTail;
+            common::uint32_t mask;                              //entries - 1
+            common::uint32_t entries;
+            common::uint32_t droppedCompletions;                //Completions lost because user space didn't reap them in time
+            IORingSubmission* submissions;
+            IORingCompletion* completions;
+        } __attribute__((packed));
+
+        struct IORingParameters{
+            common::uint32_t entries;                           //In: rounded up to a power of two
+            common::uint32_t flags;                             //In: IORingSetupFlags
+            IORingQueues* queues;                               //Out: the shared queues, mapped into the caller's address space
+        } __attribute__((packed));
+
+        //Anything that a ring can do IO on, drivers override the operations they support
+        class IORingFile{
+            public:
+                IORingFile();
+                ~IORingFile();
+
+                virtual common::int32_t Read(common::uint8_t* buffer, common::uint32_t length, common::uint32_t offset);
+                virtual common::int32_t Write(common::uint8_t* buffer, common::uint32_t length, common::uint32_t offset);
+                virtual common::int32_t Send(common::uint8_t* buffer, common::uint32_t length);
+                virtual common::int32_t Receive(common::uint8_t* buffer, common::uint32_t length);
+                virtual common::int32_t Sync();
+        };
+
+        class IORing{
+
+            protected:
+                static const int maxRings = 16;
+                static const int maxFiles = 16;
+                static const int maxTimeouts = 32;
+
+                static IORing* rings[maxRings];
+                static IORingFile* files[maxFiles];
+
+                //Rings belong to the process that set them up, their memory is only reachable in its address space
+                common::pid_t owner;
+                PageDirectory* addressSpace;                    //0 when a kernel thread owns the ring
+                common::uint32_t size;                          //Bytes of shared memory
+
+                //The kernel's own copies of the layout, user space can scribble over the ones in the shared header
+                IORingQueues* queues;
+                IORingSubmission* submissions;
+                IORingCompletion* completions;
+                common::uint32_t entries;
+                common::uint32_t mask;
+                common::uint32_t flags;
+                common::uint32_t submissionHead;                //Next submission to take, the one in the shared header is only a copy for user space
+
+                struct PendingTimeout{
+                    common::uint64_t deadline;                  //TSC value
+                    common::uint32_t userData;
+                    bool active;
+                };
+                PendingTimeout timeouts[maxTimeouts];
+                int activeTimeouts;
+
+                bool MapQueues(common::uint32_t address);
+                bool IsOwnerMemory(common::uint32_t address, common::uint32_t length, bool write);
+                void Complete(common::uint32_t userData, common::int32_t result);
+                void Execute(IORingSubmission* submission);
+                void ExpireTimeouts();
+                void Wait(common::uint32_t minComplete);
+
+            public:
+                IORing(common::uint32_t entries, common::uint32_t flags, common::pid_t owner, PageDirectory* addressSpace, common::uint32_t address);
+                ~IORing();
+
+                bool IsValid();
+                common::int32_t Submit(common::uint32_t count);
+                IORingQueues* Queues();
+
+                static int RegisterFile(IORingFile* file);
+                static int Setup(IORingParameters* parameters);
+                static int Enter(int ring, common::uint32_t toSubmit, common::uint32_t minComplete);
+                static void Release(common::pid_t pid);
+                static void Poller();
+        };
+
+    }
+
+}
+
+#endif //MAXOS_SYSTEM_IOURING_H
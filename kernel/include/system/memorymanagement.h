@@ -50,5 +50,7 @@ void* operator new[](unsigned size, void* pointer);
 
 void operator delete(void* pointer);
 void operator delete[](void* pointer);
+void operator delete(void* pointer, unsigned size);
+void operator delete[](void* pointer, unsigned size);
 
 #endif //MAXOS_SYSTEM_MEMORYMANAGEMENT_H
@@ -7,6 +7,7 @@
 
 #include <common/types.h>
 #include <system/gdt.h>
+#include <system/paging.h>
 
 
 namespace maxOS{
@@ -38,14 +39,40 @@ namespace maxOS{
     }  __attribute__((packed));
 
 
+    // CPU usage of a thread, all times are in TSC ticks
+    struct ThreadStatistics
+    {
+        common::uint64_t runTicks;                      // time spent running (includes irqTicks)
+        common::uint64_t irqTicks;                      // time spent in hardware interrupt handlers while this thread was running
+        common::uint64_t wakeupLatencyTicks;            // total time between becoming ready and getting the CPU
+        common::uint64_t maxWakeupLatencyTicks;
+        common::uint32_t wakeups;                       // times the thread was switched to
+        common::uint32_t voluntarySwitches;             // times the thread gave up the CPU itself
+        common::uint32_t involuntarySwitches;           // times the thread was preempted
+    } __attribute__((packed));
+
+    // One entry of the thread statistics syscall
+    struct ThreadInfo
+    {
+        common::int32_t tid;
+        common::pid_t pid;
+        ThreadStatistics statistics;
+    } __attribute__((packed));
+
     class Thread
     {
         friend class ThreadManager;
         private:
             common::uint8_t stack[4096];                // 4 KiB
+            common::uint32_t kernelStack;               // top of the stack traps from ring 3 use, 0 for kernel threads
             CPUState_Thread* cpustate;
             bool yieldStatus;                           // if true, Thread will be yielded
             int tid;                                    // thread id
+            common::pid_t pid;                          // id of the process that owns this thread
+            system::PageDirectory* addressSpace;        // 0 for kernel threads, they run in whatever address space is loaded
+            ThreadStatistics statistics;
+            common::uint64_t scheduledAt;               // TSC when the thread last got the CPU
+            common::uint64_t readySince;                // TSC when the thread last became ready to run
         public:
             Thread(system::GlobalDescriptorTable *gdt, void entrypoint());
             Thread(void entrypoint());
@@ -63,11 +90,17 @@ namespace maxOS{
             static int currentThread;
             static system::GlobalDescriptorTable *gdt;
         public:
+            static ThreadManager* activeThreadManager;
+
             ThreadManager();
             ThreadManager(system::GlobalDescriptorTable *gdt);
             ~ThreadManager();
-            int CreateThread(void entrypoint());
-            CPUState_Thread* Schedule(CPUState_Thread* cpustate);
+            int CreateThread(void entrypoint(), common::pid_t pid = 0);
+            int CreateUserThread(common::uint32_t entrypoint, common::uint32_t userStack, common::pid_t pid, system::PageDirectory* addressSpace);
+            common::pid_t CurrentPID();
+            CPUState_Thread* Schedule(CPUState_Thread* cpustate, bool voluntary = false);
+            void AccountInterrupt(common::uint64_t ticks);
+            int GetStatistics(ThreadInfo* info, int maxThreads);
             bool TerminateThread(int tid);
             bool JoinThreads(int other);
             bool CheckThreads(int tid);
@@ -0,0 +1,118 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#ifndef MAXOS_SYSTEM_PAGECACHE_H
+#define MAXOS_SYSTEM_PAGECACHE_H
+
+#include <common/types.h>
+#include <drivers/blockdevice.h>
+
+namespace maxOS{
+
+    namespace system{
+
+        enum CachedPageFlags{
+            CACHED_PAGE_DEVICE = 0x01,                      //The owner is a block device, otherwise a file in memory
+            CACHED_PAGE_UPTODATE = 0x02,                    //The frame holds the data, otherwise a read is still in flight
+            CACHED_PAGE_REFERENCED = 0x04,                  //Used since the clock hand last passed
+            CACHED_PAGE_DIRTY = 0x08,                       //Written to since it was last written back
+            CACHED_PAGE_ERROR = 0x10                        //The read failed
+        };
+
+        /**
+         * @details A page of a file or a block device that is kept in memory, file pages can be mapped into many processes at once
+         */
+        struct CachedPage{
+            void* owner;                                    //The file or block device the page belongs to (0 if the slot is unused)
+            common::uint32_t index;                         //Which page of the owner it is (byte offset / PAGE_SIZE)
+            void* frame;
+            common::int16_t next;                           //Next page in the same bucket (or the free list), -1 at the end
+            common::uint8_t flags;                          //CachedPageFlags
+            common::int8_t io;                              //Transfer in flight for the page, -1 if there is none
+            common::uint64_t dirtied;                       //TSC value when it became dirty
+        };
+
+        //Sequential access to a device is detected per stream, the read ahead window doubles every time a stream continues
+        struct ReadAheadStream{
+            drivers::BlockDevice* device;
+            common::uint32_t nextIndex;                     //Page a sequential read would start at
+            common::uint32_t window;                        //Pages to keep read ahead, 0 until the stream turns out to be sequential
+            common::uint32_t ahead;                         //Page read ahead was issued up to
+        };
+
+        class PageCache{
+
+            protected:
+                static const int maxPages = 1024;
+                static const int numBuckets = 256;
+                static const int maxIO = 64;
+                static const int maxStreams = 8;
+
+                static const common::uint32_t evictBatch = 32;
+                static const common::uint32_t minReadAhead = 4;                //Pages
+                static const common::uint32_t maxReadAhead = 32;
+                static const common::uint32_t dirtyLimit = maxPages / 4;       //Writers write back themselves past this
+                static const common::uint32_t lowFreeFrames = 64;              //The write back thread evicts below this
+                static const common::uint32_t writeBackInterval = 1000000;     //Microseconds
+                static const common::uint32_t dirtyExpire = 5000000;
+
+                CachedPage pages[maxPages];
+                common::int16_t buckets[numBuckets];
+                common::int16_t freePages;
+                common::int16_t clockHand;
+
+                drivers::BlockIO ios[maxIO];                //Free if the context is 0
+                ReadAheadStream streams[maxStreams];
+                int nextStream;
+
+                common::uint32_t hits;
+                common::uint32_t misses;
+                common::uint32_t readAheads;
+                common::uint32_t writeBacks;
+                common::uint32_t numDirty;
+                common::uint64_t nextWriteBack;
+
+                static common::uint32_t Hash(void* owner, common::uint32_t index);
+                static common::uint64_t MicrosecondsToTicks(common::uint32_t microseconds);
+
+                common::int16_t Find(void* owner, common::uint32_t index);
+                common::int16_t Insert(void* owner, common::uint32_t index, common::uint8_t flags);
+                void Remove(common::int16_t slot);
+
+                int AllocateIO();
+                bool StartIO(common::int16_t slot, drivers::BlockOperation operation);
+                void WaitIO(common::int16_t slot);
+                static void IODone(drivers::BlockIO* io);
+
+                void ReadAhead(drivers::BlockDevice* device, common::uint32_t index, common::uint32_t count);
+                common::uint32_t WriteBackExpired();
+
+            public:
+                static PageCache* activePageCache;
+
+                PageCache();
+                ~PageCache();
+
+                void* GetPage(common::uint8_t* file, common::uint32_t fileSize, common::uint32_t offset);
+                common::uint32_t Evict(common::uint32_t count = evictBatch);
+
+                common::int32_t Read(drivers::BlockDevice* device, common::uint64_t offset, common::uint8_t* buffer, common::uint32_t length);
+                common::int32_t Write(drivers::BlockDevice* device, common::uint64_t offset, common::uint8_t* buffer, common::uint32_t length);
+                common::uint32_t WriteBack(drivers::BlockDevice* device, bool all);
+                common::int32_t Sync(drivers::BlockDevice* device);
+
+                static void WriteBackThread();
+
+                common::uint32_t Hits();
+                common::uint32_t Misses();
+                common::uint32_t ReadAheads();
+                common::uint32_t WriteBacks();
+                common::uint32_t DirtyPages();
+        };
+
+    }
+
+}
+
+#endif //MAXOS_SYSTEM_PAGECACHE_H
@@ -0,0 +1,105 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#ifndef MAXOS_SYSTEM_PAGING_H
+#define MAXOS_SYSTEM_PAGING_H
+
+#include <common/types.h>
+
+namespace maxOS{
+
+    namespace system{
+
+        enum PageFlags{
+            PAGE_PRESENT    = 0x001,
+            PAGE_WRITABLE   = 0x002,
+            PAGE_USER       = 0x004,
+            PAGE_WRITE_THROUGH  = 0x008,
+            PAGE_CACHE_DISABLE  = 0x010,                        //For memory mapped device registers
+            PAGE_HUGE       = 0x080,                            //4MB page (page directory entries only)
+            PAGE_WRITE_COMBINING = 0x1000                       //MapPhysicalMemory only: the PAT bit of a 4MB page, PAT entry 4 is set to write-combining
+        };
+
+        //Address space layout: the kernel owns 0-1GB (identity mapped) and 3GB-4GB, processes own 1GB-3GB
+        static const common::uint32_t PAGE_SIZE = 4096;
+        static const common::uint32_t KERNEL_IDENTITY_END = 0x40000000;
+        static const common::uint32_t USER_SPACE_START = 0x40000000;
+        static const common::uint32_t USER_SPACE_END = 0xC0000000;
+
+        //The top of the identity mapped area is a window for device memory that can't be identity mapped because it is where user space is (e.g. PCIe ECAM at 0xB0000000 on q35)
+        static const common::uint32_t DEVICE_WINDOW_START = 0x38000000;
+        static const common::uint32_t DEVICE_WINDOW_END = 0x3F800000;
+
+        //The rest of it holds the kernel stacks of user threads, a slot per thread with the stack at the top and an unmapped guard below it
+        static const common::uint32_t KERNEL_STACKS_START = DEVICE_WINDOW_END;
+        static const common::uint32_t KERNEL_STACK_SLOT = 32 * 1024;
+        static const common::uint32_t KERNEL_STACK_SIZE = 16 * 1024;
+
+        typedef common::uint32_t PageDirectory[1024];
+
+        class PageManager{
+
+            protected:
+                PageDirectory* kernelDirectory;
+                PageDirectory* currentDirectory;
+
+                //Physical frames are handed out from a pool carved out of the heap, free frames store the next free frame in themselves
+                common::uint32_t poolStart;
+                common::uint32_t poolFrames;
+                common::uint32_t* freeFrames;
+                common::uint32_t numFreeFrames;
+                common::uint16_t* frameReferences;                  //How many mappings (or caches) use each pool frame
+
+                common::uint32_t deviceWindowNext;                  //The next free 4MB page of the device window
+                bool writeCombining;                                //The PAT is set up so PAGE_WRITE_COMBINING can be used
+
+                //Every address space has its own copy of the kernel part, changes to it have to go to all of them
+                static const int maxAddressSpaces = 64;
+                PageDirectory* addressSpaces[maxAddressSpaces];
+
+                void SetKernelEntry(common::uint32_t index, common::uint32_t entry);
+                bool SplitKernelEntry(common::uint32_t index);
+                bool MapKernelPages(common::uint32_t physicalAddress, common::uint32_t last, common::uint32_t flags);
+                void* MapDeviceWindow(common::uint32_t physicalAddress, common::uint32_t last, common::uint32_t flags);
+
+                common::uint32_t* GetPageTableEntry(PageDirectory* directory, common::uint32_t virtualAddress, bool create);
+
+            public:
+                static PageManager* activePageManager;
+
+                PageManager(common::size_t poolSize);
+                ~PageManager();
+
+                void* AllocateFrame();
+                void FreeFrame(void* frame);
+                void ShareFrame(void* frame);
+                common::uint32_t FrameReferences(void* frame);
+                common::uint32_t FreeFrames();
+
+                PageDirectory* KernelAddressSpace();
+                PageDirectory* CurrentAddressSpace();
+                PageDirectory* CreateAddressSpace();
+                void DestroyAddressSpace(PageDirectory* directory);
+                void SwitchAddressSpace(PageDirectory* directory);
+
+                bool Map(PageDirectory* directory, common::uint32_t virtualAddress, common::uint32_t physicalAddress, common::uint32_t flags);
+                void Unmap(PageDirectory* directory, common::uint32_t virtualAddress);
+                common::uint32_t Lookup(PageDirectory* directory, common::uint32_t virtualAddress);
+                common::uint32_t PhysicalAddress(common::uint32_t virtualAddress, bool write, PageDirectory* directory = 0);
+
+                void* AllocateKernelStack(int slot);
+
+                void* MapPhysicalMemory(common::uint32_t physicalAddress, common::uint32_t size, common::uint32_t flags);
+                bool SupportsWriteCombining();
+
+                static inline void FlushPage(common::uint32_t virtualAddress){
+                    asm volatile("invlpg (%0)" : : "r"(virtualAddress) : "memory");
+                }
+        };
+
+    }
+
+}
+
+#endif //MAXOS_SYSTEM_PAGING_H
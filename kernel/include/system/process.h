@@ -6,6 +6,9 @@
 #define MAXOS_PROCESS_H
 
 #include <system/multithreading.h>
+#include <system/paging.h>
+#include <system/elf.h>
+#include <hardwarecommunication/interrupts.h>
 #include <common/types.h>
 
 namespace maxOS{
@@ -14,31 +17,86 @@ namespace maxOS{
 
             class Process;
 
-
+            //Fixed places in every user address space
+            static const common::uint32_t USER_STACK_TOP = 0xBFFF0000;
+            static const common::uint32_t USER_STACK_SIZE = 64 * 1024;
+            static const common::uint32_t USER_VDSO_ADDRESS = 0xBFFFF000;
+            static const common::uint32_t USER_IORING_START = 0xBFE00000;     //IO ring queues, a window of USER_IORING_SIZE per ring
+            static const common::uint32_t USER_IORING_SIZE = 8 * 4096;
+
+            /**
+             * @details A range of user memory, pages are only mapped once they are touched
+             */
+            struct MemoryRegion{
+                common::uint32_t start;
+                common::uint32_t end;
+                bool writable;
+                common::uint8_t* file;                      //File to fill the region from (0 for zeroed memory)
+                common::uint32_t fileSize;
+                common::uint32_t offset;                    //Where the region's data starts in the file
+                common::uint32_t sourceSize;                //Bytes of file data, the rest of the region is zeroed
+            };
 
             class Process{
                 friend class ProcessManager;
                 private:
+                    static common::pid_t nextPID;
+
                     ThreadManager* threadManager;
+                    common::pid_t pid;
                     int mainThreadID;
                     int childThreads[6];
                     int numChildThreads = 0;
 
+                    PageDirectory* addressSpace;            //0 for kernel processes
+                    MemoryRegion regions[8];
+                    int numRegions = 0;
+
                 public:
                     void CreateChildThread(void entrypoint());
                     void KillChildThread(int threadID);
                     void KillAllChildThreads();
                     void RefreshProcess();
                     void Kill();
+                    common::pid_t GetPID();
 
                     void threadMain(void entrypoint(), Process* process);
 
-
+                    PageDirectory* AddressSpace();
+                    bool AddRegion(common::uint32_t start, common::uint32_t size, bool writable, common::uint8_t* file = 0, common::uint32_t fileSize = 0, common::uint32_t offset = 0, common::uint32_t sourceSize = 0);
+                    bool HandlePageFault(common::uint32_t address, common::uint32_t error);
+                    bool IsUserMemory(common::uint32_t address, common::uint32_t length, bool write);
+                    bool FaultIn(common::uint32_t address, common::uint32_t length, bool write);
 
                     Process(void entrypoint(), ThreadManager* threadManager);
+                    Process(ElfLoader* executable, ThreadManager* threadManager);
                     ~Process();
             };
 
+            class ProcessManager : public hardwarecommunication::InterruptHandler{
+
+                protected:
+                    static const int maxProcesses = 64;
+                    Process* processes[maxProcesses];
+                    ThreadManager* threadManager;
+
+                public:
+                    static ProcessManager* activeProcessManager;
+
+                    ProcessManager(hardwarecommunication::InterruptManager* interruptManager, ThreadManager* threadManager);
+                    ~ProcessManager();
+
+                    bool AddProcess(Process* process);
+                    void RemoveProcess(Process* process);
+                    Process* GetProcess(common::pid_t pid);
+                    Process* CurrentProcess();
+
+                    Process* Spawn(common::uint8_t* image, common::uint32_t size);
+                    common::uint32_t Exit(common::uint32_t esp);
+
+                    common::uint32_t HandleInterrupt(common::uint32_t esp);
+            };
+
     }
 
 
@@ -0,0 +1,70 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#ifndef MAXOS_SYSTEM_PROFILER_H
+#define MAXOS_SYSTEM_PROFILER_H
+
+#include <common/types.h>
+#include <system/multithreading.h>
+#include <hardwarecommunication/serial.h>
+
+namespace maxOS{
+
+    namespace system{
+
+        static const int PROFILER_MAX_DEPTH = 8;           //Return addresses kept per sample
+        static const int PROFILER_MAX_CPUS = 4;
+        static const int PROFILER_SAMPLES_PER_CPU = 4096;
+
+        struct ProfileSample{
+            common::uint32_t eip;
+            common::uint32_t callers[PROFILER_MAX_DEPTH];  //Innermost first, found by following the saved frame pointers
+            common::uint8_t depth;
+            bool user;                                      //Interrupted a user process, its stack isn't walked
+        };
+
+        //Each CPU only writes its own buffer, from its own timer interrupt, so no locking is needed
+        struct ProfileBuffer{
+            ProfileSample* samples;
+            common::uint32_t count;                         //Kept samples, sampling stops for this CPU once it is full
+            common::uint32_t dropped;
+        };
+
+        /**
+         * @details Samples where the timer interrupt finds the CPU, to see where kernel time goes
+         */
+        class Profiler{
+
+            protected:
+                ProfileBuffer buffers[PROFILER_MAX_CPUS];
+                bool running;
+
+                static int CurrentCPU();
+                static bool ValidFrame(common::uint32_t frame);
+                common::uint32_t* CountSymbols(bool inclusive);
+
+            public:
+                static Profiler* activeProfiler;
+
+                Profiler();
+                ~Profiler();
+
+                void Start();
+                void Stop();
+                void Reset();
+                bool IsRunning();
+                common::uint32_t Samples();
+
+                void Sample(CPUState_Thread* state);
+
+                void DumpFlat(hardwarecommunication::serial* log);
+                void DumpCallGraph(hardwarecommunication::serial* log);
+                void DumpFoldedStacks(hardwarecommunication::serial* log);
+        };
+
+    }
+
+}
+
+#endif //MAXOS_SYSTEM_PROFILER_H
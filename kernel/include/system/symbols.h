@@ -0,0 +1,36 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#ifndef MAXOS_SYSTEM_SYMBOLS_H
+#define MAXOS_SYSTEM_SYMBOLS_H
+
+#include <common/types.h>
+
+namespace maxOS{
+
+    namespace system{
+
+        //One function of the kernel image, the table is generated from maxOS.bin at link time (toolchain/symbols.sh)
+        struct KernelSymbol{
+            common::uint32_t address;
+            char* name;
+        } __attribute__((packed));
+
+        /**
+         * @details Turns addresses in the kernel back into function names
+         */
+        class KernelSymbols{
+
+            public:
+                static common::uint32_t Count();
+                static KernelSymbol* Get(common::uint32_t index);
+                static int Find(common::uint32_t address);
+                static char* Name(common::uint32_t address);
+        };
+
+    }
+
+}
+
+#endif //MAXOS_SYSTEM_SYMBOLS_H
@@ -0,0 +1,114 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#ifndef MAXOS_SYSTEM_TRACE_H
+#define MAXOS_SYSTEM_TRACE_H
+
+#include <common/types.h>
+#include <hardwarecommunication/serial.h>
+
+namespace maxOS{
+
+    namespace system{
+
+        enum TracePhase{
+            TRACE_INSTANT,
+            TRACE_BEGIN,                                    //Starts a span, ended by the next TRACE_END of the same name on the same CPU
+            TRACE_END
+        };
+
+        //Every tracepoint in the kernel: EVENT(id, phase, name, first argument, second argument). Adding a line here
+        //is all that is needed to register an event, the decoder learns the names from the drain thread
+        #define MAXOS_TRACE_EVENTS(EVENT) \
+            EVENT(INTERRUPT_ENTER,  TRACE_BEGIN,    "interrupt",        "vector",   "pid")      \
+            EVENT(INTERRUPT_EXIT,   TRACE_END,      "interrupt",        "vector",   "pid")      \
+            EVENT(CONTEXT_SWITCH,   TRACE_INSTANT,  "context switch",   "from tid", "to tid")   \
+            EVENT(PAGE_FAULT,       TRACE_INSTANT,  "page fault",       "address",  "error")    \
+            EVENT(PACKET_SEND,      TRACE_INSTANT,  "packet send",      "size",     "buffer")   \
+            EVENT(PACKET_RECEIVE,   TRACE_INSTANT,  "packet receive",   "size",     "buffer")
+
+        #define MAXOS_TRACE_ENUM(id, phase, name, argument0, argument1) TRACE_##id,
+        enum TraceEvent{
+            MAXOS_TRACE_EVENTS(MAXOS_TRACE_ENUM)
+            TRACE_NUM_EVENTS
+        };
+        #undef MAXOS_TRACE_ENUM
+
+        struct TraceEventDescription{
+            TracePhase phase;
+            char* name;
+            char* arguments[2];
+        };
+
+        //What the drain thread sends, the timestamp is in TSC ticks
+        struct TraceRecord{
+            common::uint64_t timestamp;
+            common::uint16_t event;
+            common::uint16_t pid;
+            common::uint32_t arguments[2];
+            volatile common::uint32_t sequence;             //Written last: the slot number + 1 once the record is complete
+        } __attribute__((packed));
+
+        static const int TRACE_MAX_CPUS = 4;
+        static const common::uint32_t TRACE_RECORDS_PER_CPU = 1024;
+
+        //Only the running CPU adds to its ring (reserving a slot with a compare and swap so a nested interrupt can't take the same one),
+        //the drain thread is the only one taking records out
+        struct TraceRing{
+            TraceRecord* records;
+            volatile common::uint32_t head;                 //Next slot to reserve
+            volatile common::uint32_t tail;                 //Next slot to drain
+            volatile common::uint32_t dropped;              //Records lost because the ring was full
+        };
+
+        //Frame types on the serial port, see toolchain/trace2chrome.py
+        enum TraceFrameType{
+            TRACE_FRAME_DESCRIPTION = 0,
+            TRACE_FRAME_CLOCK = 1,
+            TRACE_FRAME_RECORDS = 2,
+            TRACE_FRAME_DROPPED = 3
+        };
+
+        /**
+         * @details Static tracepoints recorded as fixed size binary records, sent over serial in batches by a kernel thread
+         */
+        class Tracer{
+
+            protected:
+                TraceRing rings[TRACE_MAX_CPUS];
+                volatile common::uint32_t enabledEvents;    //Bit per TraceEvent
+                common::uint32_t reportedDropped[TRACE_MAX_CPUS];
+                bool describedEvents;
+
+                static int CurrentCPU();
+                void WriteFrame(hardwarecommunication::serial* log, common::uint8_t type, common::uint8_t cpu, common::uint8_t* payload, common::uint16_t length);
+                void DescribeEvents(hardwarecommunication::serial* log);
+                common::uint32_t DrainRing(hardwarecommunication::serial* log, int cpu);
+
+            public:
+                static Tracer* activeTracer;
+                static const TraceEventDescription events[TRACE_NUM_EVENTS];
+
+                Tracer();
+                ~Tracer();
+
+                void Enable(common::uint32_t eventMask);
+                common::uint32_t EnabledEvents();
+
+                void Record(TraceEvent event, common::uint32_t argument0, common::uint32_t argument1);
+                common::uint32_t Drain(hardwarecommunication::serial* log);
+                static void Drainer();
+
+                //Called from hot paths, so the check of whether anything is listening is inlined
+                static inline void Trace(TraceEvent event, common::uint32_t argument0 = 0, common::uint32_t argument1 = 0){
+                    if(activeTracer != 0 && (activeTracer -> enabledEvents & (1 << event)))
+                        activeTracer -> Record(event, argument0, argument1);
+                }
+        };
+
+    }
+
+}
+
+#endif //MAXOS_SYSTEM_TRACE_H
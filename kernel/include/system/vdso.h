@@ -0,0 +1,51 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#ifndef MAXOS_SYSTEM_VDSO_H
+#define MAXOS_SYSTEM_VDSO_H
+
+#include <common/types.h>
+
+namespace maxOS{
+
+    namespace system{
+
+        //The layout of the shared page, this is ABI so only ever append to it
+        struct VDSOData{
+
+            volatile common::uint32_t sequence;         //Odd while the kernel is writing, readers retry until it is even and unchanged
+
+            //Clock (see Clock::Update)
+            common::uint32_t mult;                      //ns = ((tsc - tscBase) * mult) >> shift
+            common::uint32_t shift;
+            common::uint64_t tscBase;                   //TSC value that seconds/nanoseconds were taken at
+            common::uint32_t seconds;                   //Monotonic seconds since boot
+            common::uint32_t nanoseconds;
+            common::uint32_t bootTime;                  //Unix time at boot, added for CLOCK_REALTIME
+
+            //Identity of the running process
+            common::pid_t pid;
+
+        } __attribute__((packed));
+
+        class VirtualDynamicSharedObject{
+
+            protected:
+                static VDSOData page;                   //Alone in the .vdso_data page (see linker.ld), user space can read all of that page
+
+                static void BeginWrite();
+                static void EndWrite();
+
+            public:
+                static VDSOData* Page();
+
+                static void UpdateClock(common::uint32_t mult, common::uint32_t shift, common::uint64_t tscBase, common::uint32_t seconds, common::uint32_t nanoseconds, common::uint32_t bootTime);
+                static void SetProcess(common::pid_t pid);
+        };
+
+    }
+
+}
+
+#endif //MAXOS_SYSTEM_VDSO_H
@@ -0,0 +1,822 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#include <drivers/ahci.h>
+#include <system/paging.h>
+
+using namespace maxOS;
+using namespace maxOS::common;
+using namespace maxOS::hardwarecommunication;
+using namespace maxOS::drivers;
+using namespace maxOS::system;
+
+void printf(char* str, bool clearLine = false); // Forward declaration
+void printfHex(uint8_t key);                    // Forward declaration
+
+//HBA registers, as offsets from the start of BAR 5
+enum AHCIRegister{
+    AHCI_CAPABILITIES = 0x00,
+    AHCI_GLOBAL_CONTROL = 0x04,
+    AHCI_INTERRUPT_STATUS = 0x08,
+    AHCI_PORTS_IMPLEMENTED = 0x0C,
+    AHCI_CAPABILITIES_EXTENDED = 0x24,
+    AHCI_BIOS_HANDOFF = 0x28,
+    AHCI_PORTS = 0x100
+};
+
+static const uint32_t portSize = 0x80;
+static const uint32_t spinLimit = 1000000;                 //Register reads to wait for the hardware, about a second
+
+/**
+ * @details Copy a string out of the IDENTIFY data, the bytes of each word are swapped and it is padded with spaces
+ * @param words The IDENTIFY data
+ * @param first The first word of the string
+ * @param numWords How many words it takes
+ * @param string Where to put it, needs numWords * 2 + 1 bytes
+ */
+static void CopyIdentityString(uint16_t* words, int first, int numWords, char* string){
+
+    for(int i = 0; i < numWords; ++i){
+        string[i * 2] = words[first + i] >> 8;
+        string[i * 2 + 1] = words[first + i] & 0xFF;
+    }
+
+    int length = numWords * 2;
+    while(length > 0 && string[length - 1] == ' ')
+        length--;
+    string[length] = '\0';
+
+}
+
+/**
+ * @details Get a zeroed frame for structures the HBA reads, frames are identity mapped so the address is also the physical one
+ * @return The frame, 0 if there is no memory left
+ */
+static uint8_t* AllocateZeroedFrame(){
+
+    uint8_t* frame = (uint8_t*)PageManager::activePageManager -> AllocateFrame();
+    if(frame == 0)
+        return 0;
+
+    for(uint32_t i = 0; i < PAGE_SIZE; ++i)
+        frame[i] = 0;
+
+    return frame;
+}
+
+/**
+ * @details Describe a buffer in a command's descriptor table, a page at a time and merging physically contiguous pages
+ * @param table The command table
+ * @param numRegions The descriptors already in the table, updated
+ * @param buffer The buffer, it has to be word aligned
+ * @param length Bytes of it to describe
+ * @param toMemory True if the device writes to the buffer
+ * @return The amount of bytes described, less than the length if the table filled up, -1 if the buffer can't be used for DMA
+ */
+static int32_t AddRegions(AHCICommandTable* table, int* numRegions, uint8_t* buffer, uint32_t length, bool toMemory){
+
+    if((uint32_t)buffer & 0x1)
+        return -1;
+
+    uint32_t added = 0;
+    uint32_t virtualAddress = (uint32_t)buffer;
+    while(added < length){
+
+        uint32_t physicalAddress = PageManager::activePageManager -> PhysicalAddress(virtualAddress, toMemory);
+        if(physicalAddress == 0)
+            return -1;
+
+        uint32_t chunk = PAGE_SIZE - (virtualAddress & (PAGE_SIZE - 1));
+        if(chunk > length - added)
+            chunk = length - added;
+
+        //A descriptor holds up to 4MB, the byte count is stored minus one
+        AHCIPhysicalRegionDescriptor* last = *numRegions == 0 ? 0 : &table -> regions[*numRegions - 1];
+        uint32_t lastSize = last == 0 ? 0 : (last -> byteCount & 0x3FFFFF) + 1;
+        if(last != 0 && last -> address + lastSize == physicalAddress && lastSize + chunk <= 0x400000){
+            last -> byteCount = lastSize + chunk - 1;
+        }
+        else
+        {
+            if(*numRegions >= AHCI_MAX_REGIONS)
+                break;
+
+            AHCIPhysicalRegionDescriptor* region = &table -> regions[*numRegions];
+            region -> address = physicalAddress;
+            region -> addressUpper = 0;
+            region -> reserved = 0;
+            region -> byteCount = chunk - 1;
+            (*numRegions)++;
+        }
+
+        virtualAddress += chunk;
+        added += chunk;
+    }
+
+    return added;
+}
+
+///__PORT__
+
+AdvancedHostControllerInterfacePort::AdvancedHostControllerInterfacePort(volatile uint32_t* registers, int index, uint32_t numSlots) {
+
+    this -> registers = registers;
+    this -> index = index;
+    this -> numSlots = numSlots > (uint32_t)maxSlots ? maxSlots : numSlots;
+
+    commandList = 0;
+    receivedFIS = 0;
+    for(int i = 0; i < maxSlots; ++i){
+        tables[i] = 0;
+        slotRequests[i] = 0;
+        slotDone[i] = 0;
+        slotChunk[i] = 0;
+    }
+    busySlots = 0;
+    issuedSlots = 0;
+
+    present = false;
+    identity.model[0] = '\0';
+    identity.sectors = 0;
+    identity.lba48 = false;
+    identity.ncq = false;
+    identity.queueDepth = 1;
+
+}
+
+AdvancedHostControllerInterfacePort::~AdvancedHostControllerInterfacePort() {
+
+    if(commandList != 0)
+        StopEngine();
+
+    if(PageManager::activePageManager == 0)
+        return;
+
+    if(commandList != 0)
+        PageManager::activePageManager -> FreeFrame(commandList);
+    for(int i = 0; i < maxSlots; ++i)
+        if(tables[i] != 0)
+            PageManager::activePageManager -> FreeFrame(tables[i]);
+
+}
+
+/**
+ * @details Read one of the port's registers
+ * @param reg The register (AHCIPortRegister)
+ * @return Its value
+ */
+uint32_t AdvancedHostControllerInterfacePort::Read(uint32_t reg) {
+
+    return registers[reg >> 2];
+
+}
+
+/**
+ * @details Write one of the port's registers
+ * @param reg The register (AHCIPortRegister)
+ * @param value The value to write
+ */
+void AdvancedHostControllerInterfacePort::Write(uint32_t reg, uint32_t value) {
+
+    registers[reg >> 2] = value;
+
+}
+
+/**
+ * @details Let the port receive FISes and run the command list
+ */
+void AdvancedHostControllerInterfacePort::StartEngine() {
+
+    for(uint32_t i = 0; i < spinLimit && (Read(AHCI_PORT_COMMAND) & AHCI_PORT_LIST_RUNNING); ++i);
+
+    Write(AHCI_PORT_COMMAND, Read(AHCI_PORT_COMMAND) | AHCI_PORT_FIS_RECEIVE);
+    Write(AHCI_PORT_COMMAND, Read(AHCI_PORT_COMMAND) | AHCI_PORT_START);
+
+}
+
+/**
+ * @details Stop the port running commands and receiving FISes, everything issued is dropped
+ * @return False if the HBA didn't stop it in time
+ */
+bool AdvancedHostControllerInterfacePort::StopEngine() {
+
+    Write(AHCI_PORT_COMMAND, Read(AHCI_PORT_COMMAND) & ~AHCI_PORT_START);
+    for(uint32_t i = 0; i < spinLimit && (Read(AHCI_PORT_COMMAND) & AHCI_PORT_LIST_RUNNING); ++i);
+
+    Write(AHCI_PORT_COMMAND, Read(AHCI_PORT_COMMAND) & ~AHCI_PORT_FIS_RECEIVE);
+    for(uint32_t i = 0; i < spinLimit && (Read(AHCI_PORT_COMMAND) & AHCI_PORT_FIS_RUNNING); ++i);
+
+    return !(Read(AHCI_PORT_COMMAND) & (AHCI_PORT_LIST_RUNNING | AHCI_PORT_FIS_RUNNING));
+}
+
+/**
+ * @details Give the port its command list, received FIS area and a command table per slot, then start it if a SATA disk is attached
+ * @return True if there is a disk on the port
+ */
+bool AdvancedHostControllerInterfacePort::Initialize() {
+
+    if(PageManager::activePageManager == 0 || !StopEngine())
+        return false;
+
+    //The command list (32 headers, 1KB) and the received FIS area (256 bytes) share a frame
+    uint8_t* frame = AllocateZeroedFrame();
+    if(frame == 0)
+        return false;
+    commandList = (AHCICommandHeader*)frame;
+    receivedFIS = frame + 1024;
+
+    for(uint32_t slot = 0; slot < numSlots; ++slot){
+
+        tables[slot] = (AHCICommandTable*)AllocateZeroedFrame();
+        if(tables[slot] == 0)
+            return false;
+
+        commandList[slot].table = (uint32_t)tables[slot];
+        commandList[slot].tableUpper = 0;
+    }
+
+    Write(AHCI_PORT_COMMAND_LIST, (uint32_t)commandList);
+    Write(AHCI_PORT_COMMAND_LIST_UPPER, 0);
+    Write(AHCI_PORT_FIS, (uint32_t)receivedFIS);
+    Write(AHCI_PORT_FIS_UPPER, 0);
+
+    Write(AHCI_PORT_SATA_ERROR, 0xFFFFFFFF);
+    Write(AHCI_PORT_INTERRUPT_STATUS, 0xFFFFFFFF);
+
+    //Spin up and power on the device (bits 1, 2) in case staggered spin up left it off
+    Write(AHCI_PORT_COMMAND, Read(AHCI_PORT_COMMAND) | (1 << 1) | (1 << 2) | AHCI_PORT_FIS_RECEIVE);
+
+    //SATA status bits 0-3: 3 means a device is there and the link is up
+    uint32_t i = 0;
+    while(i < spinLimit && (Read(AHCI_PORT_SATA_STATUS) & 0xF) != 3)
+        i++;
+    if((Read(AHCI_PORT_SATA_STATUS) & 0xF) != 3)
+        return false;
+
+    //The signature comes with the device's first FIS, only disks are handled (ATAPI is 0xEB140101)
+    for(i = 0; i < spinLimit && (Read(AHCI_PORT_TASK_FILE) & (ATA_STATUS_BUSY | ATA_STATUS_DATA_REQUEST)); ++i);
+    if(Read(AHCI_PORT_SIGNATURE) != 0x00000101)
+        return false;
+
+    Write(AHCI_PORT_SATA_ERROR, 0xFFFFFFFF);
+    Write(AHCI_PORT_INTERRUPT_STATUS, 0xFFFFFFFF);
+    StartEngine();
+    return true;
+}
+
+/**
+ * @details Fill in a slot's command FIS and header. Queued commands carry the count in the features and the tag in the count
+ * @param slot The command slot
+ * @param command The ATA command
+ * @param lba The first sector
+ * @param count The amount of sectors (the maximum is written as 0)
+ * @param write True if data goes to the device
+ * @param numRegions The descriptors in the slot's table
+ */
+void AdvancedHostControllerInterfacePort::BuildCommand(int slot, uint8_t command, uint64_t lba, uint32_t count, bool write, int numRegions) {
+
+    AHCIRegisterFIS* fis = (AHCIRegisterFIS*)tables[slot] -> commandFIS;
+    uint8_t* bytes = (uint8_t*)fis;
+    for(uint32_t i = 0; i < sizeof(AHCIRegisterFIS); ++i)
+        bytes[i] = 0;
+
+    fis -> type = 0x27;
+    fis -> flags = 0x80;
+    fis -> command = command;
+    fis -> lba0 = lba & 0xFF;
+    fis -> lba1 = (lba >> 8) & 0xFF;
+    fis -> lba2 = (lba >> 16) & 0xFF;
+
+    switch (command) {
+
+        case ATA_READ_FPDMA_QUEUED:
+        case ATA_WRITE_FPDMA_QUEUED:
+            fis -> lba3 = (lba >> 24) & 0xFF;
+            fis -> lba4 = (lba >> 32) & 0xFF;
+            fis -> lba5 = (lba >> 40) & 0xFF;
+            fis -> featureLow = count & 0xFF;
+            fis -> featureHigh = (count >> 8) & 0xFF;
+            fis -> countLow = slot << 3;
+            fis -> device = 0x40;
+            break;
+
+        case ATA_READ_DMA_EXT:
+        case ATA_WRITE_DMA_EXT:
+            fis -> lba3 = (lba >> 24) & 0xFF;
+            fis -> lba4 = (lba >> 32) & 0xFF;
+            fis -> lba5 = (lba >> 40) & 0xFF;
+            fis -> countLow = count & 0xFF;
+            fis -> countHigh = (count >> 8) & 0xFF;
+            fis -> device = 0x40;
+            break;
+
+        case ATA_READ_DMA:
+        case ATA_WRITE_DMA:
+            fis -> countLow = count & 0xFF;
+            fis -> device = 0x40 | ((lba >> 24) & 0x0F);
+            break;
+
+        default:
+            break;
+    }
+
+    //Header flags: the FIS length in dwords, bit 6 if it writes
+    AHCICommandHeader* header = &commandList[slot];
+    header -> flags = (sizeof(AHCIRegisterFIS) / 4) | (write ? (1 << 6) : 0);
+    header -> numRegions = numRegions;
+    header -> bytesTransferred = 0;
+
+}
+
+/**
+ * @details Hand a built command to the HBA, queued commands are marked active first so the device's completion bits can clear them
+ * @param slot The command slot
+ * @param queued True if it is an FPDMA command
+ */
+void AdvancedHostControllerInterfacePort::Issue(int slot, bool queued) {
+
+    //The table has to be in memory before the HBA is told about it
+    asm volatile("" : : : "memory");
+
+    issuedSlots |= 1 << slot;
+    if(queued)
+        Write(AHCI_PORT_SATA_ACTIVE, 1 << slot);
+    Write(AHCI_PORT_COMMAND_ISSUE, 1 << slot);
+
+}
+
+/**
+ * @details Describe the part of a slot's request that hasn't been moved yet in its table, a request too scattered for one table is cut to whole sectors
+ * @param slot The command slot
+ * @param request The request
+ * @return The amount of descriptors, -1 if a buffer can't be used for DMA. The sectors they cover are put in slotChunk
+ */
+int AdvancedHostControllerInterfacePort::BuildRegions(int slot, BlockRequest* request) {
+
+    AHCICommandTable* table = tables[slot];
+    bool toMemory = request -> operation == BLOCK_READ;
+
+    uint32_t skip = slotDone[slot];
+    uint32_t remaining = request -> count - skip;
+    uint32_t bytes = 0;
+    int numRegions = 0;
+
+    for(BlockIO* io = request -> head; io != 0 && remaining > 0; io = io == request -> tail ? 0 : io -> next){
+
+        if(io -> count <= skip){
+            skip -= io -> count;
+            continue;
+        }
+
+        uint32_t sectors = io -> count - skip;
+        if(sectors > remaining)
+            sectors = remaining;
+
+        uint32_t length = sectors * limits.sectorSize;
+        int32_t added = AddRegions(table, &numRegions, io -> buffer + skip * limits.sectorSize, length, toMemory);
+        if(added < 0)
+            return -1;
+
+        bytes += added;
+        remaining -= sectors;
+        skip = 0;
+
+        if((uint32_t)added < length)
+            break;
+    }
+
+    //Only whole sectors can be moved, give back the part of the last one that didn't fit
+    uint32_t excess = bytes % limits.sectorSize;
+    bytes -= excess;
+    while(excess > 0 && numRegions > 0){
+
+        AHCIPhysicalRegionDescriptor* last = &table -> regions[numRegions - 1];
+        uint32_t size = (last -> byteCount & 0x3FFFFF) + 1;
+        if(size > excess){
+            last -> byteCount = size - excess - 1;
+            break;
+        }
+
+        excess -= size;
+        numRegions--;
+    }
+
+    if(bytes == 0)
+        return -1;
+
+    slotChunk[slot] = bytes / limits.sectorSize;
+    return numRegions;
+}
+
+/**
+ * @details Send the next command of a slot's request: the flush, or as much of the transfer as one table can describe
+ * @param slot The command slot
+ * @return True if a command was issued, false if it couldn't be
+ */
+bool AdvancedHostControllerInterfacePort::IssueNext(int slot) {
+
+    BlockRequest* request = slotRequests[slot];
+
+    if(request -> operation == BLOCK_FLUSH){
+        slotChunk[slot] = 0;
+        BuildCommand(slot, identity.lba48 ? ATA_FLUSH_CACHE_EXT : ATA_FLUSH_CACHE, 0, 0, false, 0);
+        Issue(slot, false);
+        return true;
+    }
+
+    int numRegions = BuildRegions(slot, request);
+    if(numRegions < 0)
+        return false;
+
+    bool write = request -> operation == BLOCK_WRITE;
+    uint64_t lba = request -> sector + slotDone[slot];
+
+    uint8_t command;
+    if(identity.ncq)
+        command = write ? ATA_WRITE_FPDMA_QUEUED : ATA_READ_FPDMA_QUEUED;
+    else if(identity.lba48)
+        command = write ? ATA_WRITE_DMA_EXT : ATA_READ_DMA_EXT;
+    else
+        command = write ? ATA_WRITE_DMA : ATA_READ_DMA;
+
+    BuildCommand(slot, command, lba, slotChunk[slot], write, numRegions);
+    Issue(slot, identity.ncq);
+    return true;
+}
+
+/**
+ * @details A slot's command finished: send the rest of its request, or complete it
+ * @param slot The command slot
+ */
+void AdvancedHostControllerInterfacePort::Advance(int slot) {
+
+    BlockRequest* request = slotRequests[slot];
+
+    if(request -> operation != BLOCK_FLUSH){
+
+        slotDone[slot] += slotChunk[slot];
+        slotChunk[slot] = 0;
+
+        if(slotDone[slot] < request -> count && IssueNext(slot))
+            return;
+    }
+
+    Finish(slot, request -> operation != BLOCK_FLUSH && slotDone[slot] < request -> count);
+
+}
+
+/**
+ * @details Free a slot and give its request back to the block layer, which may start the next one in it straight away
+ * @param slot The command slot
+ * @param failed True if the request didn't complete, the sectors moved before the failure still count
+ */
+void AdvancedHostControllerInterfacePort::Finish(int slot, bool failed) {
+
+    BlockRequest* request = slotRequests[slot];
+    slotRequests[slot] = 0;
+    busySlots &= ~(1 << slot);
+    issuedSlots &= ~(1 << slot);
+
+    int result = request -> operation == BLOCK_FLUSH ? 0 : (int)slotDone[slot];
+    if(failed && (request -> operation == BLOCK_FLUSH || slotDone[slot] == 0))
+        result = -1;
+
+    Complete(request, result);
+
+}
+
+/**
+ * @details Get the port going again after an error. The device aborts every queued command when one fails, so whatever hadn't finished is failed
+ */
+void AdvancedHostControllerInterfacePort::Recover() {
+
+    uint32_t pending = issuedSlots & (Read(AHCI_PORT_SATA_ACTIVE) | Read(AHCI_PORT_COMMAND_ISSUE));
+    uint32_t finished = issuedSlots & ~pending;
+
+    StopEngine();
+    Write(AHCI_PORT_SATA_ERROR, 0xFFFFFFFF);
+    Write(AHCI_PORT_INTERRUPT_STATUS, 0xFFFFFFFF);
+
+    //A device still busy needs a COMRESET (SATA control bits 0-3 = 1, held for at least 1ms) before it takes commands again
+    if(Read(AHCI_PORT_TASK_FILE) & (ATA_STATUS_BUSY | ATA_STATUS_DATA_REQUEST)){
+
+        Write(AHCI_PORT_SATA_CONTROL, (Read(AHCI_PORT_SATA_CONTROL) & ~0xF) | 1);
+        for(uint32_t i = 0; i < spinLimit; ++i)
+            Read(AHCI_PORT_SATA_STATUS);
+        Write(AHCI_PORT_SATA_CONTROL, Read(AHCI_PORT_SATA_CONTROL) & ~0xF);
+
+        for(uint32_t i = 0; i < spinLimit && (Read(AHCI_PORT_SATA_STATUS) & 0xF) != 3; ++i);
+        Write(AHCI_PORT_SATA_ERROR, 0xFFFFFFFF);
+    }
+
+    StartEngine();
+    issuedSlots = 0;
+
+    for(int slot = 0; slot < maxSlots; ++slot){
+
+        if(finished & (1 << slot))
+            Advance(slot);
+        else if(pending & (1 << slot))
+            Finish(slot, true);
+    }
+
+}
+
+/**
+ * @details Find out what the HBA finished: every issued slot that is neither active nor issued any more is done
+ */
+void AdvancedHostControllerInterfacePort::Service() {
+
+    if(!present)
+        return;
+
+    uint32_t status = Read(AHCI_PORT_INTERRUPT_STATUS);
+    Write(AHCI_PORT_INTERRUPT_STATUS, status);
+
+    if(status & AHCI_INTERRUPT_ERRORS){
+        statistics.errors++;
+        Recover();
+        return;
+    }
+
+    uint32_t finished = issuedSlots & ~(Read(AHCI_PORT_SATA_ACTIVE) | Read(AHCI_PORT_COMMAND_ISSUE));
+    for(int slot = 0; slot < maxSlots && finished != 0; ++slot){
+
+        if(!(finished & (1 << slot)))
+            continue;
+
+        finished &= ~(1 << slot);
+        issuedSlots &= ~(1 << slot);
+        Advance(slot);
+    }
+
+}
+
+/**
+ * @details Put a request of the block layer in a free command slot
+ * @param request The request
+ */
+void AdvancedHostControllerInterfacePort::StartRequest(BlockRequest* request) {
+
+    //The block layer never has more than maxDepth requests out, so there is always a free slot
+    int slot = -1;
+    for(uint32_t i = 0; i < numSlots && slot < 0; ++i)
+        if(!(busySlots & (1 << i)))
+            slot = i;
+
+    if(!present || slot < 0){
+        Complete(request, -1);
+        return;
+    }
+
+    busySlots |= 1 << slot;
+    slotRequests[slot] = request;
+    slotDone[slot] = 0;
+    slotChunk[slot] = 0;
+
+    if(!IssueNext(slot))
+        Finish(slot, true);
+
+}
+
+/**
+ * @details Check the port for completions, for waits while interrupts are off
+ */
+void AdvancedHostControllerInterfacePort::Poll() {
+
+    Service();
+
+}
+
+/**
+ * @details Run IDENTIFY DEVICE in slot 0 and wait for it, interrupts for the port aren't on yet
+ * @return True if the device answered
+ */
+bool AdvancedHostControllerInterfacePort::Identify() {
+
+    present = false;
+    if(commandList == 0)
+        return false;
+
+    uint16_t data[256];
+    int numRegions = 0;
+    if(AddRegions(tables[0], &numRegions, (uint8_t*)data, sizeof(data), true) != sizeof(data))
+        return false;
+
+    BuildCommand(0, ATA_IDENTIFY, 0, 0, false, numRegions);
+    Write(AHCI_PORT_INTERRUPT_STATUS, 0xFFFFFFFF);
+    asm volatile("" : : : "memory");
+    Write(AHCI_PORT_COMMAND_ISSUE, 1);
+
+    for(uint32_t i = 0; i < spinLimit && (Read(AHCI_PORT_COMMAND_ISSUE) & 1) && !(Read(AHCI_PORT_INTERRUPT_STATUS) & AHCI_INTERRUPT_ERRORS); ++i);
+
+    bool failed = (Read(AHCI_PORT_COMMAND_ISSUE) & 1) || (Read(AHCI_PORT_INTERRUPT_STATUS) & AHCI_INTERRUPT_ERRORS) || (Read(AHCI_PORT_TASK_FILE) & ATA_STATUS_ERROR);
+    Write(AHCI_PORT_INTERRUPT_STATUS, 0xFFFFFFFF);
+    if(failed){
+        StopEngine();
+        Write(AHCI_PORT_SATA_ERROR, 0xFFFFFFFF);
+        StartEngine();
+        return false;
+    }
+
+    CopyIdentityString(data, 27, 20, identity.model);
+
+    //Word 83 bit 10 says if the 48 bit feature set is there, its capacity is in words 100-103 instead of 60-61
+    identity.lba48 = data[83] & (1 << 10);
+    identity.sectors = data[60] | ((uint32_t)data[61] << 16);
+    if(identity.lba48)
+        identity.sectors = data[100] | ((uint32_t)data[101] << 16) | ((uint64_t)data[102] << 32) | ((uint64_t)data[103] << 48);
+
+    //Word 76 bit 8: native command queuing, word 75 bits 0-4: the queue depth minus one
+    identity.ncq = identity.lba48 && (data[76] & (1 << 8));
+    identity.queueDepth = identity.ncq ? (data[75] & 0x1F) + 1 : 1;
+
+    present = true;
+    capacity = identity.sectors;
+    limits.maxSectors = identity.lba48 ? 1024 : 256;
+    limits.maxDepth = identity.queueDepth < numSlots ? identity.queueDepth : numSlots;
+
+    return true;
+}
+
+/**
+ * @details Check if there is a disk on the port
+ * @return True if Identify found one
+ */
+bool AdvancedHostControllerInterfacePort::IsPresent() {
+    return present;
+}
+
+/**
+ * @details Get what IDENTIFY said about the disk
+ * @return The parsed IDENTIFY data, only valid if the disk is present
+ */
+AHCIIdentity* AdvancedHostControllerInterfacePort::Identity() {
+    return &identity;
+}
+
+///__CONTROLLER__
+
+AdvancedHostControllerInterface* AdvancedHostControllerInterface::activeController = 0;
+
+static const PeripheralComponentInterconnectDeviceID ahciIDs[] = {
+    { PCI_VENDOR_ANY, PCI_VENDOR_ANY, 0x010601, 0xFFFFFF },    //Mass storage, SATA, AHCI 1.0
+};
+
+/**
+ * @details Create the driver for a matching PCI device, using MSI if the controller has it
+ * @param dev The device descriptor
+ * @param interruptManager The interrupt manager
+ * @return The driver
+ */
+static Driver* CreateAdvancedHostControllerInterface(PeripheralComponentInterconnectDeviceDescriptor* dev, InterruptManager* interruptManager){
+
+    //One vector for the whole controller, the HBA's interrupt status says which ports it is for
+    PeripheralComponentInterconnectController::activeController -> EnableMSI(dev, interruptManager, 1);
+    return new AdvancedHostControllerInterface(dev, interruptManager);
+}
+
+REGISTER_PCI_DRIVER(ahciDriver, "ahci", ahciIDs, CreateAdvancedHostControllerInterface);
+
+AdvancedHostControllerInterface::AdvancedHostControllerInterface(PeripheralComponentInterconnectDeviceDescriptor* device, InterruptManager* interruptManager)
+: Driver(),
+  InterruptHandler(device -> interrupt + interruptManager -> HardwareInterruptOffset(), interruptManager)
+{
+    this -> device = device;
+    registers = 0;
+    numPorts = 0;
+    for(int i = 0; i < maxPorts; ++i)
+        ports[i] = 0;
+
+    activeController = this;
+}
+
+AdvancedHostControllerInterface::~AdvancedHostControllerInterface() {
+
+    if(activeController == this)
+        activeController = 0;
+
+    for(int i = 0; i < maxPorts; ++i)
+        if(ports[i] != 0)
+            delete ports[i];
+
+}
+
+/**
+ * @details Take the controller from the firmware if it supports the BIOS/OS handoff
+ */
+void AdvancedHostControllerInterface::TakeOwnership() {
+
+    //Extended capabilities bit 0: handoff supported. Handoff control bit 1: OS owned, bit 0: BIOS owned, bit 4: BIOS busy
+    if(!(registers[AHCI_CAPABILITIES_EXTENDED >> 2] & 0x1))
+        return;
+
+    registers[AHCI_BIOS_HANDOFF >> 2] |= 0x2;
+    for(uint32_t i = 0; i < spinLimit && (registers[AHCI_BIOS_HANDOFF >> 2] & 0x1); ++i);
+    for(uint32_t i = 0; i < spinLimit && (registers[AHCI_BIOS_HANDOFF >> 2] & 0x10); ++i);
+
+}
+
+/**
+ * @details Map the registers, switch the HBA to AHCI mode and set up every implemented port
+ */
+void AdvancedHostControllerInterface::Activate() {
+
+    PeripheralComponentInterconnectController* pci = PeripheralComponentInterconnectController::activeController;
+    registers = (volatile uint32_t*)pci -> MapBaseAdressRegister(device, 5);
+    if(registers == 0){
+        printf("    -AHCI: Can't map the registers\n");
+        return;
+    }
+
+    //The HBA reads the command lists and moves the data itself
+    uint32_t command = pci -> Read(device -> bus, device -> device, device -> function, 0x04) & 0xFFFF;
+    pci -> Write(device -> bus, device -> device, device -> function, 0x04, command | 0x6);
+
+    TakeOwnership();
+
+    //Global control bit 31: AHCI enable, bit 1: interrupts
+    registers[AHCI_GLOBAL_CONTROL >> 2] |= 0x80000000;
+
+    //Capabilities bits 8-12: command slots per port minus one
+    uint32_t capabilities = registers[AHCI_CAPABILITIES >> 2];
+    uint32_t numSlots = ((capabilities >> 8) & 0x1F) + 1;
+    uint32_t implemented = registers[AHCI_PORTS_IMPLEMENTED >> 2];
+
+    for(int i = 0; i < maxPorts; ++i){
+
+        if(!(implemented & (1 << i)))
+            continue;
+
+        AdvancedHostControllerInterfacePort* port = new AdvancedHostControllerInterfacePort(registers + ((AHCI_PORTS + i * portSize) >> 2), i, numSlots);
+        if(!port -> Initialize() || !port -> Identify()){
+            delete port;
+            continue;
+        }
+
+        ports[i] = port;
+        numPorts++;
+
+        printf("    -AHCI Port 0x");
+        printfHex(i);
+        printf(": ");
+        printf(port -> Identity() -> model);
+        printf(port -> Identity() -> ncq ? (char*)" (NCQ)\n" : (char*)"\n");
+    }
+
+    //Only now can the ports raise interrupts: a register FIS ends a normal command, a set device bits FIS ends queued ones
+    for(int i = 0; i < maxPorts; ++i){
+
+        if(ports[i] == 0)
+            continue;
+
+        volatile uint32_t* port = registers + ((AHCI_PORTS + i * portSize) >> 2);
+        port[AHCI_PORT_INTERRUPT_STATUS >> 2] = 0xFFFFFFFF;
+        port[AHCI_PORT_INTERRUPT_ENABLE >> 2] = AHCI_INTERRUPT_REGISTER_FIS | AHCI_INTERRUPT_DEVICE_BITS | AHCI_INTERRUPT_ERRORS;
+    }
+
+    registers[AHCI_INTERRUPT_STATUS >> 2] = 0xFFFFFFFF;
+    registers[AHCI_GLOBAL_CONTROL >> 2] |= 1 << 1;
+
+}
+
+/**
+ * @details Get the amount of ports with a disk on them
+ * @return The amount
+ */
+int AdvancedHostControllerInterface::NumPorts() {
+    return numPorts;
+}
+
+/**
+ * @details Get the disk on a port
+ * @param index The port number
+ * @return The port, 0 if there isn't a disk on it
+ */
+AdvancedHostControllerInterfacePort* AdvancedHostControllerInterface::GetPort(int index) {
+
+    if(index < 0 || index >= maxPorts)
+        return 0;
+
+    return ports[index];
+}
+
+/**
+ * @details Service every port the HBA says has something, each port's status has to be cleared before the HBA's
+ * @param esp The stack pointer
+ * @return The stack pointer
+ */
+uint32_t AdvancedHostControllerInterface::HandleInterrupt(uint32_t esp) {
+
+    if(registers == 0)
+        return esp;
+
+    uint32_t status = registers[AHCI_INTERRUPT_STATUS >> 2];
+    for(int i = 0; i < maxPorts; ++i)
+        if((status & (1 << i)) && ports[i] != 0)
+            ports[i] -> Service();
+
+    registers[AHCI_INTERRUPT_STATUS >> 2] = status;
+    return esp;
+}
@@ -3,11 +3,13 @@
 // 
 
 #include <drivers/amd_am79c973.h>
+#include <system/trace.h>
 
 using namespace maxOS;
 using namespace maxOS::common;
 using namespace maxOS::drivers;
 using namespace maxOS::hardwarecommunication;
+using namespace maxOS::system;
 
 void printf(char* str, bool clearLine = false); // Forward declaration
 void printfHex(uint8_t key);                    // Forward declaration
@@ -45,6 +47,23 @@ void RawDataHandler::Send(uint8_t* buffer, uint32_t size){
 
 ///___DRIVER___
 
+static const PeripheralComponentInterconnectDeviceID amd_am79c973IDs[] = {
+    { PCI_VENDOR_AMD, 0x2000, 0, 0 },                  //PCnet-PCI II (am79c970A) / PCnet-FAST III (am79c973)
+};
+
+/**
+ * @details Create the driver for a matching PCI device
+ * @param dev The device descriptor
+ * @param interruptManager The interrupt manager
+ * @return The driver
+ */
+static Driver* Createamd_am79c973(PeripheralComponentInterconnectDeviceDescriptor* dev, InterruptManager* interruptManager){
+    return new amd_am79c973(dev, interruptManager);
+}
+
+REGISTER_PCI_DRIVER(amd_am79c973Driver, "amd_am79c973", amd_am79c973IDs, Createamd_am79c973);
+
+amd_am79c973* amd_am79c973::activeNetworkCard = 0;
 
 amd_am79c973::amd_am79c973(PeripheralComponentInterconnectDeviceDescriptor *dev, InterruptManager* interrupts)
         :   Driver(),
@@ -129,11 +148,14 @@ amd_am79c973::amd_am79c973(PeripheralComponentInterconnectDeviceDescriptor *dev,
     registerAddressPort.Write(2);                                     // Tell device to write to register 2
     registerDataPort.Write( ((uint32_t)(&initBlock) >> 16) & 0xFFFF );     // Write shifted address data
 
+    activeNetworkCard = this;
 
 }
 
 amd_am79c973::~amd_am79c973()
 {
+    if(activeNetworkCard == this)
+        activeNetworkCard = 0;
 }
 
 
@@ -190,7 +212,6 @@ common::uint32_t amd_am79c973::HandleInterrupt(common::uint32_t esp) {
 
     // Responses
     if((temp & 0x0400) == 0x0400) Receive();
-    if((temp & 0x0200) == 0x0200) printf("AMD am79c973 DATA SENT\n");
     if((temp & 0x0100) == 0x0100) printf("AMD am79c973 INIT DONE\n");
 
     // Reply that it was received
@@ -235,13 +256,7 @@ void amd_am79c973::Send(common::uint8_t *buffer, int size) {
         *dst = *src;                                                                        // Copy data from source buffer to destiantion buffer
     }
 
-
-    printf("Sending: ");
-    for(int i = 0; i < size; i++)
-    {
-        printfHex(buffer[i]);
-        printf(" ");
-    }
+    Tracer::Trace(TRACE_PACKET_SEND, size, sendDescriptor);        // Printing every packet here took longer than sending it
 
     sendBufferDescr[sendDescriptor].avail = 0;                               // Set that this buffer is in use
     sendBufferDescr[sendDescriptor].flags2 = 0;                              // Clear any previous error messages
@@ -255,11 +270,26 @@ void amd_am79c973::Send(common::uint8_t *buffer, int size) {
 
 }
 
+/**
+ * @details Send a package from an IO ring
+ * @param buffer The buffer to send
+ * @param length The size of the buffer
+ * @return The amount of bytes sent
+ */
+int32_t amd_am79c973::Send(uint8_t* buffer, uint32_t length) {
+
+    if(length > 1518)
+        length = 1518;
+
+    Send(buffer, (int)length);
+    return length;
+
+}
+
 /**
  * @details This function handles the receivement a package
  */
 void amd_am79c973::Receive() {
-    printf("AMD am79c973 DATA RECEVED\n");
 
     for(; (recvBufferDescr[currentRecvBuffer].flags & 0x80000000) == 0;         // Check if there is data    (if the first flag is 0 then it is empty)
           currentRecvBuffer = (currentRecvBuffer + 1) % 8)                      // Cycle through the receive buffers
@@ -275,7 +305,7 @@ void amd_am79c973::Receive() {
             }
 
             uint8_t* buffer = (uint8_t*)(recvBufferDescr[currentRecvBuffer].address);
-
+            Tracer::Trace(TRACE_PACKET_RECEIVE, size, currentRecvBuffer);
 
 
             //Pass data to handler
@@ -289,14 +319,6 @@ void amd_am79c973::Receive() {
 
             }
 
-            printf("Received: ");
-            size = 64;
-            for(int i = 0; i < size; i++)
-            {
-                printfHex(buffer[i]);
-                printf(" ");
-            }
-
 
         }
 
@@ -3,28 +3,352 @@
 //
 
 #include <drivers/ata.h>
+#include <hardwarecommunication/pci.h>
+#include <system/paging.h>
+#include <system/pagecache.h>
 
 using namespace maxOS;
 using namespace maxOS::common;
 using namespace maxOS::hardwarecommunication;
 using namespace maxOS::drivers;
+using namespace maxOS::system;
 
 void printf(char* str, bool clearLine = false); // Forward declaration
 void printfHex(uint8_t key);                    // Forward declaration
 
-AdvancedTechnologyAttachment::AdvancedTechnologyAttachment(uint16_t portBase, bool master)
-: dataPort(portBase),
-  errorPort(portBase + 1),
-  sectorCountPort(portBase + 2),
-  LBAlowPort(portBase + 3),
-  LBAmidPort(portBase + 4),
-  LBAHiPort(portBase + 5),
-  devicePort(portBase + 6),
-  commandPort(portBase + 7),
-  controlPort(portBase + 0x206)
+///__CHANNEL__
+
+/**
+ * @details Take over the IRQ of a channel, DMA is off until EnableDMA finds the bus master
+ * @param portBase The first port of the channel (0x1F0 primary, 0x170 secondary)
+ * @param irq The ISA IRQ it raises (14 primary, 15 secondary)
+ * @param interruptManager The interrupt manager
+ */
+AdvancedTechnologyAttachmentChannel::AdvancedTechnologyAttachmentChannel(uint16_t portBase, uint8_t irq, InterruptManager* interruptManager)
+: InterruptHandler(interruptManager -> HardwareInterruptOffset() + irq, interruptManager),
+  statusPort(portBase + 7)
 {
+    this -> portBase = portBase;
+    this -> irq = irq;
+
+    busMasterBase = 0;
+    regions = 0;
+    busMasterStatus = 0;
+    deviceStatus = 0;
+
+    active = 0;
+    queueHead = 0;
+    queueTail = 0;
+}
+
+AdvancedTechnologyAttachmentChannel::~AdvancedTechnologyAttachmentChannel() {
+
+}
+
+/**
+ * @details Get the first port of the channel
+ * @return The port
+ */
+uint16_t AdvancedTechnologyAttachmentChannel::PortBase() {
+    return portBase;
+}
+
+/**
+ * @details Find the IDE controller this channel belongs to and use its bus master DMA engine
+ * @return True if DMA can be used
+ */
+bool AdvancedTechnologyAttachmentChannel::EnableDMA() {
+
+    PeripheralComponentInterconnectController* pci = PeripheralComponentInterconnectController::activeController;
+    if(pci == 0 || PageManager::activePageManager == 0)
+        return false;
+
+    for(PeripheralComponentInterconnectDeviceDescriptor* ide = pci -> FindClass(0x01, 0x01); ide != 0; ide = pci -> FindClass(0x01, 0x01, ide)){
+
+        //Interface bit 7: can bus master. Bits 0 / 2: the primary / secondary channel uses BAR 0 / 2 instead of the legacy ports
+        if(!(ide -> interface_id & 0x80))
+            continue;
+
+        int channelIndex = -1;
+        for(int i = 0; i < 2; ++i){
+
+            uint16_t channelPorts = i == 0 ? 0x1F0 : 0x170;
+            if(ide -> interface_id & (1 << (i * 2)))
+                channelPorts = (uint32_t)pci -> GetBaseAdressRegister(ide -> bus, ide -> device, ide -> function, i * 2).adress;
+
+            if(channelPorts == portBase)
+                channelIndex = i;
+        }
+
+        if(channelIndex < 0)
+            continue;
+
+        BaseAdressRegister busMaster = pci -> GetBaseAdressRegister(ide -> bus, ide -> device, ide -> function, 4);
+        if(busMaster.type != InputOutput || busMaster.adress == 0)
+            continue;
+
+        regions = (PhysicalRegionDescriptor*)PageManager::activePageManager -> AllocateFrame();
+        if(regions == 0)
+            return false;
+
+        //Let the controller decode its ports and master the bus
+        uint32_t command = pci -> Read(ide -> bus, ide -> device, ide -> function, 0x04) & 0xFFFF;
+        pci -> Write(ide -> bus, ide -> device, ide -> function, 0x04, command | 0x5);
+
+        busMasterBase = (uint32_t)busMaster.adress + channelIndex * 8;
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @details Check if EnableDMA found the bus master
+ * @return True if DMA can be used
+ */
+bool AdvancedTechnologyAttachmentChannel::HasDMA() {
+    return busMasterBase != 0;
+}
+
+/**
+ * @details Fill the descriptor table with the physical pages behind a buffer, joining pages that are next to each other
+ * @param buffer The buffer (kernel or current address space)
+ * @param length The amount of bytes
+ * @param toMemory True if the device writes to the buffer
+ * @param addressSpace The address space the buffer is in, 0 for the current one
+ * @param first The amount of descriptors already built, to add another piece of a scattered buffer
+ * @return The amount of descriptors, -1 if the buffer can't be used for DMA (not backed by usable memory, not word aligned, too fragmented)
+ */
+int AdvancedTechnologyAttachmentChannel::BuildRegions(uint8_t* buffer, uint32_t length, bool toMemory, PageDirectory* addressSpace, int first) {
+
+    if(regions == 0 || length == 0 || ((uint32_t)buffer & 0x1) || first < 0)
+        return -1;
+
+    //The table only ends at the last piece
+    if(first > 0)
+        regions[first - 1].flags = 0;
+
+    int numRegions = first;
+    uint32_t virtualAddress = (uint32_t)buffer;
+    while(length > 0){
+
+        uint32_t physicalAddress = PageManager::activePageManager -> PhysicalAddress(virtualAddress, toMemory, addressSpace);
+        if(physicalAddress == 0)
+            return -1;
+
+        //Stop at the end of the page and at 64KB boundaries
+        uint32_t chunk = PAGE_SIZE - (virtualAddress & (PAGE_SIZE - 1));
+        uint32_t toBoundary = 0x10000 - (physicalAddress & 0xFFFF);
+        if(chunk > toBoundary)
+            chunk = toBoundary;
+        if(chunk > length)
+            chunk = length;
+
+        PhysicalRegionDescriptor* last = numRegions == 0 ? 0 : &regions[numRegions - 1];
+        uint32_t lastSize = last == 0 ? 0 : (last -> byteCount == 0 ? 0x10000 : last -> byteCount);
+        if(last != 0 && last -> address + lastSize == physicalAddress && (last -> address & ~0xFFFF) == (physicalAddress & ~0xFFFF)){
+            last -> byteCount = (lastSize + chunk) & 0xFFFF;
+        }
+        else
+        {
+            if(numRegions >= maxRegions)
+                return -1;
+
+            regions[numRegions].address = physicalAddress;
+            regions[numRegions].byteCount = chunk & 0xFFFF;
+            regions[numRegions].flags = 0;
+            numRegions++;
+        }
+
+        virtualAddress += chunk;
+        length -= chunk;
+    }
+
+    regions[numRegions - 1].flags = 0x8000;
+    return numRegions;
+}
+
+/**
+ * @details Start the bus master on the descriptor table, the device command has to be sent before this
+ * @param toMemory True if the device is read from
+ */
+void AdvancedTechnologyAttachmentChannel::StartDMA(bool toMemory) {
+
+    //Bus master registers: 0 command (bit 0 start, bit 3 write to memory), 2 status (bits 1, 2 clear by writing 1), 4 descriptor table
+    PortIO<uint8_t>::Write(busMasterBase, 0);
+    PortIO<uint32_t>::Write(busMasterBase + 4, (uint32_t)regions);
+    PortIO<uint8_t>::Write(busMasterBase + 2, (PortIO<uint8_t>::Read(busMasterBase + 2) & 0x60) | 0x06);
+    PortIO<uint8_t>::Write(busMasterBase, toMemory ? 0x09 : 0x01);
+
+}
+
+/**
+ * @details Check if the bus master raised the interrupt, which means the transfer is over
+ * @return True if it is
+ */
+bool AdvancedTechnologyAttachmentChannel::CheckCompletion() {
+
+    uint8_t status = PortIO<uint8_t>::Read(busMasterBase + 2);
+    if(!(status & 0x04))
+        return false;
+
+    PortIO<uint8_t>::Write(busMasterBase + 2, (status & 0x60) | 0x06);
+    busMasterStatus = status;
+    deviceStatus = statusPort.Read();                  //Also acknowledges the device
+    return true;
+}
+
+/**
+ * @details Stop the bus master once CheckCompletion says the transfer is over
+ * @return True if the transfer worked
+ */
+bool AdvancedTechnologyAttachmentChannel::StopDMA() {
+
+    PortIO<uint8_t>::Write(busMasterBase, 0);
+    return !(busMasterStatus & 0x02) && !(deviceStatus & (ATA_STATUS_ERROR | ATA_STATUS_DEVICE_FAULT));
+}
+
+/**
+ * @details Queue a request, it is issued straight away if the channel is idle
+ * @param request The request (its device has to be set)
+ */
+void AdvancedTechnologyAttachmentChannel::Submit(ATARequest* request) {
+
+    uint32_t flags = DisableInterrupts();
+
+    request -> complete = false;
+    request -> next = 0;
+    if(queueTail == 0)
+        queueHead = request;
+    else
+        queueTail -> next = request;
+    queueTail = request;
+
+    if(active == 0)
+        StartNext();
+
+    RestoreInterrupts(flags);
+}
+
+/**
+ * @details Issue queued requests until one is in flight (some finish, or fail, as soon as they are issued)
+ */
+void AdvancedTechnologyAttachmentChannel::StartNext() {
+
+    while(active == 0 && queueHead != 0){
+
+        ATARequest* request = queueHead;
+        queueHead = request -> next;
+        if(queueHead == 0)
+            queueTail = 0;
+
+        active = request;
+        if(!request -> device -> Start(request))
+            continue;
+
+        active = 0;
+        request -> complete = true;
+        if(request -> callback != 0)
+            request -> callback(request);
+    }
+}
+
+/**
+ * @details Let the active request make progress, called from the IRQ handler and by waiting threads (interrupts are off in both)
+ */
+void AdvancedTechnologyAttachmentChannel::Service() {
+
+    if(active == 0){
+        statusPort.Read();                              //Nothing to do, but the device still needs its interrupt acknowledged
+        return;
+    }
+
+    ATARequest* request = active;
+    if(!request -> device -> Service(request))
+        return;
+
+    active = 0;
+    request -> complete = true;
+    if(request -> callback != 0)
+        request -> callback(request);
+
+    StartNext();
+}
+
+/**
+ * @details Wait for a request to complete, other threads run until the IRQ arrives. While booting interrupts are off so the devices are polled instead
+ * @param request The request
+ */
+void AdvancedTechnologyAttachmentChannel::Wait(ATARequest* request) {
+
+    while(!request -> complete){
+
+        //Polling as well catches requests whose IRQ came while their buffer couldn't be reached (PIO into another address space)
+        uint32_t flags = DisableInterrupts();
+        Service();
+
+        if(!(flags & (1 << 9)) || request -> complete){
+            RestoreInterrupts(flags);
+            continue;
+        }
+
+        //sti only takes effect after the next instruction, so the IRQ can't slip in between the check and the hlt
+        asm volatile("sti\n hlt");
+    }
+}
+
+/**
+ * @details Check the device for progress without waiting for its IRQ
+ */
+void AdvancedTechnologyAttachmentChannel::Poll() {
+
+    uint32_t flags = DisableInterrupts();
+    Service();
+    RestoreInterrupts(flags);
+
+}
+
+/**
+ * @details Move the active request along
+ * @param esp The stack pointer
+ * @return The stack pointer
+ */
+uint32_t AdvancedTechnologyAttachmentChannel::HandleInterrupt(uint32_t esp) {
+
+    Service();
+    return esp;
+
+}
+
+///__DEVICE__
+
+AdvancedTechnologyAttachment::AdvancedTechnologyAttachment(AdvancedTechnologyAttachmentChannel* channel, bool master)
+: dataPort(channel -> PortBase()),
+  errorPort(channel -> PortBase() + 1),
+  sectorCountPort(channel -> PortBase() + 2),
+  LBAlowPort(channel -> PortBase() + 3),
+  LBAmidPort(channel -> PortBase() + 4),
+  LBAHiPort(channel -> PortBase() + 5),
+  devicePort(channel -> PortBase() + 6),
+  commandPort(channel -> PortBase() + 7),
+  controlPort(channel -> PortBase() + 0x206)
+{
+    this -> channel = channel;
     bytesPerSector = 512;
     this -> master = master;
+
+    present = false;
+    sectorsPerBlock = 1;
+    identity.model[0] = '\0';
+    identity.serial[0] = '\0';
+    identity.sectors = 0;
+    identity.lba48 = false;
+    identity.dma = false;
+    identity.maxSectorsPerBlock = 0;
+
+    limits.maxDepth = blockQueueDepth;
+    for(int i = 0; i < blockQueueDepth; ++i)
+        blockRequests[i].context = 0;
 }
 
 AdvancedTechnologyAttachment::~AdvancedTechnologyAttachment() {
@@ -32,231 +356,680 @@ AdvancedTechnologyAttachment::~AdvancedTechnologyAttachment() {
 }
 
 /**
- * @details This function Identifiers the ATA device
+ * @details Identify the device when the driver manager gets to it
+ */
+void AdvancedTechnologyAttachment::Activate() {
+
+    printf(master ? (char*)"    -ATA Master: " : (char*)"    -ATA Slave: ");
+    printf(Identify() ? identity.model : (char*)"No Device");
+    printf("\n");
+
+}
+
+/**
+ * @details Give the device 400ns to put its status up after being selected, reading the alternate status takes ~100ns
+ */
+void AdvancedTechnologyAttachment::Delay() {
+
+    for(int i = 0; i < 4; ++i)
+        controlPort.Read();
+
+}
+
+/**
+ * @details Wait for the device to ask for the first block of a PIO write, it doesn't raise an interrupt for that one
+ * @return False if it failed instead
  */
-void AdvancedTechnologyAttachment::Identify() {
+bool AdvancedTechnologyAttachment::WaitData() {
 
-    devicePort.Write(master ? 0xA0 : 0xB0);     //Select Device Master(0xA0) / Slave(0xB0)
-    controlPort.Write(0);                       //Clear HOB bit (HOB : Set this to read back the High Order Byte of the last LBA48 value sent to an IO port.)
+    uint8_t status = controlPort.Read();
+    while((status & ATA_STATUS_BUSY) || !(status & (ATA_STATUS_DATA_REQUEST | ATA_STATUS_ERROR | ATA_STATUS_DEVICE_FAULT)))
+        status = controlPort.Read();
+
+    return !(status & (ATA_STATUS_ERROR | ATA_STATUS_DEVICE_FAULT));
+}
+
+/**
+ * @details Copy a string out of the IDENTIFY data, the bytes of each word are swapped and it is padded with spaces
+ * @param words The IDENTIFY data
+ * @param first The first word of the string
+ * @param numWords How many words it takes
+ * @param string Where to put it, needs numWords * 2 + 1 bytes
+ */
+static void CopyIdentityString(uint16_t* words, int first, int numWords, char* string){
+
+    for(int i = 0; i < numWords; ++i){
+        string[i * 2] = words[first + i] >> 8;
+        string[i * 2 + 1] = words[first + i] & 0xFF;
+    }
+
+    int length = numWords * 2;
+    while(length > 0 && string[length - 1] == ' ')
+        length--;
+    string[length] = '\0';
+
+}
+
+/**
+ * @details This function Identifiers the ATA device and sets up the largest block size READ / WRITE MULTIPLE can use
+ * @return True if there is an ATA device
+ */
+bool AdvancedTechnologyAttachment::Identify() {
+
+    present = false;
 
     //Floating Bus check : First you select the master, then read in the value of the status register and then compare it with 0xFF (is an invalid status value).
+    uint32_t flags = DisableInterrupts();
     devicePort.Write(0xA0);                     //Select Master (0xA0)
-    uint8_t status = commandPort.Read();             //Read Status
-    if(status == 0xFF){                              //IF status is 0xFF then there is no device
-        printf("Invalid Status");
-        return;                                      //Return, beacuse if there is no master then there wont be a slave either
+    controlPort.Write(0);                       //Clear HOB bit and let the device raise interrupts
+    uint8_t status = commandPort.Read();
+    RestoreInterrupts(flags);
+    if(status == 0xFF)                          //IF status is 0xFF then there is no device
+        return false;                           //Return, beacuse if there is no master then there wont be a slave either
+
+    uint16_t data[256];
+    ATARequest request;
+    request.operation = ATA_REQUEST_IDENTIFY;
+    request.buffer = (uint8_t*)data;
+    request.segments = 0;
+    if(Execute(&request) < 0)
+        return false;
+
+    CopyIdentityString(data, 27, 20, identity.model);
+    CopyIdentityString(data, 10, 10, identity.serial);
+    identity.maxSectorsPerBlock = data[47] & 0xFF;
+    identity.dma = data[49] & (1 << 8);
+
+    //Word 83 bit 10 says if the 48 bit feature set is there, its capacity is in words 100-103 instead of 60-61
+    identity.lba48 = data[83] & (1 << 10);
+    identity.sectors = data[60] | ((uint32_t)data[61] << 16);
+    if(identity.lba48)
+        identity.sectors = data[100] | ((uint32_t)data[101] << 16) | ((uint64_t)data[102] << 32) | ((uint64_t)data[103] << 48);
+
+    present = true;
+    capacity = identity.sectors;
+    limits.maxSectors = identity.lba48 ? AdvancedTechnologyAttachmentChannel::maxDMASectors : 256;
+
+    //Move as many sectors per data request as the device allows
+    sectorsPerBlock = 1;
+    if(identity.maxSectorsPerBlock > 1){
+
+        request.operation = ATA_REQUEST_COMMAND;
+        request.command = ATA_SET_MULTIPLE_MODE;
+        request.count = identity.maxSectorsPerBlock;
+        if(Execute(&request) == 0)
+            sectorsPerBlock = identity.maxSectorsPerBlock;
     }
 
-    devicePort.Write(master ? 0xA0 : 0xB0);     //Select Device Master(0xA0) / Slave(0xB0)
-    sectorCountPort.Write(0);                   //Sector Doesn't Matter when Identifying so select sec 0
-    LBAlowPort.Write(0);                        //Same here
-    LBAmidPort.Write(0);                        //Same here
-    LBAHiPort.Write(0);                         //Same here
-    commandPort.Write(0x0EC);                   //Command For Identifying
-
-    status = commandPort.Read();                     //Read Status
-    if(status == 0x00){                              //IF status is 0x00 then there is no device
-        printf("No Device");
-        return;                                      //There is no slave/master
-    }
+    return true;
+}
+
+/**
+ * @details Check if Identify found a device
+ * @return True if there is an ATA device
+ */
+bool AdvancedTechnologyAttachment::IsPresent() {
+    return present;
+}
+
+/**
+ * @details Get what IDENTIFY said about the device
+ * @return The parsed IDENTIFY data, only valid if the device is present
+ */
+ATAIdentity* AdvancedTechnologyAttachment::Identity() {
+    return &identity;
+}
+
+/**
+ * @details Select the device and the sectors the next command works on, in 48 bit mode the high bytes are written first (the ports hold the last two bytes written)
+ * @param lba The first sector
+ * @param count How many sectors (the maximum is written as 0)
+ */
+void AdvancedTechnologyAttachment::SelectSector(uint64_t lba, uint32_t count) {
+
+    uint32_t low = lba & 0xFFFFFFFF;
 
-    //Can take a while for there to be an answer to the identify command,
-    while (
-            ((status & 0x80) == 0x80)                 //Device is busy
-            &&
-            ((status & 0x01) != 0x01)                 //There was an error
-          )
+    if(identity.lba48){
+
+        uint32_t high = lba >> 32;
+        devicePort.Write(master ? 0x40 : 0x50);                             //Select Device Master(0x40) / Slave(0x50) in LBA mode
+        errorPort.Write(0);
+
+        sectorCountPort.Write((count >> 8) & 0xFF);
+        LBAlowPort.Write( (low & 0xFF000000) >> 24);
+        LBAmidPort.Write(  high & 0x000000FF );
+        LBAHiPort.Write( (high & 0x0000FF00) >> 8);
+    }
+    else
     {
-        status = commandPort.Read();
+        devicePort.Write((master ? 0xE0 : 0xF0) | ((low & 0x0F000000) >> 24));     //Select Device Master(0xE0) / Slave(0xF0) in LBA mode, and add spare bits
+        errorPort.Write(0);
     }
 
-    //Check for any errors
-    if(status & 0x01){
+    sectorCountPort.Write(count & 0xFF);
+    LBAlowPort.Write(  low & 0x000000FF );              //Split the sector into the port (put the low 8 bits ito this port)
+    LBAmidPort.Write( (low & 0x0000FF00) >> 8);         //Split the sector into the port  (put the mid 8 bits ito this port)
+    LBAHiPort.Write( (low & 0x00FF0000) >> 16);         //Split the sector into the port (put the hi 8 bits ito this port)
 
-        printf("ERROR");
-        return;
+}
+
+/**
+ * @details Get how many sectors one command can move, the sector count register is 8 bits (16 in 48 bit mode) with 0 meaning the maximum
+ * @return The amount of sectors
+ */
+uint32_t AdvancedTechnologyAttachment::MaxSectorsPerCommand() {
+    return identity.lba48 ? 65536 : 256;
+}
 
+/**
+ * @details Find where a sector of a request goes in memory
+ * @param request The request
+ * @param sector The sector, counted from the start of the request
+ * @param contiguous Set to how many sectors from there are next to each other in memory
+ * @return The address, 0 if the request doesn't have that sector
+ */
+uint8_t* AdvancedTechnologyAttachment::SectorAddress(ATARequest* request, uint32_t sector, uint32_t* contiguous) {
+
+    if(request -> segments == 0){
+        *contiguous = request -> count - sector;
+        return request -> buffer + sector * bytesPerSector;
     }
 
-    //We are reading 2 bytes from data port so , it will be 256 , so total bytes read are 512 (512 is bytes per sector)
-    bool stopPrint = false;
-    for (uint16_t i = 0; i < 256; ++i) {
-
-        uint16_t data = dataPort.Read();
-        char *text = "  \0";
-        text[0] = (data >> 8) & 0xFF;
-        text[1] = data & 0xFF;
-        if(text[0] == 'K'){
-            printf(text);
-            stopPrint = true;       //Stop the messed up text from showing
-        }
+    for(BlockIO* io = request -> segments; io != 0; io = io -> next){
 
-        if(!stopPrint) printf(text);
+        if(sector < io -> count){
+            *contiguous = io -> count - sector;
+            return io -> buffer + sector * bytesPerSector;
+        }
 
+        sector -= io -> count;
     }
 
-
+    *contiguous = 0;
+    return 0;
 }
 
 /**
- * @details This function reads a sector from the ATA device
- * @param sector The sector to read
- * @param count The amount of data to read to that sector
+ * @details Move sectors through the data port, a block can span several pieces of a scattered buffer
+ * @param request The request
+ * @param sector The first sector, counted from the start of the request
+ * @param count How many sectors
+ * @param write True to send them to the device
  */
-void AdvancedTechnologyAttachment::Read28(uint32_t sector, int count) {
+void AdvancedTechnologyAttachment::TransferPIO(ATARequest* request, uint32_t sector, uint32_t count, bool write) {
 
-    //Don't Allow reading More then a sector
-    if(sector > 0x0FFFFFFF)
-        return;
-    if(count > 512)
-        return;
+    while(count > 0){
+
+        uint32_t contiguous;
+        uint8_t* address = SectorAddress(request, sector, &contiguous);
+        if(address == 0)
+            return;
 
+        if(contiguous > count)
+            contiguous = count;
 
+        if(write)
+            dataPort.WriteString((uint16_t*)address, contiguous * bytesPerSector / 2);
+        else
+            dataPort.ReadString((uint16_t*)address, contiguous * bytesPerSector / 2);
 
-    devicePort.Write(master ? 0xE0 : 0xF0 | ((sector & 0x0F000000) >> 24) );     //Select Device Master(0xE0) / Slave(0xF0), and add spare bits
-    errorPort.Write(0);                                                          //Clear Previous Errors
-    sectorCountPort.Write(1);                                                    // For now only read/write a single sector         TODO: Fix this
+        sector += contiguous;
+        count -= contiguous;
+    }
+}
 
+/**
+ * @details Check if PIO can reach the buffer of a request right now, user buffers are only visible while their address space is loaded
+ * @param request The request
+ * @return True if it can
+ */
+bool AdvancedTechnologyAttachment::CanAccess(ATARequest* request) {
 
-    LBAlowPort.Write(  sector & 0x000000FF );              //Split the sector into the port (put the low 8 bits ito this port)
-    LBAmidPort.Write( (sector & 0x0000FF00) >> 8);         //Split the sector into the port  (put the mid 8 bits ito this port)
-    LBAHiPort.Write( (sector & 0x00FF0000) >> 16);         //Split the sector into the port (put the hi 8 bits ito this port)
-    commandPort.Write(0x20);                              //Command For Reading
+    return (uint32_t)request -> buffer < USER_SPACE_START
+        || PageManager::activePageManager == 0
+        || request -> addressSpace == PageManager::activePageManager -> CurrentAddressSpace();
+}
 
+/**
+ * @details End a request that went wrong, keeping the sectors moved before it did
+ * @param request The request
+ * @return True (it is complete)
+ */
+bool AdvancedTechnologyAttachment::Fail(ATARequest* request) {
 
-    uint8_t status = commandPort.Read();                     //Read Status
-    if(status == 0x00){                                     //IF status is 0x00 then there is no device
-        printf("No Device");
-        return;                                              //There is no slave/master
+    request -> result = request -> done == 0 ? -1 : (int)request -> done;
+    return true;
+}
+
+/**
+ * @details Send the first command of a request
+ * @param request The request
+ * @return True if it is already complete (e.g. there is no device)
+ */
+bool AdvancedTechnologyAttachment::Start(ATARequest* request) {
+
+    request -> done = 0;
+    request -> chunk = 0;
+    request -> chunkDone = 0;
+    request -> dma = false;
+
+    switch (request -> operation) {
+
+        case ATA_REQUEST_IDENTIFY:
+        {
+            devicePort.Write(master ? 0xA0 : 0xB0);     //Select Device Master(0xA0) / Slave(0xB0)
+            Delay();
+            sectorCountPort.Write(0);                   //Sector Doesn't Matter when Identifying so select sec 0
+            LBAlowPort.Write(0);                        //Same here
+            LBAmidPort.Write(0);                        //Same here
+            LBAHiPort.Write(0);                         //Same here
+            commandPort.Write(ATA_IDENTIFY);
+            Delay();
+
+            //A status of 0 means there is no device
+            if(controlPort.Read() == 0x00)
+                return Fail(request);
+
+            request -> chunk = 1;
+            return false;
+        }
+
+        case ATA_REQUEST_COMMAND:
+            devicePort.Write(master ? 0xE0 : 0xF0);
+            sectorCountPort.Write(request -> count & 0xFF);
+            commandPort.Write(request -> command);
+            Delay();
+            return false;
+
+        default:
+            if(!present || request -> lba + request -> count > identity.sectors)
+                return Fail(request);
+
+            return IssueNext(request);
     }
+}
 
-    //Can take a while for the disk to be fully read
-    while (
-            ((status & 0x80) == 0x80)                 //Device is busy
-            &&
-            ((status & 0x01) != 0x01)                 //There was an error
-            )
-    {
-        status = commandPort.Read();
+/**
+ * @details Send the command for the next part of a read or write, with DMA if the controller and the buffer allow it
+ * @param request The request
+ * @return True if there is nothing left to do
+ */
+bool AdvancedTechnologyAttachment::IssueNext(ATARequest* request) {
+
+    if(request -> done >= request -> count){
+        request -> result = request -> done;
+        return true;
     }
 
-    //Check for any errors
-    if(status & 0x01){
+    bool write = request -> operation == ATA_REQUEST_WRITE;
+    uint32_t sectors = request -> count - request -> done;
+    if(sectors > MaxSectorsPerCommand())
+        sectors = MaxSectorsPerCommand();
 
-        printf("ERROR");
-        return;
+    request -> chunkDone = 0;
+    request -> dma = false;
 
-    }
+    if(identity.dma && channel -> HasDMA()){
 
-    printf("Reading from ATA: ");
+        uint32_t dmaSectors = sectors > AdvancedTechnologyAttachmentChannel::maxDMASectors ? AdvancedTechnologyAttachmentChannel::maxDMASectors : sectors;
 
+        //One descriptor list over every piece of the buffer, too many pieces and PIO is used instead
+        int numRegions = 0;
+        for(uint32_t sector = request -> done; numRegions >= 0 && sector < request -> done + dmaSectors;){
 
-    //We are reading 2 bytes to the data port so , it will be 256 , so has to be incremented by 2
-    for (uint16_t i = 0; i < bytesPerSector ; i+= 2) {
+            uint32_t contiguous;
+            uint8_t* address = SectorAddress(request, sector, &contiguous);
+            if(contiguous > request -> done + dmaSectors - sector)
+                contiguous = request -> done + dmaSectors - sector;
 
-        uint16_t readData = dataPort.Read();
+            numRegions = address == 0 ? -1 : channel -> BuildRegions(address, contiguous * bytesPerSector, !write, request -> addressSpace, numRegions);
+            sector += contiguous;
+        }
 
-        char *text = "  \0";
-        text[0] = readData & 0xFF;
+        if(numRegions >= 0){
 
-        if(i+1 < count)
-            text[1] = (readData >> 8) & 0xFF;
-        else
-            text[1] = '\0';
+            request -> chunk = dmaSectors;
+            request -> dma = true;
 
+            SelectSector(request -> lba + request -> done, dmaSectors);
+            if(write)
+                commandPort.Write(identity.lba48 ? ATA_WRITE_DMA_EXT : ATA_WRITE_DMA);
+            else
+                commandPort.Write(identity.lba48 ? ATA_READ_DMA_EXT : ATA_READ_DMA);
 
-        if(i < count)                                           //Prevent random shit from throwing up on my screen
-            printf(text);
+            channel -> StartDMA(!write);
+            return false;
+        }
     }
 
-    //Hard Drive must have a full sector read, even if the data isnt the size of a full sector
-    for(int i = count + (count%2); i < bytesPerSector; i += 2)      //If count isnt an even number then it would have already had it's byte read
-        dataPort.Read();
+    request -> chunk = sectors;
+    SelectSector(request -> lba + request -> done, sectors);
+    if(write)
+        commandPort.Write(identity.lba48 ? (sectorsPerBlock > 1 ? ATA_WRITE_MULTIPLE_EXT : ATA_WRITE_SECTORS_EXT) : (sectorsPerBlock > 1 ? ATA_WRITE_MULTIPLE : ATA_WRITE_SECTORS));
+    else
+        commandPort.Write(identity.lba48 ? (sectorsPerBlock > 1 ? ATA_READ_MULTIPLE_EXT : ATA_READ_SECTORS_EXT) : (sectorsPerBlock > 1 ? ATA_READ_MULTIPLE : ATA_READ_SECTORS));
+    Delay();
+
+    //The first block of a write is asked for without an interrupt
+    if(write){
 
+        if(!WaitData())
+            return Fail(request);
+
+        if(CanAccess(request)){
+            uint32_t blockSectors = sectors < sectorsPerBlock ? sectors : sectorsPerBlock;
+            TransferPIO(request, request -> done, blockSectors, true);
+            request -> chunkDone = blockSectors;
+        }
+    }
+
+    return false;
 }
 
 /**
- * @details This function writes a sector to the ATA device
- * @param sector The sector to write to
- * @param count The amount of data to write to that sector
+ * @details Do whatever the device is ready for: move the next block, or finish the command and send the next one
+ * @param request The request
+ * @return True if the request is complete
  */
-void AdvancedTechnologyAttachment::Write28(uint32_t sector, uint8_t *data, int count) {
+bool AdvancedTechnologyAttachment::Service(ATARequest* request) {
 
-    //Don't Allow Writing More then a sector
-    if(sector > 0x0FFFFFFF)
-        return;
-    if(count > 512)
-        return;
+    if(request -> dma){
+
+        if(!channel -> CheckCompletion())
+            return false;
+
+        if(!channel -> StopDMA())
+            return Fail(request);
+
+        request -> done += request -> chunk;
+        return IssueNext(request);
+    }
+
+    if(controlPort.Read() & ATA_STATUS_BUSY)
+        return false;
+
+    uint8_t status = commandPort.Read();                //Also acknowledges the interrupt
+    if(status & (ATA_STATUS_ERROR | ATA_STATUS_DEVICE_FAULT))
+        return Fail(request);
+
+    uint32_t sector = request -> done + request -> chunkDone;
+    uint32_t blockSectors = request -> chunk - request -> chunkDone < sectorsPerBlock ? request -> chunk - request -> chunkDone : sectorsPerBlock;
+
+    switch (request -> operation) {
 
+        case ATA_REQUEST_COMMAND:
+            request -> result = 0;
+            return true;
 
+        case ATA_REQUEST_IDENTIFY:
+            if(!(status & ATA_STATUS_DATA_REQUEST) || !CanAccess(request))
+                return false;
 
-    devicePort.Write(master ? 0xE0 : 0xF0 | ((sector & 0x0F000000) >> 24) );     //Select Device Master(0xE0) / Slave(0xF0), and add spare bits
-    errorPort.Write(0);                                                          //Clear Previous Errors
-    sectorCountPort.Write(1);                                                    // For now only read/write a single sector         TODO: Fix this
+            dataPort.ReadString((uint16_t*)request -> buffer, 256);
+            request -> result = 1;
+            return true;
 
+        case ATA_REQUEST_READ:
+            if(!(status & ATA_STATUS_DATA_REQUEST) || !CanAccess(request))
+                return false;
 
-    LBAlowPort.Write(  sector & 0x000000FF );              //Split the sector into the port (put the low 8 bits ito this port)
-    LBAmidPort.Write( (sector & 0x0000FF00) >> 8);         //Split the sector into the port  (put the mid 8 bits ito this port)
-    LBAHiPort.Write( (sector & 0x00FF0000) >> 16);         //Split the sector into the port (put the hi 8 bits ito this port)
-    commandPort.Write(0x30);                              //Command For Writing
+            TransferPIO(request, sector, blockSectors, false);
+            request -> chunkDone += blockSectors;
+            if(request -> chunkDone < request -> chunk)
+                return false;
 
-    printf("Writing to ATA: ");
+            request -> done += request -> chunk;
+            return IssueNext(request);
 
+        case ATA_REQUEST_WRITE:
+            if(request -> chunkDone < request -> chunk){
 
-    //We are write 2 bytes to the data port so , it will be 256 , so has to be incremented by 2
-    for (uint16_t i = 0; i < bytesPerSector ; i+= 2) {
+                if(!(status & ATA_STATUS_DATA_REQUEST) || !CanAccess(request))
+                    return false;
 
-        uint16_t  writeData = data[i];                          //Get the i'th byte from the data
-        if(i+1 < count)                                         //Check if next byte is there also
-            writeData |= ((uint16_t)data[i+1]) << 8;            //Write that byte
-        dataPort.Write(writeData);                         //Write the data
-        char *text = "  \0";
-        text[1] = (writeData >> 8) & 0xFF;
-        text[0] = writeData & 0xFF;
+                TransferPIO(request, sector, blockSectors, true);
+                request -> chunkDone += blockSectors;
+                return false;
+            }
 
-        if(i < count)                                           //Prevent random shit from throwing up on my screen
-             printf(text);
+            //The command is only done once the last block is on the device
+            if(status & ATA_STATUS_DATA_REQUEST)
+                return false;
+
+            request -> done += request -> chunk;
+            return IssueNext(request);
     }
 
-    //Hard Drive must have a full sector written, even if the data isnt the size of a full sector
-    for(int i = count + (count%2); i < bytesPerSector; i += 2)      //If count isnt an even number then it would have already had it's byte written
-        dataPort.Write(0x0000);
+    return false;
+}
+
+/**
+ * @details Queue a request on the device's channel, it completes in the background and calls its callback (from the IRQ handler)
+ * @param request The request, it has to stay valid until it is complete. Without DMA the buffer should be kernel memory as PIO only reaches user memory while its address space is loaded
+ */
+void AdvancedTechnologyAttachment::Submit(ATARequest* request) {
+
+    request -> device = this;
+    request -> addressSpace = PageManager::activePageManager == 0 ? 0 : PageManager::activePageManager -> CurrentAddressSpace();
+    channel -> Submit(request);
+
+}
+
+/**
+ * @details Queue a request and wait for it, other threads run in the meantime
+ * @param request The request
+ * @return Its result
+ */
+int AdvancedTechnologyAttachment::Execute(ATARequest* request) {
+
+    request -> callback = 0;
+    request -> context = 0;
+    Submit(request);
+    channel -> Wait(request);
+    return request -> result;
+
+}
+
+/**
+ * @details Read sectors from the device, with DMA if possible. Otherwise up to 256 (65536 with LBA48) sectors are moved per command and the device's block size per data request
+ * @param lba The first sector
+ * @param count How many sectors to read
+ * @param buffer Where to put them, count * 512 bytes
+ * @return The amount of sectors read, -1 if the first command failed
+ */
+int AdvancedTechnologyAttachment::Read(uint64_t lba, uint32_t count, uint8_t* buffer) {
+
+    ATARequest request;
+    request.operation = ATA_REQUEST_READ;
+    request.lba = lba;
+    request.count = count;
+    request.buffer = buffer;
+    request.segments = 0;
+    return Execute(&request);
+
+}
+
+/**
+ * @details Write sectors to the device, with DMA if possible. Otherwise up to 256 (65536 with LBA48) sectors are moved per command and the device's block size per data request
+ * @param lba The first sector
+ * @param count How many sectors to write
+ * @param buffer The data, count * 512 bytes
+ * @return The amount of sectors written, -1 if the first command failed
+ */
+int AdvancedTechnologyAttachment::Write(uint64_t lba, uint32_t count, uint8_t* buffer) {
+
+    ATARequest request;
+    request.operation = ATA_REQUEST_WRITE;
+    request.lba = lba;
+    request.count = count;
+    request.buffer = buffer;
+    request.segments = 0;
+    return Execute(&request);
 
 }
+
 /**
  * @details Flush the ATA device
  */
 void AdvancedTechnologyAttachment::Flush() {
 
-    devicePort.Write(master ? 0xE0 : 0xF0);     //Select Device Master(0xE0) / Slave(0xF0)
+    if(!present)
+        return;
 
-    commandPort.Write(0xE7);                   //Command For Flushing
+    ATARequest request;
+    request.operation = ATA_REQUEST_COMMAND;
+    request.command = identity.lba48 ? ATA_FLUSH_CACHE_EXT : ATA_FLUSH_CACHE;
+    request.count = 0;
+    request.segments = 0;
+    Execute(&request);
 
-    uint8_t status = commandPort.Read();                     //Read Status
-    if(status == 0x00){                              //IF status is 0x00 then there is no device
-        printf("No Device");
-        return;                                      //There is no slave/master
-    }
+}
+/**
+ * @details Send a request of the block layer to the channel, the transfers it is made of are the scatter list
+ * @param request The request
+ */
+void AdvancedTechnologyAttachment::StartRequest(BlockRequest* request) {
 
-    //Can take a while for there to be an answer to the flush command,
-    while (
-            ((status & 0x80) == 0x80)                 //Device is busy
-            &&
-            ((status & 0x01) != 0x01)                 //There was an error
-            )
-    {
-        status = commandPort.Read();
+    if(!present){
+        Complete(request, -1);
+        return;
     }
 
-    //Check for any errors
-    if(status & 0x01){
+    //The block layer never has more than blockQueueDepth requests out
+    ATARequest* ataRequest = 0;
+    for(int i = 0; i < blockQueueDepth && ataRequest == 0; ++i)
+        if(blockRequests[i].context == 0)
+            ataRequest = &blockRequests[i];
 
-        printf("ERROR");
+    if(ataRequest == 0){
+        Complete(request, -1);
         return;
+    }
+
+    ataRequest -> lba = request -> sector;
+    ataRequest -> count = request -> count;
+    ataRequest -> buffer = request -> head -> buffer;
+    ataRequest -> segments = request -> head;
+    ataRequest -> callback = BlockRequestDone;
+    ataRequest -> context = request;
+
+    switch (request -> operation) {
+
+        case BLOCK_READ:
+            ataRequest -> operation = ATA_REQUEST_READ;
+            break;
+
+        case BLOCK_WRITE:
+            ataRequest -> operation = ATA_REQUEST_WRITE;
+            break;
+
+        case BLOCK_FLUSH:
+            ataRequest -> operation = ATA_REQUEST_COMMAND;
+            ataRequest -> command = identity.lba48 ? ATA_FLUSH_CACHE_EXT : ATA_FLUSH_CACHE;
+            ataRequest -> count = 0;
+            ataRequest -> buffer = 0;
+            ataRequest -> segments = 0;
+            break;
+    }
+
+    Submit(ataRequest);
+}
+
+/**
+ * @details Hand a finished request back to the block layer
+ * @param request The ATA request that carried it
+ */
+void AdvancedTechnologyAttachment::BlockRequestDone(ATARequest* request) {
 
+    BlockRequest* blockRequest = (BlockRequest*)request -> context;
+    request -> context = 0;                             //Free for the next one, Complete may start it straight away
+    request -> device -> Complete(blockRequest, request -> result);
+
+}
+
+/**
+ * @details Check the channel for progress, for waits while interrupts are off
+ */
+void AdvancedTechnologyAttachment::Poll() {
+
+    channel -> Poll();
+
+}
+
+/**
+ * @details Read from the device for an IO ring, through the page cache if there is one
+ * @param buffer Where to put the data
+ * @param length The amount of bytes to read, a partial last sector is read through a bounce buffer
+ * @param offset The sector to read from
+ * @return The amount of bytes read, -1 if nothing could be read
+ */
+int32_t AdvancedTechnologyAttachment::Read(uint8_t* buffer, uint32_t length, uint32_t offset) {
+
+    if(PageCache::activePageCache != 0)
+        return PageCache::activePageCache -> Read(this, (uint64_t)offset * bytesPerSector, buffer, length);
+
+    uint32_t fullSectors = length / bytesPerSector;
+    uint32_t remainder = length % bytesPerSector;
+
+    if(fullSectors > 0 && Read(offset, fullSectors, buffer) != (int)fullSectors)
+        return -1;
+
+    if(remainder != 0){
+
+        uint8_t sector[512];
+        if(Read(offset + fullSectors, 1, sector) != 1)
+            return fullSectors == 0 ? -1 : fullSectors * bytesPerSector;
+
+        for(uint32_t i = 0; i < remainder; ++i)
+            buffer[fullSectors * bytesPerSector + i] = sector[i];
+    }
+
+    return length;
+
+}
+
+/**
+ * @details Write to the device from an IO ring. With a page cache the data is written back later, otherwise straight away
+ * @param buffer The data to write
+ * @param length The amount of bytes to write, without a page cache a partial last sector is padded with zeros
+ * @param offset The sector to write to
+ * @return The amount of bytes written, -1 if nothing could be written
+ */
+int32_t AdvancedTechnologyAttachment::Write(uint8_t* buffer, uint32_t length, uint32_t offset) {
+
+    if(PageCache::activePageCache != 0)
+        return PageCache::activePageCache -> Write(this, (uint64_t)offset * bytesPerSector, buffer, length);
+
+    uint32_t fullSectors = length / bytesPerSector;
+    uint32_t remainder = length % bytesPerSector;
+
+    if(fullSectors > 0 && Write(offset, fullSectors, buffer) != (int)fullSectors)
+        return -1;
+
+    if(remainder != 0){
+
+        uint8_t sector[512];
+        for(uint32_t i = 0; i < bytesPerSector; ++i)
+            sector[i] = i < remainder ? buffer[fullSectors * bytesPerSector + i] : 0;
+
+        if(Write(offset + fullSectors, 1, sector) != 1)
+            return fullSectors == 0 ? -1 : fullSectors * bytesPerSector;
     }
 
-    //Flush complete
+    return length;
+
 }
 
+/**
+ * @details Flush the device from an IO ring, writing back its dirty cached pages first
+ * @return 0, -1 if the pages couldn't be written back
+ */
+int32_t AdvancedTechnologyAttachment::Sync() {
+
+    if(PageCache::activePageCache != 0)
+        return PageCache::activePageCache -> Sync(this);
 
+    Flush();
+    return 0;
+
+}
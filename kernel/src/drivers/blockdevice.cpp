@@ -0,0 +1,957 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#include <drivers/blockdevice.h>
+#include <system/clock.h>
+#include <hardwarecommunication/interrupts.h>
+
+using namespace maxOS;
+using namespace maxOS::common;
+using namespace maxOS::hardwarecommunication;
+using namespace maxOS::drivers;
+using namespace maxOS::system;
+
+///__SCHEDULER__
+
+IOScheduler::IOScheduler() {
+
+}
+
+IOScheduler::~IOScheduler() {
+
+}
+
+/**
+ * @details Link a request into a list sorted by sector, after the ones starting at the same sector
+ * @param head The first request of the list
+ * @param request The request
+ */
+void IOScheduler::InsertSorted(BlockRequest** head, BlockRequest* request) {
+
+    BlockRequest* previous = 0;
+    BlockRequest* current = *head;
+    while(current != 0 && current -> sector <= request -> sector){
+        previous = current;
+        current = current -> next;
+    }
+
+    request -> previous = previous;
+    request -> next = current;
+    if(current != 0)
+        current -> previous = request;
+    if(previous != 0)
+        previous -> next = request;
+    else
+        *head = request;
+
+}
+
+/**
+ * @details Take a request out of a list
+ * @param head The first request of the list
+ * @param request The request
+ */
+void IOScheduler::Unlink(BlockRequest** head, BlockRequest* request) {
+
+    if(request -> previous != 0)
+        request -> previous -> next = request -> next;
+    else
+        *head = request -> next;
+
+    if(request -> next != 0)
+        request -> next -> previous = request -> previous;
+
+    request -> next = 0;
+    request -> previous = 0;
+
+}
+
+/**
+ * @details Find a request that a range of sectors continues (back merge) or that continues the range (front merge)
+ * @param head The first request of the list to search
+ * @param operation What is done with the range
+ * @param sector The first sector of the range
+ * @param count How many sectors
+ * @param front Set to true if the range goes before the request
+ * @return The request, 0 if there is none
+ */
+BlockRequest* IOScheduler::FindAdjacent(BlockRequest* head, BlockOperation operation, uint64_t sector, uint32_t count, bool* front) {
+
+    for(BlockRequest* request = head; request != 0; request = request -> next){
+
+        if(request -> operation != operation)
+            continue;
+
+        if(request -> sector + request -> count == sector){
+            *front = false;
+            return request;
+        }
+
+        if(request -> sector == sector + count){
+            *front = true;
+            return request;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @details Get the name of the scheduler
+ * @return The name
+ */
+const char* IOScheduler::Name() {
+    return "none";
+}
+
+/**
+ * @details Queue a request
+ * @param request The request
+ */
+void IOScheduler::Add(BlockRequest*) {
+
+}
+
+/**
+ * @details Take a queued request out again (it was merged into another)
+ * @param request The request
+ */
+void IOScheduler::Remove(BlockRequest*) {
+
+}
+
+/**
+ * @details Take the request the driver should do next out of the queue
+ * @return The request, 0 if nothing is queued
+ */
+BlockRequest* IOScheduler::Next() {
+    return 0;
+}
+
+/**
+ * @details Find a queued request a range of sectors can be merged into
+ * @param operation What is done with the range
+ * @param sector The first sector of the range
+ * @param count How many sectors
+ * @param front Set to true if the range goes before the request
+ * @return The request, 0 if there is none
+ */
+BlockRequest* IOScheduler::FindMerge(BlockOperation, uint64_t, uint32_t, bool*) {
+    return 0;
+}
+
+/**
+ * @details Called after a queued request grew, so it can be moved to where it belongs now
+ * @param request The request
+ */
+void IOScheduler::Merged(BlockRequest*) {
+
+}
+
+///__NOOP__
+
+NoopIOScheduler::NoopIOScheduler() {
+
+    head = 0;
+    tail = 0;
+
+}
+
+NoopIOScheduler::~NoopIOScheduler() {
+
+}
+
+const char* NoopIOScheduler::Name() {
+    return "noop";
+}
+
+void NoopIOScheduler::Add(BlockRequest* request) {
+
+    request -> next = 0;
+    request -> previous = tail;
+    if(tail != 0)
+        tail -> next = request;
+    else
+        head = request;
+    tail = request;
+
+}
+
+void NoopIOScheduler::Remove(BlockRequest* request) {
+
+    if(tail == request)
+        tail = request -> previous;
+    Unlink(&head, request);
+
+}
+
+BlockRequest* NoopIOScheduler::Next() {
+
+    BlockRequest* request = head;
+    if(request != 0)
+        Remove(request);
+
+    return request;
+}
+
+BlockRequest* NoopIOScheduler::FindMerge(BlockOperation operation, uint64_t sector, uint32_t count, bool* front) {
+    return FindAdjacent(head, operation, sector, count, front);
+}
+
+///__C-LOOK__
+
+CLOOKIOScheduler::CLOOKIOScheduler() {
+
+    sorted = 0;
+    position = 0;
+
+}
+
+CLOOKIOScheduler::~CLOOKIOScheduler() {
+
+}
+
+const char* CLOOKIOScheduler::Name() {
+    return "c-look";
+}
+
+void CLOOKIOScheduler::Add(BlockRequest* request) {
+    InsertSorted(&sorted, request);
+}
+
+void CLOOKIOScheduler::Remove(BlockRequest* request) {
+    Unlink(&sorted, request);
+}
+
+/**
+ * @details Continue the sweep from where the last request ended, wrapping around to the lowest sector at the end
+ * @return The request, 0 if nothing is queued
+ */
+BlockRequest* CLOOKIOScheduler::Next() {
+
+    BlockRequest* request = sorted;
+    while(request != 0 && request -> sector < position)
+        request = request -> next;
+
+    if(request == 0)
+        request = sorted;
+
+    if(request == 0)
+        return 0;
+
+    position = request -> sector + request -> count;
+    Remove(request);
+    return request;
+}
+
+BlockRequest* CLOOKIOScheduler::FindMerge(BlockOperation operation, uint64_t sector, uint32_t count, bool* front) {
+    return FindAdjacent(sorted, operation, sector, count, front);
+}
+
+void CLOOKIOScheduler::Merged(BlockRequest* request) {
+
+    //A front merge moves the start of the request back
+    Unlink(&sorted, request);
+    InsertSorted(&sorted, request);
+
+}
+
+///__DEADLINE__
+
+DeadlineIOScheduler::DeadlineIOScheduler() {
+
+    for(int i = 0; i < 2; ++i){
+        sorted[i] = 0;
+        fifoHead[i] = 0;
+        fifoTail[i] = 0;
+        nextRequest[i] = 0;
+    }
+
+    direction = 0;
+    batched = 0;
+    starved = 0;
+
+}
+
+DeadlineIOScheduler::~DeadlineIOScheduler() {
+
+}
+
+const char* DeadlineIOScheduler::Name() {
+    return "deadline";
+}
+
+/**
+ * @details Get which of the queues requests of an operation go in
+ * @param operation The operation
+ * @return 0 for reads, 1 for writes
+ */
+int DeadlineIOScheduler::Direction(BlockOperation operation) {
+    return operation == BLOCK_WRITE ? 1 : 0;
+}
+
+/**
+ * @details Check if the oldest request going one way is past its deadline
+ * @param direction 0 for reads, 1 for writes
+ * @return True if it is
+ */
+bool DeadlineIOScheduler::Expired(int direction) {
+    return fifoHead[direction] != 0 && Clock::ReadTimestampCounter() >= fifoHead[direction] -> deadline;
+}
+
+/**
+ * @details Link a request into the expiry queue, which is kept in deadline order
+ * @param direction 0 for reads, 1 for writes
+ * @param request The request
+ */
+void DeadlineIOScheduler::InsertFIFO(int direction, BlockRequest* request) {
+
+    //Nearly always goes at the end, merged requests can have an earlier deadline
+    BlockRequest* after = fifoTail[direction];
+    while(after != 0 && after -> deadline > request -> deadline)
+        after = after -> fifoPrevious;
+
+    request -> fifoPrevious = after;
+    request -> fifoNext = after == 0 ? fifoHead[direction] : after -> fifoNext;
+
+    if(request -> fifoNext != 0)
+        request -> fifoNext -> fifoPrevious = request;
+    else
+        fifoTail[direction] = request;
+
+    if(after != 0)
+        after -> fifoNext = request;
+    else
+        fifoHead[direction] = request;
+
+}
+
+/**
+ * @details Take a request out of the expiry queue
+ * @param direction 0 for reads, 1 for writes
+ * @param request The request
+ */
+void DeadlineIOScheduler::UnlinkFIFO(int direction, BlockRequest* request) {
+
+    if(request -> fifoPrevious != 0)
+        request -> fifoPrevious -> fifoNext = request -> fifoNext;
+    else
+        fifoHead[direction] = request -> fifoNext;
+
+    if(request -> fifoNext != 0)
+        request -> fifoNext -> fifoPrevious = request -> fifoPrevious;
+    else
+        fifoTail[direction] = request -> fifoPrevious;
+
+    request -> fifoNext = 0;
+    request -> fifoPrevious = 0;
+
+}
+
+void DeadlineIOScheduler::Add(BlockRequest* request) {
+
+    int queue = Direction(request -> operation);
+    uint32_t expire = readExpire;
+    if(queue == 1)
+        expire = writeExpire;
+
+    //The clock isn't calibrated until late in boot, assume 1GHz until then
+    uint64_t ticks = Clock::activeClock != 0 ? Clock::activeClock -> MicrosecondsToTicks(expire) : (uint64_t)expire * 1000;
+    request -> deadline = request -> submitted + ticks;
+
+    InsertSorted(&sorted[queue], request);
+    InsertFIFO(queue, request);
+
+}
+
+void DeadlineIOScheduler::Remove(BlockRequest* request) {
+
+    int queue = Direction(request -> operation);
+    if(nextRequest[queue] == request)
+        nextRequest[queue] = request -> next;
+
+    Unlink(&sorted[queue], request);
+    UnlinkFIFO(queue, request);
+
+}
+
+/**
+ * @details Continue the batch in sector order, or start a new one: reads unless writes were passed over too often, from the oldest request if it expired
+ * @return The request, 0 if nothing is queued
+ */
+BlockRequest* DeadlineIOScheduler::Next() {
+
+    BlockRequest* request = 0;
+    if(batched < fifoBatch)
+        request = nextRequest[direction];
+
+    if(request == 0){
+
+        bool reads = sorted[0] != 0;
+        bool writes = sorted[1] != 0;
+        if(!reads && !writes)
+            return 0;
+
+        if(reads && (!writes || starved < writesStarved)){
+            direction = 0;
+            if(writes)
+                starved++;
+        }
+        else
+        {
+            direction = 1;
+            starved = 0;
+        }
+
+        request = nextRequest[direction];
+        if(request == 0 || Expired(direction))
+            request = fifoHead[direction];
+
+        batched = 0;
+    }
+
+    batched++;
+    nextRequest[direction] = request -> next;
+    Remove(request);
+    return request;
+}
+
+BlockRequest* DeadlineIOScheduler::FindMerge(BlockOperation operation, uint64_t sector, uint32_t count, bool* front) {
+    return FindAdjacent(sorted[Direction(operation)], operation, sector, count, front);
+}
+
+void DeadlineIOScheduler::Merged(BlockRequest* request) {
+
+    int queue = Direction(request -> operation);
+
+    Unlink(&sorted[queue], request);
+    InsertSorted(&sorted[queue], request);
+
+    UnlinkFIFO(queue, request);
+    InsertFIFO(queue, request);
+
+}
+
+///__BLOCK DEVICE__
+
+BlockDevice::BlockDevice() {
+
+    limits.sectorSize = 512;
+    limits.maxSectors = 256;
+    limits.maxDepth = 1;
+    capacity = 0;
+
+    scheduler = &defaultScheduler;
+
+    freeRequests = 0;
+    for(int i = maxRequests - 1; i >= 0; --i){
+        requests[i].next = freeRequests;
+        freeRequests = &requests[i];
+    }
+
+    heldHead = 0;
+    heldTail = 0;
+    barrier = 0;
+    barrierIssued = false;
+    plugged = 0;
+    running = false;
+
+    statistics.reads = 0;
+    statistics.writes = 0;
+    statistics.flushes = 0;
+    statistics.sectorsRead = 0;
+    statistics.sectorsWritten = 0;
+    statistics.submitted = 0;
+    statistics.merges = 0;
+    statistics.errors = 0;
+    statistics.queued = 0;
+    statistics.inFlight = 0;
+    statistics.queueTicks = 0;
+    statistics.serviceTicks = 0;
+
+}
+
+BlockDevice::~BlockDevice() {
+
+}
+
+/**
+ * @details Take a request from the pool and start it off with one transfer
+ * @param io The transfer
+ * @return The request, 0 if the pool is empty
+ */
+BlockRequest* BlockDevice::AllocateRequest(BlockIO* io) {
+
+    BlockRequest* request = freeRequests;
+    if(request == 0)
+        return 0;
+    freeRequests = request -> next;
+
+    io -> next = 0;
+    request -> operation = io -> operation;
+    request -> sector = io -> sector;
+    request -> count = io -> count;
+    request -> head = io;
+    request -> tail = io;
+    request -> submitted = io -> submitted;
+    request -> deadline = 0;
+    request -> dispatched = 0;
+    request -> next = 0;
+    request -> previous = 0;
+    request -> fifoNext = 0;
+    request -> fifoPrevious = 0;
+
+    return request;
+}
+
+/**
+ * @details Put a request back into the pool
+ * @param request The request
+ */
+void BlockDevice::FreeRequest(BlockRequest* request) {
+
+    request -> next = freeRequests;
+    freeRequests = request;
+
+}
+
+/**
+ * @details Merge a transfer into a queued request or queue a new one for it
+ * @param io The transfer
+ * @return False if there was no free request
+ */
+bool BlockDevice::Queue(BlockIO* io) {
+
+    if(io -> operation != BLOCK_FLUSH && Merge(io))
+        return true;
+
+    BlockRequest* request = AllocateRequest(io);
+    if(request == 0)
+        return false;
+
+    //A flush isn't sorted, it waits until everything before it is done
+    if(io -> operation == BLOCK_FLUSH){
+        barrier = request;
+        barrierIssued = false;
+        return true;
+    }
+
+    scheduler -> Add(request);
+    statistics.queued++;
+    return true;
+}
+
+/**
+ * @details Add a transfer to the start or end of a queued request it is next to
+ * @param io The transfer
+ * @return True if it was merged
+ */
+bool BlockDevice::Merge(BlockIO* io) {
+
+    bool front;
+    BlockRequest* request = scheduler -> FindMerge(io -> operation, io -> sector, io -> count, &front);
+    if(request == 0 || request -> count + io -> count > limits.maxSectors)
+        return false;
+
+    if(front){
+        io -> next = request -> head;
+        request -> head = io;
+        request -> sector = io -> sector;
+    }
+    else
+    {
+        io -> next = 0;
+        request -> tail -> next = io;
+        request -> tail = io;
+    }
+
+    request -> count += io -> count;
+    statistics.merges++;
+    scheduler -> Merged(request);
+
+    //The transfer may have filled the gap to the next request
+    Coalesce(request);
+    return true;
+}
+
+/**
+ * @details Join a request that just grew with a queued request it now touches
+ * @param request The request
+ */
+void BlockDevice::Coalesce(BlockRequest* request) {
+
+    bool front;
+    BlockRequest* other = scheduler -> FindMerge(request -> operation, request -> sector, request -> count, &front);
+    if(other == 0 || other -> count + request -> count > limits.maxSectors)
+        return;
+
+    scheduler -> Remove(request);
+    statistics.queued--;
+
+    if(front){
+        request -> tail -> next = other -> head;
+        other -> head = request -> head;
+        other -> sector = request -> sector;
+    }
+    else
+    {
+        other -> tail -> next = request -> head;
+        other -> tail = request -> tail;
+    }
+
+    other -> count += request -> count;
+    if(request -> submitted < other -> submitted)
+        other -> submitted = request -> submitted;
+    if(request -> deadline < other -> deadline)
+        other -> deadline = request -> deadline;
+
+    statistics.merges++;
+    FreeRequest(request);
+    scheduler -> Merged(other);
+
+}
+
+/**
+ * @details Queue held transfers now that a flush completed or requests were freed, in the order they came in
+ */
+void BlockDevice::ReleaseHeld() {
+
+    while(heldHead != 0 && barrier == 0){
+
+        BlockIO* io = heldHead;
+        BlockIO* rest = io -> next;
+        if(!Queue(io)){
+            io -> next = rest;
+            return;
+        }
+
+        heldHead = rest;
+        if(heldHead == 0)
+            heldTail = 0;
+    }
+}
+
+/**
+ * @details Hand requests to the driver until it is full, a pending flush goes once everything before it completed
+ */
+void BlockDevice::Run() {
+
+    //A request can complete while it is started, the outer call keeps going
+    if(plugged > 0 || running)
+        return;
+    running = true;
+
+    bool started = false;
+    while(statistics.inFlight < limits.maxDepth){
+
+        BlockRequest* request = scheduler -> Next();
+        if(request != 0){
+            statistics.queued--;
+        }
+        else
+        {
+            if(barrier == 0 || barrierIssued || statistics.inFlight > 0)
+                break;
+
+            request = barrier;
+            barrierIssued = true;
+        }
+
+        request -> dispatched = Clock::ReadTimestampCounter();
+        statistics.queueTicks += request -> dispatched - request -> submitted;
+        statistics.inFlight++;
+
+        switch (request -> operation) {
+            case BLOCK_READ:  statistics.reads++;   break;
+            case BLOCK_WRITE: statistics.writes++;  break;
+            case BLOCK_FLUSH: statistics.flushes++; break;
+        }
+
+        StartRequest(request);
+        started = true;
+    }
+
+    if(started)
+        CommitRequests();
+
+    running = false;
+}
+
+/**
+ * @details Called by the driver once a request is done (usually from its IRQ handler), the result is split over the transfers in sector order
+ * @param request The request
+ * @param result The amount of sectors moved (0 for a flush that worked), -1 if it failed
+ */
+void BlockDevice::Complete(BlockRequest* request, int result) {
+
+    uint32_t flags = DisableInterrupts();
+
+    statistics.inFlight--;
+    statistics.serviceTicks += Clock::ReadTimestampCounter() - request -> dispatched;
+
+    uint32_t moved = result < 0 ? 0 : result;
+    if(result < 0 || moved < request -> count)
+        statistics.errors++;
+    if(request -> operation == BLOCK_READ)
+        statistics.sectorsRead += moved;
+    if(request -> operation == BLOCK_WRITE)
+        statistics.sectorsWritten += moved;
+
+    if(request == barrier){
+        barrier = 0;
+        barrierIssued = false;
+    }
+
+    //Free the request first so the callbacks can submit more
+    BlockOperation operation = request -> operation;
+    BlockIO* io = request -> head;
+    FreeRequest(request);
+
+    while(io != 0){
+
+        BlockIO* next = io -> next;
+
+        if(operation == BLOCK_FLUSH){
+            io -> result = result < 0 ? -1 : 0;
+        }
+        else if(moved >= io -> count){
+            io -> result = io -> count;
+            moved -= io -> count;
+        }
+        else
+        {
+            io -> result = moved == 0 ? -1 : (int)moved;
+            moved = 0;
+        }
+
+        io -> complete = true;
+        if(io -> callback != 0)
+            io -> callback(io);
+
+        io = next;
+    }
+
+    ReleaseHeld();
+    Run();
+
+    RestoreInterrupts(flags);
+}
+
+/**
+ * @details Start a request on the device, drivers override this. It is called with interrupts off and has to end in Complete
+ * @param request The request
+ */
+void BlockDevice::StartRequest(BlockRequest* request) {
+
+    Complete(request, -1);
+
+}
+
+/**
+ * @details Called after a batch of StartRequest calls, drivers that can tell the device about several requests at once (one doorbell write) do it here
+ */
+void BlockDevice::CommitRequests() {
+
+}
+
+/**
+ * @details Check the device for finished requests, drivers override this so waits work while interrupts are off (during boot)
+ */
+void BlockDevice::Poll() {
+
+}
+
+/**
+ * @details Queue a transfer, it completes in the background and calls its callback
+ * @param io The transfer, it has to stay valid until it is complete
+ */
+void BlockDevice::SubmitIO(BlockIO* io) {
+
+    io -> complete = false;
+    io -> result = -1;
+    io -> next = 0;
+    io -> submitted = Clock::ReadTimestampCounter();
+
+    if(io -> operation != BLOCK_FLUSH && (io -> count == 0 || io -> sector + io -> count > capacity)){
+        io -> complete = true;
+        if(io -> callback != 0)
+            io -> callback(io);
+        return;
+    }
+
+    uint32_t flags = DisableInterrupts();
+    statistics.submitted++;
+
+    //Nothing overtakes a pending flush or transfers that are already held
+    if(heldHead != 0 || barrier != 0 || !Queue(io)){
+        if(heldTail != 0)
+            heldTail -> next = io;
+        else
+            heldHead = io;
+        heldTail = io;
+    }
+
+    Run();
+    RestoreInterrupts(flags);
+}
+
+/**
+ * @details Wait for a transfer to complete, other threads run until the IRQ arrives. While booting interrupts are off so the device is polled instead
+ * @param io The transfer
+ */
+void BlockDevice::Wait(BlockIO* io) {
+
+    while(!io -> complete){
+
+        uint32_t flags = DisableInterrupts();
+        Poll();
+
+        if(!(flags & (1 << 9)) || io -> complete){
+            RestoreInterrupts(flags);
+            continue;
+        }
+
+        //sti only takes effect after the next instruction, so the IRQ can't slip in between the check and the hlt
+        asm volatile("sti\n hlt");
+    }
+}
+
+/**
+ * @details Read sectors through the queue and wait for them
+ * @param sector The first sector
+ * @param count How many sectors
+ * @param buffer Where to put them, kernel memory
+ * @return The amount of sectors read, -1 if none were
+ */
+int BlockDevice::ReadSectors(uint64_t sector, uint32_t count, uint8_t* buffer) {
+
+    BlockIO io;
+    io.operation = BLOCK_READ;
+    io.sector = sector;
+    io.count = count;
+    io.buffer = buffer;
+    io.callback = 0;
+    io.context = 0;
+
+    SubmitIO(&io);
+    Wait(&io);
+    return io.result;
+
+}
+
+/**
+ * @details Write sectors through the queue and wait for them
+ * @param sector The first sector
+ * @param count How many sectors
+ * @param buffer The data, kernel memory
+ * @return The amount of sectors written, -1 if none were
+ */
+int BlockDevice::WriteSectors(uint64_t sector, uint32_t count, uint8_t* buffer) {
+
+    BlockIO io;
+    io.operation = BLOCK_WRITE;
+    io.sector = sector;
+    io.count = count;
+    io.buffer = buffer;
+    io.callback = 0;
+    io.context = 0;
+
+    SubmitIO(&io);
+    Wait(&io);
+    return io.result;
+
+}
+
+/**
+ * @details Wait until everything written so far is on the device
+ * @return 0 if it worked, -1 otherwise
+ */
+int BlockDevice::FlushCache() {
+
+    BlockIO io;
+    io.operation = BLOCK_FLUSH;
+    io.sector = 0;
+    io.count = 0;
+    io.buffer = 0;
+    io.callback = 0;
+    io.context = 0;
+
+    SubmitIO(&io);
+    Wait(&io);
+    return io.result;
+
+}
+
+/**
+ * @details Hold requests back while a batch of transfers is submitted, so they can be merged before the driver sees any of them
+ */
+void BlockDevice::Plug() {
+
+    uint32_t flags = DisableInterrupts();
+    plugged++;
+    RestoreInterrupts(flags);
+
+}
+
+/**
+ * @details End a batch started with Plug and let the driver have the requests
+ */
+void BlockDevice::Unplug() {
+
+    uint32_t flags = DisableInterrupts();
+    if(plugged > 0)
+        plugged--;
+    Run();
+    RestoreInterrupts(flags);
+
+}
+
+/**
+ * @details Change the scheduler, the queued requests are moved over to it
+ * @param scheduler The new scheduler, it has to stay valid as long as the device is used
+ */
+void BlockDevice::SetScheduler(IOScheduler* scheduler) {
+
+    uint32_t flags = DisableInterrupts();
+
+    BlockRequest* request;
+    while((request = this -> scheduler -> Next()) != 0)
+        scheduler -> Add(request);
+
+    this -> scheduler = scheduler;
+    RestoreInterrupts(flags);
+
+}
+
+/**
+ * @details Get the scheduler in use
+ * @return The scheduler
+ */
+IOScheduler* BlockDevice::Scheduler() {
+    return scheduler;
+}
+
+/**
+ * @details Get what the driver can take
+ * @return The limits
+ */
+BlockQueueLimits* BlockDevice::Limits() {
+    return &limits;
+}
+
+/**
+ * @details Get the size of the device
+ * @return The amount of sectors
+ */
+uint64_t BlockDevice::Capacity() {
+    return capacity;
+}
+
+/**
+ * @details Get the counters of the device
+ * @return The statistics
+ */
+BlockDeviceStatistics* BlockDevice::Statistics() {
+    return &statistics;
+}
@@ -3,8 +3,28 @@
 //
 
 #include <drivers/driver.h>
-//using namespace maxOS::common;
+#include <system/boottime.h>
+#include <hardwarecommunication/interrupts.h>
+using namespace maxOS::common;
+using namespace maxOS::hardwarecommunication;
 using namespace maxOS::drivers;
+using namespace maxOS::system;
+
+/**
+ * @details Wait a little for another thread to make progress: sleep until the next interrupt, or spin if interrupts are off (e.g. in a
+ * syscall) as nothing would wake the CPU up from a halt then
+ */
+static void Pause(){
+
+    uint32_t flags = DisableInterrupts();
+    if(!(flags & (1 << 9))){
+        asm volatile("pause");
+        return;
+    }
+
+    //sti only takes effect after the next instruction, so the interrupt can't slip in between the sti and the hlt
+    asm volatile("sti\n hlt");
+}
 
 Driver::Driver(){
 
@@ -26,23 +46,170 @@ int Driver::Reset(){
 
 }
 
+DriverManager* DriverManager::activeDriverManager = 0;
+
 DriverManager::DriverManager(){
     numDrivers = 0;
+    activeDriverManager = this;
+}
+
+DriverManager::~DriverManager(){
+    if(activeDriverManager == this)
+        activeDriverManager = 0;
 }
 
 /**
  * @details This function adds a driver to the driver manager
  * @param driver The driver to add
+ * @param required If boot has to wait for the driver to be activated, otherwise it is left to the worker threads
+ * @return The index of the driver (used to declare dependencies), -1 if there is no space
  */
-void DriverManager::AddDriver(Driver* drv){
+int DriverManager::AddDriver(Driver* drv, bool required){
+
+    if(numDrivers >= 255)
+        return -1;
+
     drivers[numDrivers] = drv;
-    numDrivers++;
+    states[numDrivers] = DRIVER_PENDING;
+    this -> required[numDrivers] = required;
+    numDependencies[numDrivers] = 0;
+    return numDrivers++;
+}
+
+/**
+ * @details Make a driver wait for another one to be active before it is activated (e.g. two devices sharing the same ports)
+ * @param driver The driver that has to wait
+ * @param dependency The driver it waits for, it must have been added before it (so there can't be a cycle)
+ * @return True if the dependency was added
+ */
+bool DriverManager::AddDependency(int driver, int dependency){
+
+    if(driver < 0 || driver >= numDrivers || dependency < 0 || dependency >= driver || numDependencies[driver] >= maxDependencies)
+        return false;
+
+    dependencies[driver][numDependencies[driver]++] = dependency;
+
+    //Boot can't wait for a driver without also waiting for what it needs
+    if(required[driver])
+        required[dependency] = true;
+
+    return true;
+}
+
+/**
+ * @details Check if everything a driver needs is active
+ * @param driver The driver
+ * @return True if it can be activated
+ */
+bool DriverManager::DependenciesActive(int driver){
+
+    for(int i = 0; i < numDependencies[driver]; ++i)
+        if(states[dependencies[driver][i]] != DRIVER_ACTIVE)
+            return false;
+
+    return true;
+}
+
+/**
+ * @details Take a pending driver so that no other thread activates it too
+ * @param driver The driver
+ * @return True if this thread has to activate it
+ */
+bool DriverManager::Claim(int driver){
+    return __sync_bool_compare_and_swap(&states[driver], DRIVER_PENDING, DRIVER_ACTIVATING);
 }
+
+/**
+ * @details Activate a claimed driver and time it as a boot probe
+ * @param driver The driver
+ */
+void DriverManager::Activate(int driver){
+
+    int probe = BootTimeline::BeginProbe("driver", driver);
+    drivers[driver]->Activate();
+    BootTimeline::EndProbe(probe);
+
+    states[driver] = DRIVER_ACTIVE;
+}
+
 /**
  * @details This function activates all the drivers in the driver manager
  */
 void DriverManager::ActivateAll(){
+
+    //Dependencies always come first, so in order is a valid order
+    for(int i = 0; i < numDrivers; i++)
+        WaitFor(i);
+}
+
+/**
+ * @details Activate the drivers boot has to wait for, the others are left pending for the worker threads
+ */
+void DriverManager::ActivateRequired(){
+
+    for(int i = 0; i < numDrivers; i++)
+        if(required[i])
+            WaitFor(i);
+}
+
+/**
+ * @details Activate every pending driver whose dependencies are active
+ * @return How many drivers this call activated
+ */
+int DriverManager::ActivatePending(){
+
+    int activated = 0;
     for(int i = 0; i < numDrivers; i++){
-        drivers[i]->Activate();
+        if(states[i] != DRIVER_PENDING || !DependenciesActive(i) || !Claim(i))
+            continue;
+
+        Activate(i);
+        activated++;
     }
+
+    return activated;
+}
+
+/**
+ * @details Check if a driver has been activated
+ * @param driver The driver
+ * @return True if it is active
+ */
+bool DriverManager::IsActive(int driver){
+    return driver >= 0 && driver < numDrivers && states[driver] == DRIVER_ACTIVE;
+}
+
+/**
+ * @details Make sure a driver is active before using it, activating it (and what it depends on) here if no one else has yet
+ * @param driver The driver
+ */
+void DriverManager::WaitFor(int driver){
+
+    if(driver < 0 || driver >= numDrivers)
+        return;
+
+    for(int i = 0; i < numDependencies[driver]; ++i)
+        WaitFor(dependencies[driver][i]);
+
+    if(Claim(driver)){
+        Activate(driver);
+        return;
+    }
+
+    //A worker thread is activating it, that only happens once the scheduler is running so this thread will be switched away from
+    while(states[driver] != DRIVER_ACTIVE)
+        Pause();
+}
+
+/**
+ * @details A worker thread: activates the drivers boot didn't wait for as their dependencies become active, several can run at once
+ */
+void DriverManager::Worker(){
+
+    while(true){
+
+        if(activeDriverManager == 0 || activeDriverManager -> ActivatePending() == 0)
+            Pause();
+    }
+
 }
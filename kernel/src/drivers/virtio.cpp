@@ -0,0 +1,788 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#include <drivers/virtio.h>
+#include <system/paging.h>
+
+using namespace maxOS;
+using namespace maxOS::common;
+using namespace maxOS::hardwarecommunication;
+using namespace maxOS::drivers;
+using namespace maxOS::system;
+
+//The common configuration of a modern device
+enum VirtualIOCommonRegister{
+    VIRTIO_COMMON_DEVICE_FEATURE_SELECT = 0,
+    VIRTIO_COMMON_DEVICE_FEATURE = 4,
+    VIRTIO_COMMON_DRIVER_FEATURE_SELECT = 8,
+    VIRTIO_COMMON_DRIVER_FEATURE = 12,
+    VIRTIO_COMMON_CONFIG_VECTOR = 16,
+    VIRTIO_COMMON_NUM_QUEUES = 18,
+    VIRTIO_COMMON_DEVICE_STATUS = 20,
+    VIRTIO_COMMON_CONFIG_GENERATION = 21,
+    VIRTIO_COMMON_QUEUE_SELECT = 22,
+    VIRTIO_COMMON_QUEUE_SIZE = 24,
+    VIRTIO_COMMON_QUEUE_VECTOR = 26,
+    VIRTIO_COMMON_QUEUE_ENABLE = 28,
+    VIRTIO_COMMON_QUEUE_NOTIFY_OFFSET = 30,
+    VIRTIO_COMMON_QUEUE_DESCRIPTORS = 32,
+    VIRTIO_COMMON_QUEUE_AVAILABLE = 40,
+    VIRTIO_COMMON_QUEUE_USED = 48
+};
+
+//The I/O registers of a legacy device
+enum VirtualIOLegacyRegister{
+    VIRTIO_LEGACY_DEVICE_FEATURES = 0,
+    VIRTIO_LEGACY_DRIVER_FEATURES = 4,
+    VIRTIO_LEGACY_QUEUE_ADDRESS = 8,                            //Page number of the queue
+    VIRTIO_LEGACY_QUEUE_SIZE = 12,
+    VIRTIO_LEGACY_QUEUE_SELECT = 14,
+    VIRTIO_LEGACY_QUEUE_NOTIFY = 16,
+    VIRTIO_LEGACY_DEVICE_STATUS = 18,
+    VIRTIO_LEGACY_ISR = 19,
+    VIRTIO_LEGACY_CONFIG_VECTOR = 20,                           //Only there when MSI-X is on
+    VIRTIO_LEGACY_QUEUE_VECTOR = 22,
+    VIRTIO_LEGACY_CONFIG = 20
+};
+
+static const uint8_t PCI_CAPABILITY_VENDOR = 0x09;
+static const uint16_t VIRTIO_AVAILABLE_NO_INTERRUPT = 0x1;
+static const uint16_t VIRTIO_USED_NO_NOTIFY = 0x1;
+
+/**
+ * @details Order every earlier load and store before every later one, x86 only reorders a store with a later load
+ */
+static inline void MemoryBarrier(){
+
+    asm volatile("lock; addl $0, (%%esp)" : : : "memory");
+
+}
+
+static inline uint8_t Read8(volatile uint8_t* base, uint32_t offset){ return base[offset]; }
+static inline uint16_t Read16(volatile uint8_t* base, uint32_t offset){ return *(volatile uint16_t*)(base + offset); }
+static inline uint32_t Read32(volatile uint8_t* base, uint32_t offset){ return *(volatile uint32_t*)(base + offset); }
+static inline void Write8(volatile uint8_t* base, uint32_t offset, uint8_t value){ base[offset] = value; }
+static inline void Write16(volatile uint8_t* base, uint32_t offset, uint16_t value){ *(volatile uint16_t*)(base + offset) = value; }
+static inline void Write32(volatile uint8_t* base, uint32_t offset, uint32_t value){ *(volatile uint32_t*)(base + offset) = value; }
+
+///__QUEUE__
+
+/**
+ * @details Allocate and link up a queue, the device is told about it by VirtualIODevice::CreateQueue
+ * @param device The device it belongs to
+ * @param index Its number on the device
+ * @param size The amount of descriptors, a power of two
+ * @param eventIndex True if VIRTIO_F_EVENT_IDX was negotiated
+ * @param indirect True if VIRTIO_F_INDIRECT_DESC was negotiated
+ */
+VirtualIOQueue::VirtualIOQueue(VirtualIODevice* device, uint16_t index, uint16_t size, bool eventIndex, bool indirect) {
+
+    this -> device = device;
+    this -> index = index;
+    this -> size = size;
+    this -> eventIndex = eventIndex;
+    this -> indirect = indirect;
+    notifyOffset = 0;
+
+    freeHead = 0;
+    numFree = size;
+    nextAvailable = 0;
+    lastKicked = 0;
+    lastUsed = 0;
+
+    //The heap is identity mapped, so the block is physically contiguous and its address is the physical one
+    uint32_t length = UsedOffset(size) + 6 + size * sizeof(VirtualIOUsedElement);
+    memory = new uint8_t[length + PAGE_SIZE - 1];
+    indirectTables = indirect ? new VirtualIODescriptor[size * maxIndirect] : 0;
+    tokens = new void*[size];
+    if(!IsValid())
+        return;
+
+    uint8_t* base = (uint8_t*)(((uint32_t)memory + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1));
+    for(uint32_t i = 0; i < length; ++i)
+        base[i] = 0;
+
+    descriptors = (VirtualIODescriptor*)base;
+    available = (volatile uint16_t*)(base + size * sizeof(VirtualIODescriptor));
+    used = (volatile uint16_t*)(base + UsedOffset(size));
+    usedRing = (volatile VirtualIOUsedElement*)(used + 2);
+
+    for(uint16_t i = 0; i < size; ++i){
+        descriptors[i].next = i + 1;
+        tokens[i] = 0;
+    }
+
+}
+
+VirtualIOQueue::~VirtualIOQueue() {
+
+    if(memory != 0)
+        delete[] memory;
+    if(indirectTables != 0)
+        delete[] indirectTables;
+    if(tokens != 0)
+        delete[] tokens;
+
+}
+
+/**
+ * @details Where the used ring starts, legacy devices want it on the page after the available ring
+ * @param size The amount of descriptors
+ * @return The offset from the descriptor table
+ */
+uint32_t VirtualIOQueue::UsedOffset(uint16_t size) {
+
+    uint32_t availableEnd = size * sizeof(VirtualIODescriptor) + 6 + size * 2;
+    return (availableEnd + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1);
+
+}
+
+/**
+ * @details Check if the memory for the queue could be allocated
+ * @return True if it could
+ */
+bool VirtualIOQueue::IsValid() {
+    return memory != 0 && tokens != 0 && (!indirect || indirectTables != 0);
+}
+
+/**
+ * @details Get the queue's number on the device
+ * @return The number
+ */
+uint16_t VirtualIOQueue::Index() {
+    return index;
+}
+
+/**
+ * @details Get the amount of descriptors in the queue
+ * @return The amount
+ */
+uint16_t VirtualIOQueue::Size() {
+    return size;
+}
+
+/**
+ * @details Get the amount of descriptors not used by a chain
+ * @return The amount
+ */
+uint16_t VirtualIOQueue::NumFree() {
+    return numFree;
+}
+
+/**
+ * @details Check if chains take a single descriptor of the queue
+ * @return True if indirect descriptors are used
+ */
+bool VirtualIOQueue::HasIndirect() {
+    return indirect;
+}
+
+/**
+ * @details Put a chain of buffers in the available ring, the device only sees it after the next Kick
+ * @param buffers The buffers, the ones the device reads first
+ * @param count The amount of buffers
+ * @param token What NextUsed returns once the device is done with the chain
+ * @return The head descriptor, -1 if there aren't enough free descriptors
+ */
+int VirtualIOQueue::Add(VirtualIOBuffer* buffers, int count, void* token) {
+
+    if(count <= 0)
+        return -1;
+
+    //With an indirect table the chain takes one descriptor of the ring however long it is
+    bool useIndirect = indirect && count > 1 && count <= maxIndirect;
+    if(numFree < (useIndirect ? 1 : count))
+        return -1;
+
+    uint16_t head = freeHead;
+    if(useIndirect){
+
+        VirtualIODescriptor* table = &indirectTables[head * maxIndirect];
+        for(int i = 0; i < count; ++i){
+            table[i].address = buffers[i].address;
+            table[i].length = buffers[i].length;
+            table[i].flags = (buffers[i].deviceWrites ? VIRTIO_DESCRIPTOR_WRITE : 0) | (i < count - 1 ? VIRTIO_DESCRIPTOR_NEXT : 0);
+            table[i].next = i + 1;
+        }
+
+        descriptors[head].address = (uint32_t)table;
+        descriptors[head].length = count * sizeof(VirtualIODescriptor);
+        descriptors[head].flags = VIRTIO_DESCRIPTOR_INDIRECT;
+        freeHead = descriptors[head].next;
+        numFree--;
+    }
+    else
+    {
+        //The free list is linked with next already, so the chain just follows it
+        uint16_t current = head;
+        for(int i = 0; i < count; ++i){
+            descriptors[current].address = buffers[i].address;
+            descriptors[current].length = buffers[i].length;
+            descriptors[current].flags = (buffers[i].deviceWrites ? VIRTIO_DESCRIPTOR_WRITE : 0) | (i < count - 1 ? VIRTIO_DESCRIPTOR_NEXT : 0);
+
+            if(i == count - 1)
+                freeHead = descriptors[current].next;
+            current = descriptors[current].next;
+        }
+        numFree -= count;
+    }
+
+    tokens[head] = token;
+    available[2 + (nextAvailable & (size - 1))] = head;
+    nextAvailable++;
+
+    return head;
+}
+
+/**
+ * @details Publish the chains added since the last kick and notify the device, unless it said (with its event index or flags) it doesn't need to be
+ * @return True if the device was notified
+ */
+bool VirtualIOQueue::Kick() {
+
+    uint16_t old = lastKicked;
+    uint16_t now = nextAvailable;
+    if(old == now)
+        return false;
+
+    //The ring entries have to be visible before the index, and the index before the device's event is read
+    asm volatile("" : : : "memory");
+    available[1] = now;
+    MemoryBarrier();
+    lastKicked = now;
+
+    bool notify;
+    if(eventIndex){
+
+        //Only notify if the index the device wants to hear about was passed by this batch
+        uint16_t event = used[2 + size * 4];
+        notify = (uint16_t)(now - event - 1) < (uint16_t)(now - old);
+    }
+    else
+        notify = !(used[0] & VIRTIO_USED_NO_NOTIFY);
+
+    if(notify)
+        device -> Notify(this);
+
+    return notify;
+}
+
+/**
+ * @details Give a chain's descriptors back to the free list
+ * @param head The head descriptor
+ */
+void VirtualIOQueue::FreeChain(uint16_t head) {
+
+    uint16_t last = head;
+    uint16_t count = 1;
+    while(descriptors[last].flags & VIRTIO_DESCRIPTOR_NEXT){
+        last = descriptors[last].next;
+        count++;
+    }
+
+    descriptors[last].next = freeHead;
+    freeHead = head;
+    numFree += count;
+
+}
+
+/**
+ * @details Take the next chain the device is done with
+ * @param length Set to the bytes the device wrote (can be 0)
+ * @return The token the chain was added with, 0 if the device hasn't finished another one
+ */
+void* VirtualIOQueue::NextUsed(uint32_t* length) {
+
+    if(lastUsed == used[1])
+        return 0;
+
+    //x86 doesn't reorder loads, the element can't be read before the index
+    asm volatile("" : : : "memory");
+    volatile VirtualIOUsedElement* element = &usedRing[lastUsed & (size - 1)];
+    uint16_t head = element -> id;
+    if(length != 0)
+        *length = element -> length;
+    lastUsed++;
+
+    void* token = tokens[head];
+    tokens[head] = 0;
+    FreeChain(head);
+
+    return token;
+}
+
+/**
+ * @details Ask the device not to interrupt, while the used ring is being emptied anyway. With event indices not moving the used event is enough
+ */
+void VirtualIOQueue::DisableCallbacks() {
+
+    if(!eventIndex)
+        available[0] = VIRTIO_AVAILABLE_NO_INTERRUPT;
+
+}
+
+/**
+ * @details Ask the device to interrupt for the next chain it finishes, so a whole batch of completions costs one interrupt
+ * @return False if chains finished while they were off, they have to be taken before waiting for the interrupt
+ */
+bool VirtualIOQueue::EnableCallbacks() {
+
+    if(eventIndex)
+        available[2 + size] = lastUsed;
+    else
+        available[0] = 0;
+
+    MemoryBarrier();
+    return used[1] == lastUsed;
+}
+
+/**
+ * @details Get the physical address of the descriptor table
+ * @return The address
+ */
+uint32_t VirtualIOQueue::DescriptorAddress() {
+    return (uint32_t)descriptors;
+}
+
+/**
+ * @details Get the physical address of the available ring
+ * @return The address
+ */
+uint32_t VirtualIOQueue::AvailableAddress() {
+    return (uint32_t)available;
+}
+
+/**
+ * @details Get the physical address of the used ring
+ * @return The address
+ */
+uint32_t VirtualIOQueue::UsedAddress() {
+    return (uint32_t)used;
+}
+
+///__DEVICE__
+
+VirtualIODevice::VirtualIODevice(PeripheralComponentInterconnectDeviceDescriptor* device) {
+
+    this -> device = device;
+    modern = false;
+    msix = false;
+
+    ioBase = 0;
+    configOffset = VIRTIO_LEGACY_CONFIG;
+
+    commonConfig = 0;
+    notify = 0;
+    notifyMultiplier = 0;
+    isr = 0;
+    config = 0;
+
+    features = 0;
+
+}
+
+VirtualIODevice::~VirtualIODevice() {
+
+}
+
+/**
+ * @details Walk the PCI capabilities for the virtio ones and map the structures they point to
+ * @return True if the device has the modern interface and it could be mapped
+ */
+bool VirtualIODevice::FindCapabilities() {
+
+    PeripheralComponentInterconnectController* pci = PeripheralComponentInterconnectController::activeController;
+    if(PageManager::activePageManager == 0)
+        return false;
+
+    //Status bit 4: there is a capability list, it starts at 0x34
+    if(!((pci -> Read(device -> bus, device -> device, device -> function, 0x04) >> 16) & 0x10))
+        return false;
+
+    uint8_t pointer = pci -> Read(device -> bus, device -> device, device -> function, 0x34) & 0xFC;
+    for(int i = 0; pointer != 0 && i < 48; ++i){
+
+        uint32_t header = pci -> Read(device -> bus, device -> device, device -> function, pointer);
+        uint8_t next = (header >> 8) & 0xFC;
+
+        //Vendor capability: byte 3 is the type, byte 4 the BAR, then the offset and length in it
+        if((header & 0xFF) == PCI_CAPABILITY_VENDOR){
+
+            uint8_t type = (header >> 24) & 0xFF;
+            uint8_t bar = pci -> Read(device -> bus, device -> device, device -> function, pointer + 4) & 0xFF;
+            uint32_t offset = pci -> Read(device -> bus, device -> device, device -> function, pointer + 8);
+            uint32_t length = pci -> Read(device -> bus, device -> device, device -> function, pointer + 12);
+
+            BaseAdressRegister address = pci -> GetBaseAdressRegister(device -> bus, device -> device, device -> function, bar);
+            volatile uint8_t* mapped = 0;
+            if(bar < 6 && address.type == MemoryMapping && address.adress != 0 && type >= VIRTIO_CAPABILITY_COMMON && type <= VIRTIO_CAPABILITY_DEVICE)
+                mapped = (volatile uint8_t*)PageManager::activePageManager -> MapPhysicalMemory((uint32_t)address.adress + offset, length, PAGE_CACHE_DISABLE);
+
+            switch (type) {
+
+                case VIRTIO_CAPABILITY_COMMON:
+                    if(commonConfig == 0) commonConfig = mapped;
+                    break;
+
+                case VIRTIO_CAPABILITY_NOTIFY:
+                    if(notify == 0){
+                        notify = mapped;
+                        notifyMultiplier = pci -> Read(device -> bus, device -> device, device -> function, pointer + 16);
+                    }
+                    break;
+
+                case VIRTIO_CAPABILITY_ISR:
+                    if(isr == 0) isr = mapped;
+                    break;
+
+                case VIRTIO_CAPABILITY_DEVICE:
+                    if(config == 0) config = mapped;
+                    break;
+            }
+        }
+
+        pointer = next;
+    }
+
+    return commonConfig != 0 && notify != 0 && isr != 0;
+}
+
+/**
+ * @details Find the device's registers and reset it, then tell it a driver was found
+ * @param msix True if MSI-X was turned on for the device (legacy devices then have two more registers)
+ * @return False if the device can't be used
+ */
+bool VirtualIODevice::Initialize(bool msix) {
+
+    PeripheralComponentInterconnectController* pci = PeripheralComponentInterconnectController::activeController;
+    this -> msix = msix;
+
+    //Prefer the modern interface, transitional devices also have the legacy one in BAR 0
+    modern = FindCapabilities();
+    if(!modern){
+
+        BaseAdressRegister bar = pci -> GetBaseAdressRegister(device -> bus, device -> device, device -> function, 0);
+        if(bar.type != InputOutput || bar.adress == 0)
+            return false;
+
+        ioBase = (uint32_t)bar.adress;
+        configOffset = msix ? VIRTIO_LEGACY_CONFIG + 4 : VIRTIO_LEGACY_CONFIG;
+    }
+
+    //The device reads the queues and the buffers itself
+    uint32_t command = pci -> Read(device -> bus, device -> device, device -> function, 0x04) & 0xFFFF;
+    pci -> Write(device -> bus, device -> device, device -> function, 0x04, command | 0x7);
+
+    Reset();
+    SetStatus(VIRTIO_STATUS_ACKNOWLEDGE);
+    SetStatus(VIRTIO_STATUS_ACKNOWLEDGE | VIRTIO_STATUS_DRIVER);
+    return true;
+}
+
+/**
+ * @details Check which interface is used
+ * @return True for the modern one
+ */
+bool VirtualIODevice::IsModern() {
+    return modern;
+}
+
+/**
+ * @details Get the features the device offers, legacy devices only have 32
+ * @return The feature bits
+ */
+uint64_t VirtualIODevice::DeviceFeatures() {
+
+    if(!modern)
+        return PortIO<uint32_t>::Read(ioBase + VIRTIO_LEGACY_DEVICE_FEATURES);
+
+    Write32(commonConfig, VIRTIO_COMMON_DEVICE_FEATURE_SELECT, 0);
+    uint64_t low = Read32(commonConfig, VIRTIO_COMMON_DEVICE_FEATURE);
+    Write32(commonConfig, VIRTIO_COMMON_DEVICE_FEATURE_SELECT, 1);
+    uint64_t high = Read32(commonConfig, VIRTIO_COMMON_DEVICE_FEATURE);
+
+    return low | (high << 32);
+}
+
+/**
+ * @details Tell the device which of its features the driver uses, a modern device has to accept them (and VIRTIO_F_VERSION_1 is required)
+ * @param features The feature bits, only ones the device offered
+ * @return True if the device accepted them
+ */
+bool VirtualIODevice::SetFeatures(uint64_t features) {
+
+    if(!modern){
+        this -> features = features & 0xFFFFFFFF;
+        PortIO<uint32_t>::Write(ioBase + VIRTIO_LEGACY_DRIVER_FEATURES, this -> features);
+        return true;
+    }
+
+    this -> features = features;
+    if(!HasFeature(VIRTIO_F_VERSION_1))
+        return false;
+
+    Write32(commonConfig, VIRTIO_COMMON_DRIVER_FEATURE_SELECT, 0);
+    Write32(commonConfig, VIRTIO_COMMON_DRIVER_FEATURE, features & 0xFFFFFFFF);
+    Write32(commonConfig, VIRTIO_COMMON_DRIVER_FEATURE_SELECT, 1);
+    Write32(commonConfig, VIRTIO_COMMON_DRIVER_FEATURE, features >> 32);
+
+    SetStatus(Status() | VIRTIO_STATUS_FEATURES_OK);
+    return Status() & VIRTIO_STATUS_FEATURES_OK;
+}
+
+/**
+ * @details Check if a feature was negotiated
+ * @param bit The feature bit
+ * @return True if both sides use it
+ */
+bool VirtualIODevice::HasFeature(int bit) {
+    return (features >> bit) & 0x1;
+}
+
+/**
+ * @details Read the device status
+ * @return The status (VirtualIODeviceStatus bits)
+ */
+uint8_t VirtualIODevice::Status() {
+
+    if(!modern)
+        return PortIO<uint8_t>::Read(ioBase + VIRTIO_LEGACY_DEVICE_STATUS);
+
+    return Read8(commonConfig, VIRTIO_COMMON_DEVICE_STATUS);
+}
+
+/**
+ * @details Write the device status
+ * @param status The status (VirtualIODeviceStatus bits)
+ */
+void VirtualIODevice::SetStatus(uint8_t status) {
+
+    if(!modern)
+        PortIO<uint8_t>::Write(ioBase + VIRTIO_LEGACY_DEVICE_STATUS, status);
+    else
+        Write8(commonConfig, VIRTIO_COMMON_DEVICE_STATUS, status);
+
+}
+
+/**
+ * @details Reset the device, it forgets the features and queues. A modern device says when it is done by reading back 0
+ */
+void VirtualIODevice::Reset() {
+
+    SetStatus(0);
+    for(int i = 0; i < 1000000 && modern && Status() != 0; ++i);
+
+}
+
+/**
+ * @details Tell the device the driver is set up, the queues can be used from now on
+ */
+void VirtualIODevice::Ready() {
+
+    SetStatus(Status() | VIRTIO_STATUS_DRIVER_OK);
+
+}
+
+/**
+ * @details Tell the device the driver gave up on it
+ */
+void VirtualIODevice::Fail() {
+
+    SetStatus(Status() | VIRTIO_STATUS_FAILED);
+
+}
+
+/**
+ * @details Read a byte of the device specific configuration
+ * @param offset Where in the configuration
+ * @return The value
+ */
+uint8_t VirtualIODevice::ReadConfig8(uint32_t offset) {
+
+    if(!modern)
+        return PortIO<uint8_t>::Read(ioBase + configOffset + offset);
+
+    return config == 0 ? 0 : Read8(config, offset);
+}
+
+/**
+ * @details Read a 16 bit value of the device specific configuration
+ * @param offset Where in the configuration
+ * @return The value
+ */
+uint16_t VirtualIODevice::ReadConfig16(uint32_t offset) {
+
+    if(!modern)
+        return PortIO<uint16_t>::Read(ioBase + configOffset + offset);
+
+    return config == 0 ? 0 : Read16(config, offset);
+}
+
+/**
+ * @details Read a 32 bit value of the device specific configuration
+ * @param offset Where in the configuration
+ * @return The value
+ */
+uint32_t VirtualIODevice::ReadConfig32(uint32_t offset) {
+
+    if(!modern)
+        return PortIO<uint32_t>::Read(ioBase + configOffset + offset);
+
+    return config == 0 ? 0 : Read32(config, offset);
+}
+
+/**
+ * @details Read a 64 bit value of the device specific configuration, again if the device changed it between the two halves
+ * @param offset Where in the configuration
+ * @return The value
+ */
+uint64_t VirtualIODevice::ReadConfig64(uint32_t offset) {
+
+    if(!modern)
+        return ReadConfig32(offset) | ((uint64_t)ReadConfig32(offset + 4) << 32);
+
+    uint8_t generation;
+    uint64_t value;
+    do{
+        generation = Read8(commonConfig, VIRTIO_COMMON_CONFIG_GENERATION);
+        value = ReadConfig32(offset) | ((uint64_t)ReadConfig32(offset + 4) << 32);
+    } while(generation != Read8(commonConfig, VIRTIO_COMMON_CONFIG_GENERATION));
+
+    return value;
+}
+
+/**
+ * @details Read (and so clear) the interrupt status, for the shared INTx line: bit 0 a queue has used buffers, bit 1 the configuration changed
+ * @return The status
+ */
+uint8_t VirtualIODevice::ReadISR() {
+
+    if(!modern)
+        return PortIO<uint8_t>::Read(ioBase + VIRTIO_LEGACY_ISR);
+
+    return Read8(isr, 0);
+}
+
+/**
+ * @details Get the amount of queues the device has
+ * @return The amount, 0 if the (legacy) device doesn't say
+ */
+uint16_t VirtualIODevice::NumQueues() {
+
+    if(!modern)
+        return 0;
+
+    return Read16(commonConfig, VIRTIO_COMMON_NUM_QUEUES);
+}
+
+/**
+ * @details Make the next queue register accesses go to a queue
+ * @param index The queue
+ */
+void VirtualIODevice::SelectQueue(uint16_t index) {
+
+    if(!modern)
+        PortIO<uint16_t>::Write(ioBase + VIRTIO_LEGACY_QUEUE_SELECT, index);
+    else
+        Write16(commonConfig, VIRTIO_COMMON_QUEUE_SELECT, index);
+
+}
+
+/**
+ * @details Set up one of the device's queues, after the features are negotiated and before the device is ready
+ * @param index The queue
+ * @param maxSize The most descriptors to use, legacy devices can't be told a smaller size than theirs
+ * @param vector The MSI-X table entry for its interrupts, VIRTIO_NO_VECTOR for none (or without MSI-X)
+ * @return The queue, 0 if the device doesn't have it or it couldn't be set up
+ */
+VirtualIOQueue* VirtualIODevice::CreateQueue(uint16_t index, uint16_t maxSize, uint16_t vector) {
+
+    SelectQueue(index);
+
+    uint16_t size = modern ? Read16(commonConfig, VIRTIO_COMMON_QUEUE_SIZE) : PortIO<uint16_t>::Read(ioBase + VIRTIO_LEGACY_QUEUE_SIZE);
+    if(size == 0 || (!modern && (size & (size - 1)) != 0))
+        return 0;
+
+    //Split queues are a power of two long
+    if(modern){
+        uint16_t rounded = 1;
+        while(rounded * 2 <= size && rounded * 2 <= maxSize)
+            rounded *= 2;
+        size = rounded;
+    }
+
+    VirtualIOQueue* queue = new VirtualIOQueue(this, index, size, HasFeature(VIRTIO_F_EVENT_IDX), HasFeature(VIRTIO_F_INDIRECT_DESC));
+    if(queue == 0)
+        return 0;
+    if(!queue -> IsValid()){
+        delete queue;
+        return 0;
+    }
+
+    if(modern){
+
+        Write16(commonConfig, VIRTIO_COMMON_QUEUE_SIZE, size);
+        Write16(commonConfig, VIRTIO_COMMON_QUEUE_VECTOR, vector);
+        if(vector != VIRTIO_NO_VECTOR && Read16(commonConfig, VIRTIO_COMMON_QUEUE_VECTOR) != vector){
+            delete queue;
+            return 0;
+        }
+
+        Write32(commonConfig, VIRTIO_COMMON_QUEUE_DESCRIPTORS, queue -> DescriptorAddress());
+        Write32(commonConfig, VIRTIO_COMMON_QUEUE_DESCRIPTORS + 4, 0);
+        Write32(commonConfig, VIRTIO_COMMON_QUEUE_AVAILABLE, queue -> AvailableAddress());
+        Write32(commonConfig, VIRTIO_COMMON_QUEUE_AVAILABLE + 4, 0);
+        Write32(commonConfig, VIRTIO_COMMON_QUEUE_USED, queue -> UsedAddress());
+        Write32(commonConfig, VIRTIO_COMMON_QUEUE_USED + 4, 0);
+
+        queue -> notifyOffset = Read16(commonConfig, VIRTIO_COMMON_QUEUE_NOTIFY_OFFSET);
+        Write16(commonConfig, VIRTIO_COMMON_QUEUE_ENABLE, 1);
+    }
+    else
+    {
+        if(msix){
+            PortIO<uint16_t>::Write(ioBase + VIRTIO_LEGACY_QUEUE_VECTOR, vector);
+            if(vector != VIRTIO_NO_VECTOR && PortIO<uint16_t>::Read(ioBase + VIRTIO_LEGACY_QUEUE_VECTOR) != vector){
+                delete queue;
+                return 0;
+            }
+        }
+
+        PortIO<uint32_t>::Write(ioBase + VIRTIO_LEGACY_QUEUE_ADDRESS, queue -> DescriptorAddress() >> 12);
+    }
+
+    return queue;
+}
+
+/**
+ * @details Set the MSI-X table entry for configuration change interrupts
+ * @param vector The entry, VIRTIO_NO_VECTOR for none
+ * @return True if the device took it
+ */
+bool VirtualIODevice::SetConfigVector(uint16_t vector) {
+
+    if(!msix)
+        return false;
+
+    if(!modern){
+        PortIO<uint16_t>::Write(ioBase + VIRTIO_LEGACY_CONFIG_VECTOR, vector);
+        return PortIO<uint16_t>::Read(ioBase + VIRTIO_LEGACY_CONFIG_VECTOR) == vector;
+    }
+
+    Write16(commonConfig, VIRTIO_COMMON_CONFIG_VECTOR, vector);
+    return Read16(commonConfig, VIRTIO_COMMON_CONFIG_VECTOR) == vector;
+}
+
+/**
+ * @details Ring a queue's doorbell
+ * @param queue The queue
+ */
+void VirtualIODevice::Notify(VirtualIOQueue* queue) {
+
+    if(!modern)
+        PortIO<uint16_t>::Write(ioBase + VIRTIO_LEGACY_QUEUE_NOTIFY, queue -> index);
+    else
+        Write16(notify, queue -> notifyOffset * notifyMultiplier, queue -> index);
+
+}
@@ -0,0 +1,537 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#include <drivers/virtioblock.h>
+#include <hardwarecommunication/apic.h>
+#include <system/paging.h>
+
+using namespace maxOS;
+using namespace maxOS::common;
+using namespace maxOS::hardwarecommunication;
+using namespace maxOS::drivers;
+using namespace maxOS::system;
+
+void printf(char* str, bool clearLine = false); // Forward declaration
+void printfHex(uint8_t key);                    // Forward declaration
+
+/**
+ * @details Describe a buffer as data buffers of a chain, a page at a time and merging physically contiguous pages
+ * @param buffers The chain's data buffers
+ * @param count The buffers already used, updated
+ * @param maxCount The most buffers there can be
+ * @param maxSize The longest a buffer can be
+ * @param buffer The memory
+ * @param length Bytes of it to describe
+ * @param deviceWrites True if the device writes to the memory
+ * @return The amount of bytes described, less than the length if the buffers ran out, -1 if the memory isn't mapped
+ */
+static int32_t AddSegments(VirtualIOBuffer* buffers, uint32_t* count, uint32_t maxCount, uint32_t maxSize, uint8_t* buffer, uint32_t length, bool deviceWrites){
+
+    uint32_t added = 0;
+    uint32_t virtualAddress = (uint32_t)buffer;
+    while(added < length){
+
+        uint32_t physicalAddress = PageManager::activePageManager -> PhysicalAddress(virtualAddress, deviceWrites);
+        if(physicalAddress == 0)
+            return -1;
+
+        uint32_t chunk = PAGE_SIZE - (virtualAddress & (PAGE_SIZE - 1));
+        if(chunk > length - added)
+            chunk = length - added;
+        if(chunk > maxSize)
+            chunk = maxSize;
+
+        VirtualIOBuffer* last = *count == 0 ? 0 : &buffers[*count - 1];
+        if(last != 0 && last -> address + last -> length == physicalAddress && last -> length + chunk <= maxSize){
+            last -> length += chunk;
+        }
+        else
+        {
+            if(*count >= maxCount)
+                break;
+
+            buffers[*count].address = physicalAddress;
+            buffers[*count].length = chunk;
+            buffers[*count].deviceWrites = deviceWrites;
+            (*count)++;
+        }
+
+        virtualAddress += chunk;
+        added += chunk;
+    }
+
+    return added;
+}
+
+///__INTERRUPTS__
+
+VirtualIOBlockInterruptHandler::VirtualIOBlockInterruptHandler(uint8_t interrupt, InterruptManager* interruptManager, VirtualIOBlockDevice* device, int queue)
+: InterruptHandler(interrupt, interruptManager)
+{
+    this -> device = device;
+    this -> queue = queue;
+}
+
+VirtualIOBlockInterruptHandler::~VirtualIOBlockInterruptHandler() {
+
+}
+
+/**
+ * @details Service the queue the interrupt is for, or every queue if it came on the shared line
+ * @param esp The stack pointer
+ * @return The stack pointer
+ */
+uint32_t VirtualIOBlockInterruptHandler::HandleInterrupt(uint32_t esp) {
+
+    if(queue < 0)
+        device -> ServiceShared();
+    else
+        device -> Service(queue);
+
+    return esp;
+}
+
+///__DRIVER__
+
+static const PeripheralComponentInterconnectDeviceID virtioBlockIDs[] = {
+    { PCI_VENDOR_VIRTIO, 0x1001, 0, 0 },               //Transitional (legacy and modern interface)
+    { PCI_VENDOR_VIRTIO, 0x1042, 0, 0 },               //Modern only (0x1040 + device type 2)
+};
+
+/**
+ * @details Create the driver for a matching PCI device
+ * @param dev The device descriptor
+ * @param interruptManager The interrupt manager
+ * @return The driver
+ */
+static Driver* CreateVirtualIOBlockDevice(PeripheralComponentInterconnectDeviceDescriptor* dev, InterruptManager* interruptManager){
+    return new VirtualIOBlockDevice(dev, interruptManager);
+}
+
+REGISTER_PCI_DRIVER(virtioBlockDriver, "virtio-blk", virtioBlockIDs, CreateVirtualIOBlockDevice);
+
+VirtualIOBlockDevice::VirtualIOBlockDevice(PeripheralComponentInterconnectDeviceDescriptor* device, InterruptManager* interruptManager)
+: Driver(),
+  BlockDevice(),
+  transport(device)
+{
+    this -> device = device;
+    this -> interruptManager = interruptManager;
+
+    for(int i = 0; i < maxQueues; ++i){
+        queues[i] = 0;
+        handlers[i] = 0;
+    }
+    numQueues = 0;
+    pendingKicks = 0;
+
+    for(int i = 0; i < maxRequests; ++i)
+        slots[i].request = 0;
+    maxSegments = 1;
+    maxSegmentSize = PAGE_SIZE;
+
+    present = false;
+    readOnly = false;
+    hasFlush = false;
+}
+
+VirtualIOBlockDevice::~VirtualIOBlockDevice() {
+
+    //The device has to stop using the queues before they are freed
+    if(numQueues > 0)
+        transport.Reset();
+
+    for(int i = 0; i < maxQueues; ++i){
+        if(handlers[i] != 0)
+            delete handlers[i];
+        if(queues[i] != 0)
+            delete queues[i];
+    }
+
+}
+
+/**
+ * @details Negotiate the features, set up a queue per CPU (as far as the device has them) with a MSI-X vector each and get the device going
+ */
+void VirtualIOBlockDevice::Activate() {
+
+    printf("    -virtio-blk: ");
+
+    PeripheralComponentInterconnectController* pci = PeripheralComponentInterconnectController::activeController;
+    bool msix = pci -> EnableMSIX(device);
+    if(!transport.Initialize(msix)){
+        printf("No usable interface\n");
+        return;
+    }
+
+    uint64_t wanted = (1ULL << VIRTIO_F_INDIRECT_DESC) | (1ULL << VIRTIO_F_EVENT_IDX) | (1ULL << VIRTIO_F_VERSION_1)
+                    | (1 << VIRTIO_BLK_F_SIZE_MAX) | (1 << VIRTIO_BLK_F_SEG_MAX) | (1 << VIRTIO_BLK_F_RO) | (1 << VIRTIO_BLK_F_FLUSH) | (1 << VIRTIO_BLK_F_MQ);
+    if(!transport.SetFeatures(transport.DeviceFeatures() & wanted)){
+        transport.Fail();
+        printf("Features not accepted\n");
+        return;
+    }
+
+    readOnly = transport.HasFeature(VIRTIO_BLK_F_RO);
+    hasFlush = transport.HasFeature(VIRTIO_BLK_F_FLUSH);
+    capacity = transport.ReadConfig64(VIRTIO_BLK_CONFIG_CAPACITY);
+
+    //A queue per CPU, so submitters on different CPUs don't share a ring
+    int cpus = 1;
+    AdvancedProgrammableInterruptController* apic = AdvancedProgrammableInterruptController::activeAPIC;
+    if(apic != 0 && apic -> IsAvailable() && apic -> Description() -> numProcessors > 0)
+        cpus = apic -> Description() -> numProcessors;
+
+    int wantedQueues = transport.HasFeature(VIRTIO_BLK_F_MQ) ? transport.ReadConfig16(VIRTIO_BLK_CONFIG_NUM_QUEUES) : 1;
+    if(wantedQueues > cpus)
+        wantedQueues = cpus;
+    if(wantedQueues > maxQueues)
+        wantedQueues = maxQueues;
+    if(wantedQueues < 1)
+        wantedQueues = 1;
+
+    for(int i = 0; i < wantedQueues; ++i){
+
+        int interrupt = -1;
+        if(msix){
+            interrupt = pci -> AllocateMSIXVector(device, interruptManager, i);
+            if(interrupt < 0)
+                break;
+        }
+
+        VirtualIOQueue* queue = transport.CreateQueue(i, maxQueueSize, msix ? i : VIRTIO_NO_VECTOR);
+        if(queue == 0)
+            break;
+
+        queues[numQueues] = queue;
+        if(msix)
+            handlers[numQueues] = new VirtualIOBlockInterruptHandler(interrupt, interruptManager, this, numQueues);
+        numQueues++;
+    }
+
+    if(numQueues == 0){
+        transport.Fail();
+        printf("No queues\n");
+        return;
+    }
+
+    //Without MSI-X every queue interrupts on the INTx line, the ISR says if it was this device
+    if(msix)
+        transport.SetConfigVector(VIRTIO_NO_VECTOR);
+    else
+        handlers[0] = new VirtualIOBlockInterruptHandler(device -> interrupt + interruptManager -> HardwareInterruptOffset(), interruptManager, this, -1);
+
+    //A chain is the header, the data and the status. Without indirect descriptors they all take ring space
+    bool indirect = queues[0] -> HasIndirect();
+    maxSegments = indirect ? VirtualIOQueue::maxIndirect - 2 : 6;
+    if(transport.HasFeature(VIRTIO_BLK_F_SEG_MAX)){
+        uint32_t segments = transport.ReadConfig32(VIRTIO_BLK_CONFIG_SEG_MAX);
+        if(segments > 0 && segments < maxSegments)
+            maxSegments = segments;
+    }
+
+    maxSegmentSize = 0x400000;
+    if(transport.HasFeature(VIRTIO_BLK_F_SIZE_MAX)){
+        uint32_t size = transport.ReadConfig32(VIRTIO_BLK_CONFIG_SIZE_MAX);
+        if(size >= limits.sectorSize && size < maxSegmentSize)
+            maxSegmentSize = size & ~(limits.sectorSize - 1);
+    }
+
+    uint32_t depth = 0;
+    for(int i = 0; i < numQueues; ++i)
+        depth += indirect ? queues[i] -> Size() : queues[i] -> Size() / (maxSegments + 2);
+
+    limits.maxSectors = 256;
+    limits.maxDepth = depth == 0 ? 1 : (depth > (uint32_t)maxRequests ? maxRequests : depth);
+
+    transport.Ready();
+    present = true;
+
+    printf(transport.IsModern() ? (char*)"modern, " : (char*)"legacy, ");
+    printf("0x");
+    printfHex(numQueues);
+    printf(numQueues > 1 ? (char*)" queues\n" : (char*)" queue\n");
+
+}
+
+/**
+ * @details Get the queue the current CPU submits to
+ * @return The queue
+ */
+int VirtualIOBlockDevice::CurrentQueue() {
+
+    AdvancedProgrammableInterruptController* apic = AdvancedProgrammableInterruptController::activeAPIC;
+    if(numQueues <= 1 || apic == 0 || !apic -> IsAvailable())
+        return 0;
+
+    return apic -> CurrentCPU() % numQueues;
+}
+
+/**
+ * @details Describe the part of a request that hasn't been moved yet as data buffers, a request too scattered for one chain is cut to whole sectors
+ * @param slot The request
+ * @param buffers Where to put the buffers, room for maxSegments
+ * @return The amount of buffers, -1 if the memory can't be used. The sectors they cover are put in the chunk
+ */
+int VirtualIOBlockDevice::BuildSegments(VirtualIOBlockRequest* slot, VirtualIOBuffer* buffers) {
+
+    BlockRequest* request = slot -> request;
+    bool deviceWrites = request -> operation == BLOCK_READ;
+
+    uint32_t skip = slot -> done;
+    uint32_t remaining = request -> count - skip;
+    uint32_t bytes = 0;
+    uint32_t count = 0;
+
+    for(BlockIO* io = request -> head; io != 0 && remaining > 0; io = io == request -> tail ? 0 : io -> next){
+
+        if(io -> count <= skip){
+            skip -= io -> count;
+            continue;
+        }
+
+        uint32_t sectors = io -> count - skip;
+        if(sectors > remaining)
+            sectors = remaining;
+
+        uint32_t length = sectors * limits.sectorSize;
+        int32_t added = AddSegments(buffers, &count, maxSegments, maxSegmentSize, io -> buffer + skip * limits.sectorSize, length, deviceWrites);
+        if(added < 0)
+            return -1;
+
+        bytes += added;
+        remaining -= sectors;
+        skip = 0;
+
+        if((uint32_t)added < length)
+            break;
+    }
+
+    //Only whole sectors can be moved, give back the part of the last one that didn't fit
+    uint32_t excess = bytes % limits.sectorSize;
+    bytes -= excess;
+    while(excess > 0 && count > 0){
+
+        VirtualIOBuffer* last = &buffers[count - 1];
+        if(last -> length > excess){
+            last -> length -= excess;
+            break;
+        }
+
+        excess -= last -> length;
+        count--;
+    }
+
+    if(bytes == 0)
+        return -1;
+
+    slot -> chunk = bytes / limits.sectorSize;
+    return count;
+}
+
+/**
+ * @details Put the next chain of a request in a queue, the current CPU's if it has room. The device is told in CommitRequests
+ * @param slot The request
+ * @return True if a chain was added, false if it couldn't be
+ */
+bool VirtualIOBlockDevice::IssueNext(VirtualIOBlockRequest* slot) {
+
+    BlockRequest* request = slot -> request;
+    VirtualIOBuffer buffers[VirtualIOQueue::maxIndirect];
+
+    switch (request -> operation) {
+        case BLOCK_READ:  slot -> header.type = VIRTIO_BLK_T_IN;    break;
+        case BLOCK_WRITE: slot -> header.type = VIRTIO_BLK_T_OUT;   break;
+        case BLOCK_FLUSH: slot -> header.type = VIRTIO_BLK_T_FLUSH; break;
+    }
+    slot -> header.reserved = 0;
+    slot -> header.sector = request -> operation == BLOCK_FLUSH ? 0 : request -> sector + slot -> done;
+    slot -> chunk = 0;
+    slot -> status = 0xFF;
+
+    //The driver is on the heap, which is identity mapped
+    int count = 0;
+    buffers[count].address = (uint32_t)&slot -> header;
+    buffers[count].length = sizeof(VirtualIOBlockHeader);
+    buffers[count].deviceWrites = false;
+    count++;
+
+    if(request -> operation != BLOCK_FLUSH){
+        int segments = BuildSegments(slot, &buffers[count]);
+        if(segments < 0)
+            return false;
+        count += segments;
+    }
+
+    buffers[count].address = (uint32_t)&slot -> status;
+    buffers[count].length = 1;
+    buffers[count].deviceWrites = true;
+    count++;
+
+    int first = CurrentQueue();
+    for(int i = 0; i < numQueues; ++i){
+
+        int queue = (first + i) % numQueues;
+        if(queues[queue] -> Add(buffers, count, slot) >= 0){
+            pendingKicks |= 1 << queue;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @details A chain of a request was finished by the device: send the rest of the request, or complete it
+ * @param slot The request
+ */
+void VirtualIOBlockDevice::Advance(VirtualIOBlockRequest* slot) {
+
+    BlockRequest* request = slot -> request;
+    if(slot -> status != 0){
+        Finish(slot, true);
+        return;
+    }
+
+    if(request -> operation != BLOCK_FLUSH){
+
+        slot -> done += slot -> chunk;
+        slot -> chunk = 0;
+
+        if(slot -> done < request -> count && IssueNext(slot))
+            return;
+    }
+
+    Finish(slot, request -> operation != BLOCK_FLUSH && slot -> done < request -> count);
+
+}
+
+/**
+ * @details Free a slot and give its request back to the block layer, which may start the next one in it straight away
+ * @param slot The request
+ * @param failed True if the request didn't complete, the sectors moved before the failure still count
+ */
+void VirtualIOBlockDevice::Finish(VirtualIOBlockRequest* slot, bool failed) {
+
+    BlockRequest* request = slot -> request;
+    slot -> request = 0;
+
+    int result = request -> operation == BLOCK_FLUSH ? 0 : (int)slot -> done;
+    if(failed && (request -> operation == BLOCK_FLUSH || slot -> done == 0))
+        result = -1;
+
+    Complete(request, result);
+
+}
+
+/**
+ * @details Take a request of the block layer, it reaches the device with the rest of the batch
+ * @param request The request
+ */
+void VirtualIOBlockDevice::StartRequest(BlockRequest* request) {
+
+    //The block layer never has more than maxDepth requests out, so there is always a free slot
+    VirtualIOBlockRequest* slot = 0;
+    for(int i = 0; i < maxRequests && slot == 0; ++i)
+        if(slots[i].request == 0)
+            slot = &slots[i];
+
+    if(!present || slot == 0 || (readOnly && request -> operation == BLOCK_WRITE)){
+        Complete(request, -1);
+        return;
+    }
+
+    //Without a write cache everything is on the disk already
+    if(request -> operation == BLOCK_FLUSH && !hasFlush){
+        Complete(request, 0);
+        return;
+    }
+
+    slot -> request = request;
+    slot -> done = 0;
+    slot -> chunk = 0;
+
+    if(!IssueNext(slot))
+        Finish(slot, true);
+
+}
+
+/**
+ * @details Publish the chains added since the last batch, one doorbell write per queue at most
+ */
+void VirtualIOBlockDevice::CommitRequests() {
+
+    for(int i = 0; i < numQueues && pendingKicks != 0; ++i){
+
+        if(!(pendingKicks & (1 << i)))
+            continue;
+
+        pendingKicks &= ~(1 << i);
+        queues[i] -> Kick();
+    }
+
+}
+
+/**
+ * @details Complete the requests the device finished in a queue, interrupts stay off until the queue is empty so a batch costs one
+ * @param queue The queue
+ */
+void VirtualIOBlockDevice::Service(int queue) {
+
+    if(!present || queue < 0 || queue >= numQueues)
+        return;
+
+    VirtualIOQueue* virtQueue = queues[queue];
+    do{
+        virtQueue -> DisableCallbacks();
+        for(void* token = virtQueue -> NextUsed(0); token != 0; token = virtQueue -> NextUsed(0))
+            Advance((VirtualIOBlockRequest*)token);
+
+    } while(!virtQueue -> EnableCallbacks());
+
+    CommitRequests();
+
+}
+
+/**
+ * @details Handle an interrupt on the INTx line, reading the ISR tells if it was this device and lowers the line
+ */
+void VirtualIOBlockDevice::ServiceShared() {
+
+    if(!present)
+        return;
+
+    if(!(transport.ReadISR() & 0x1))
+        return;
+
+    for(int i = 0; i < numQueues; ++i)
+        Service(i);
+
+}
+
+/**
+ * @details Check every queue for completions, for waits while interrupts are off
+ */
+void VirtualIOBlockDevice::Poll() {
+
+    for(int i = 0; i < numQueues; ++i)
+        Service(i);
+
+}
+
+/**
+ * @details Check if the device was set up
+ * @return True if it can be used
+ */
+bool VirtualIOBlockDevice::IsPresent() {
+    return present;
+}
+
+/**
+ * @details Get the amount of request queues in use
+ * @return The amount
+ */
+int VirtualIOBlockDevice::NumQueues() {
+    return numQueues;
+}
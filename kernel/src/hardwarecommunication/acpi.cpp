@@ -0,0 +1,339 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#include <hardwarecommunication/acpi.h>
+#include <system/paging.h>
+
+using namespace maxOS;
+using namespace maxOS::common;
+using namespace maxOS::hardwarecommunication;
+using namespace maxOS::system;
+
+AdvancedConfigurationAndPowerInterface* AdvancedConfigurationAndPowerInterface::activeACPI = 0;
+
+/**
+ * @details Find the ACPI tables the firmware left in memory
+ */
+AdvancedConfigurationAndPowerInterface::AdvancedConfigurationAndPowerInterface() {
+
+    rootTable = 0;
+    extended = false;
+
+    //The root pointer is either in the first KB of the EBDA or in the BIOS area below 1MB
+    uint32_t extendedBIOSDataArea = ((uint32_t)*(uint16_t*)0x40E) << 4;
+    rootPointer = FindRootPointer(extendedBIOSDataArea, 1024);
+    if(rootPointer == 0)
+        rootPointer = FindRootPointer(0xE0000, 0x20000);
+
+    //ACPI 2.0+ firmware also has the XSDT, prefer it as the RSDT may be missing tables (only possible if it is below 4GB)
+    if(rootPointer != 0 && rootPointer -> revision >= 2 && rootPointer -> length >= sizeof(RootSystemDescriptionPointer)
+    && ValidChecksum((uint8_t*)rootPointer, rootPointer -> length) && (rootPointer -> extendedTableAddress >> 32) == 0){
+
+        rootTable = MapTable((uint32_t)rootPointer -> extendedTableAddress);
+        extended = rootTable != 0 && rootTable -> signature[0] == 'X' && rootTable -> signature[1] == 'S' && rootTable -> signature[2] == 'D' && rootTable -> signature[3] == 'T';
+        if(!extended)
+            rootTable = 0;
+    }
+
+    if(rootPointer != 0 && rootTable == 0){
+
+        rootTable = MapTable(rootPointer -> rootTableAddress);
+        if(rootTable != 0 && (rootTable -> signature[0] != 'R' || rootTable -> signature[1] != 'S' || rootTable -> signature[2] != 'D' || rootTable -> signature[3] != 'T'))
+            rootTable = 0;
+    }
+
+    activeACPI = this;
+
+}
+
+AdvancedConfigurationAndPowerInterface::~AdvancedConfigurationAndPowerInterface() {
+
+    if(activeACPI == this)
+        activeACPI = 0;
+
+}
+
+/**
+ * @details Check that the bytes of a table add up to 0
+ * @param data The table
+ * @param length The length of the table
+ * @return True if the checksum is valid
+ */
+bool AdvancedConfigurationAndPowerInterface::ValidChecksum(uint8_t* data, uint32_t length) {
+
+    uint8_t sum = 0;
+    for(uint32_t i = 0; i < length; ++i)
+        sum += data[i];
+
+    return sum == 0;
+}
+
+/**
+ * @details Search an area of memory for the root pointer
+ * @param start Where to start looking (it is always 16 byte aligned)
+ * @param length How many bytes to search
+ * @return The root pointer, 0 if it isn't there
+ */
+RootSystemDescriptionPointer* AdvancedConfigurationAndPowerInterface::FindRootPointer(uint32_t start, uint32_t length) {
+
+    static const char signature[] = "RSD PTR ";
+    const uint32_t version1Size = 20;                   //The checksum only covers the ACPI 1.0 part, the rest has its own
+
+    if(start == 0)
+        return 0;
+
+    for(uint32_t address = start & ~0xF; address + version1Size <= start + length; address += 16){
+
+        char* candidate = (char*)address;
+
+        bool match = true;
+        for(int i = 0; i < 8 && match; ++i)
+            match = candidate[i] == signature[i];
+
+        if(match && ValidChecksum((uint8_t*)candidate, version1Size))
+            return (RootSystemDescriptionPointer*)candidate;
+    }
+
+    return 0;
+}
+
+/**
+ * @details Make a table visible and check it
+ * @param physicalAddress Where the table is
+ * @return The table, 0 if it can't be mapped or is corrupt
+ */
+SystemDescriptionTableHeader* AdvancedConfigurationAndPowerInterface::MapTable(uint32_t physicalAddress) {
+
+    if(physicalAddress == 0 || PageManager::activePageManager == 0)
+        return 0;
+
+    //Map the header to find the length, then the rest
+    SystemDescriptionTableHeader* table = (SystemDescriptionTableHeader*)PageManager::activePageManager -> MapPhysicalMemory(physicalAddress, sizeof(SystemDescriptionTableHeader), 0);
+    if(table == 0 || PageManager::activePageManager -> MapPhysicalMemory(physicalAddress, table -> length, 0) == 0)
+        return 0;
+
+    if(table -> length < sizeof(SystemDescriptionTableHeader) || !ValidChecksum((uint8_t*)table, table -> length))
+        return 0;
+
+    return table;
+}
+
+/**
+ * @details Check if the firmware provides ACPI tables
+ * @return True if the root table was found
+ */
+bool AdvancedConfigurationAndPowerInterface::IsPresent() {
+    return rootTable != 0;
+}
+
+/**
+ * @details Find a table
+ * @param signature The 4 character signature of the table (e.g. "APIC" for the MADT)
+ * @return The table, 0 if there isn't one
+ */
+SystemDescriptionTableHeader* AdvancedConfigurationAndPowerInterface::FindTable(const char* signature) {
+
+    if(rootTable == 0)
+        return 0;
+
+    //The RSDT has 32 bit entries, the XSDT 64 bit ones
+    uint32_t* entries = (uint32_t*)(rootTable + 1);
+    uint32_t entrySize = extended ? 8 : 4;
+    uint32_t numEntries = (rootTable -> length - sizeof(SystemDescriptionTableHeader)) / entrySize;
+
+    for(uint32_t i = 0; i < numEntries; ++i){
+
+        //Tables above 4GB can't be reached without PAE
+        if(extended && entries[i * 2 + 1] != 0)
+            continue;
+
+        SystemDescriptionTableHeader* table = MapTable(entries[i * (entrySize / 4)]);
+        if(table == 0)
+            continue;
+
+        if(table -> signature[0] == signature[0] && table -> signature[1] == signature[1]
+        && table -> signature[2] == signature[2] && table -> signature[3] == signature[3])
+            return table;
+    }
+
+    return 0;
+}
+
+/**
+ * @details Read the interrupt controllers and processors out of the MADT
+ * @param description Where to put the results
+ * @return True if there is a MADT
+ */
+bool AdvancedConfigurationAndPowerInterface::ParseMADT(MultipleAPICDescription* description) {
+
+    description -> numProcessors = 0;
+    description -> numIOAPICs = 0;
+    description -> numOverrides = 0;
+
+    MADTHeader* madt = (MADTHeader*)FindTable("APIC");
+    if(madt == 0)
+        return false;
+
+    description -> localAPICAddress = madt -> localAPICAddress;
+    description -> hasLegacyPIC = madt -> flags & 0x1;
+
+    uint8_t* entry = (uint8_t*)(madt + 1);
+    uint8_t* end = (uint8_t*)madt + madt -> header.length;
+
+    while(entry + sizeof(MADTEntry) <= end){
+
+        MADTEntry* header = (MADTEntry*)entry;
+        if(header -> length < sizeof(MADTEntry) || entry + header -> length > end)
+            break;
+
+        switch (header -> type) {
+
+            case MADT_LOCAL_APIC:
+            {
+                MADTLocalAPIC* processor = (MADTLocalAPIC*)entry;
+                if(!(processor -> flags & 0x1) || description -> numProcessors >= 16)
+                    break;
+
+                description -> processors[description -> numProcessors].processorID = processor -> processorID;
+                description -> processors[description -> numProcessors].apicID = processor -> apicID;
+                description -> numProcessors++;
+                break;
+            }
+
+            case MADT_IO_APIC:
+            {
+                MADTIOAPIC* ioAPIC = (MADTIOAPIC*)entry;
+                if(description -> numIOAPICs >= 4)
+                    break;
+
+                description -> ioAPICs[description -> numIOAPICs].id = ioAPIC -> ioAPICID;
+                description -> ioAPICs[description -> numIOAPICs].address = ioAPIC -> address;
+                description -> ioAPICs[description -> numIOAPICs].globalSystemInterruptBase = ioAPIC -> globalSystemInterruptBase;
+                description -> numIOAPICs++;
+                break;
+            }
+
+            case MADT_INTERRUPT_OVERRIDE:
+            {
+                MADTInterruptOverride* interruptOverride = (MADTInterruptOverride*)entry;
+                if(interruptOverride -> bus != 0 || description -> numOverrides >= 16)
+                    break;
+
+                description -> overrides[description -> numOverrides].source = interruptOverride -> source;
+                description -> overrides[description -> numOverrides].globalSystemInterrupt = interruptOverride -> globalSystemInterrupt;
+                description -> overrides[description -> numOverrides].flags = interruptOverride -> flags;
+                description -> numOverrides++;
+                break;
+            }
+
+            case MADT_LOCAL_APIC_ADDRESS_OVERRIDE:
+            {
+                //Only usable if it is below 4GB
+                MADTLocalAPICAddressOverride* addressOverride = (MADTLocalAPICAddressOverride*)entry;
+                if((addressOverride -> address >> 32) == 0)
+                    description -> localAPICAddress = (uint32_t)addressOverride -> address;
+                break;
+            }
+
+            default:
+                break;
+        }
+
+        entry += header -> length;
+    }
+
+    return true;
+}
+
+/**
+ * @details Read where the HPET is and what it can do
+ * @param description Where to put the results
+ * @return True if there is a usable (memory mapped, below 4GB) HPET
+ */
+bool AdvancedConfigurationAndPowerInterface::ParseHPET(HighPrecisionEventTimerDescription* description) {
+
+    HPETTable* hpet = (HPETTable*)FindTable("HPET");
+    if(hpet == 0 || hpet -> header.length < sizeof(HPETTable))
+        return false;
+
+    if(hpet -> baseAddress.addressSpace != ADDRESS_SPACE_MEMORY || (hpet -> baseAddress.address >> 32) != 0)
+        return false;
+
+    description -> address = (uint32_t)hpet -> baseAddress.address;
+    description -> numComparators = ((hpet -> eventTimerBlockID >> 8) & 0x1F) + 1;
+    description -> counter64Bit = (hpet -> eventTimerBlockID >> 13) & 0x1;
+    description -> legacyReplacement = (hpet -> eventTimerBlockID >> 15) & 0x1;
+    description -> vendorID = hpet -> eventTimerBlockID >> 16;
+    description -> minimumTick = hpet -> minimumTick;
+
+    return true;
+}
+
+/**
+ * @details Read the fixed hardware description (power management ports, boot flags, the reset register...)
+ * @param description Where to put the results
+ * @return True if there is a FADT
+ */
+bool AdvancedConfigurationAndPowerInterface::ParseFADT(FixedACPIDescription* description) {
+
+    FADTTable* fadt = (FADTTable*)FindTable("FACP");
+    if(fadt == 0)
+        return false;
+
+    //Fields past the end of older, shorter tables don't exist
+    uint32_t length = fadt -> header.length;
+    uint32_t centuryEnd = (uint32_t)&((FADTTable*)0) -> century + 1;
+    uint32_t bootFlagsEnd = (uint32_t)&((FADTTable*)0) -> bootArchitectureFlags + 2;
+    uint32_t resetEnd = (uint32_t)&((FADTTable*)0) -> resetValue + 1;
+
+    description -> sciInterrupt = fadt -> sciInterrupt;
+    description -> smiCommandPort = fadt -> smiCommandPort;
+    description -> acpiEnable = fadt -> acpiEnable;
+    description -> acpiDisable = fadt -> acpiDisable;
+    description -> pm1aControlBlock = fadt -> pm1aControlBlock;
+    description -> pmTimerBlock = fadt -> pmTimerLength == 4 ? fadt -> pmTimerBlock : 0;
+    description -> century = length >= centuryEnd ? fadt -> century : 0;
+    description -> bootArchitectureFlags = (length >= bootFlagsEnd && fadt -> header.revision >= 2) ? fadt -> bootArchitectureFlags : 0;
+    description -> pmTimer32Bit = length >= bootFlagsEnd + 5 && (fadt -> flags & (1 << 8));
+    description -> hasResetRegister = length >= resetEnd && (fadt -> flags & (1 << 10));
+    if(description -> hasResetRegister){
+        description -> resetRegister = fadt -> resetRegister;
+        description -> resetValue = fadt -> resetValue;
+    }
+
+    return true;
+}
+
+/**
+ * @details Find the memory mapped (ECAM) PCI config space of segment 0
+ * @param description Where to put the results
+ * @return True if there is a usable (below 4GB) one
+ */
+bool AdvancedConfigurationAndPowerInterface::ParseMCFG(PCIExpressDescription* description) {
+
+    MCFGTable* mcfg = (MCFGTable*)FindTable("MCFG");
+    if(mcfg == 0)
+        return false;
+
+    MCFGAllocation* allocations = (MCFGAllocation*)(mcfg + 1);
+    uint32_t numAllocations = (mcfg -> header.length - sizeof(MCFGTable)) / sizeof(MCFGAllocation);
+
+    for(uint32_t i = 0; i < numAllocations; ++i){
+
+        //Only segment 0 is reachable through the legacy ports as well, so that is the only one used
+        if(allocations[i].segment != 0 || allocations[i].startBus > allocations[i].endBus)
+            continue;
+
+        uint64_t base = allocations[i].baseAddress + ((uint64_t)allocations[i].startBus << 20);
+        if((base >> 32) != 0)
+            continue;
+
+        description -> baseAddress = (uint32_t)base;
+        description -> startBus = allocations[i].startBus;
+        description -> endBus = allocations[i].endBus;
+        return true;
+    }
+
+    return false;
+}
@@ -0,0 +1,322 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#include <hardwarecommunication/apic.h>
+#include <system/paging.h>
+
+using namespace maxOS;
+using namespace maxOS::common;
+using namespace maxOS::hardwarecommunication;
+using namespace maxOS::system;
+
+///__Local APIC__
+
+/**
+ * @details Enable the local APIC of this CPU
+ * @param address The physical address of its registers
+ */
+LocalAPIC::LocalAPIC(uint32_t address) {
+
+    registers = (volatile uint32_t*)PageManager::activePageManager -> MapPhysicalMemory(address, 4096, PAGE_CACHE_DISABLE);
+
+    //Set the global enable bit in the APIC base MSR
+    uint32_t low, high;
+    asm volatile("rdmsr" : "=a"(low), "=d"(high) : "c"(0x1B));
+    asm volatile("wrmsr" : : "a"(low | 0x800), "d"(high), "c"(0x1B));
+
+    Write(0xF0, 0x1FF);                                 //Software enable, spurious interrupts go to vector 0xFF (ignored)
+    SetTaskPriority(0);                                 //Accept every vector
+
+}
+
+LocalAPIC::~LocalAPIC() {
+
+}
+
+/**
+ * @details Read a register
+ * @param reg The offset of the register
+ * @return The value
+ */
+uint32_t LocalAPIC::Read(uint32_t reg) {
+    return registers[reg / 4];
+}
+
+/**
+ * @details Write a register
+ * @param reg The offset of the register
+ * @param value The value
+ */
+void LocalAPIC::Write(uint32_t reg, uint32_t value) {
+    registers[reg / 4] = value;
+}
+
+/**
+ * @details Get the APIC ID of this CPU, used as the destination of interrupts
+ * @return The ID
+ */
+uint8_t LocalAPIC::ID() {
+    return Read(0x20) >> 24;
+}
+
+/**
+ * @details Block interrupts with a lower priority, the priority of a vector is its upper 4 bits
+ * @param priority The lowest priority class (0-15) to still accept
+ */
+void LocalAPIC::SetTaskPriority(uint8_t priority) {
+    Write(0x80, (priority & 0xF) << 4);
+}
+
+///__IO APIC__
+
+/**
+ * @details Set up an IO APIC, every input starts masked
+ * @param address The physical address of its registers
+ * @param globalSystemInterruptBase The first global system interrupt it handles
+ */
+IOAPIC::IOAPIC(uint32_t address, uint32_t globalSystemInterruptBase) {
+
+    registers = (volatile uint32_t*)PageManager::activePageManager -> MapPhysicalMemory(address, 4096, PAGE_CACHE_DISABLE);
+    this -> globalSystemInterruptBase = globalSystemInterruptBase;
+    numRedirections = ((Read(0x01) >> 16) & 0xFF) + 1;
+
+    for(uint32_t i = 0; i < numRedirections; ++i)
+        Mask(globalSystemInterruptBase + i);
+
+}
+
+IOAPIC::~IOAPIC() {
+
+}
+
+/**
+ * @details Read a register (they are accessed through a select and a window register)
+ * @param reg The register
+ * @return The value
+ */
+uint32_t IOAPIC::Read(uint8_t reg) {
+
+    registers[0] = reg;
+    return registers[4];
+
+}
+
+/**
+ * @details Write a register
+ * @param reg The register
+ * @param value The value
+ */
+void IOAPIC::Write(uint8_t reg, uint32_t value) {
+
+    registers[0] = reg;
+    registers[4] = value;
+
+}
+
+/**
+ * @details Check if an interrupt is one of this IO APIC's inputs
+ * @param globalSystemInterrupt The interrupt
+ * @return True if it is
+ */
+bool IOAPIC::Handles(uint32_t globalSystemInterrupt) {
+    return globalSystemInterrupt >= globalSystemInterruptBase && globalSystemInterrupt < globalSystemInterruptBase + numRedirections;
+}
+
+/**
+ * @details Send an input to a vector on a CPU
+ * @param globalSystemInterrupt The input
+ * @param vector The vector to raise (its upper 4 bits are its priority)
+ * @param destination The APIC ID of the CPU to send it to
+ * @param flags The polarity and trigger mode (InterruptOverrideFlags), 0 for ISA defaults
+ */
+void IOAPIC::SetRedirection(uint32_t globalSystemInterrupt, uint8_t vector, uint8_t destination, uint16_t flags) {
+
+    uint8_t entry = 0x10 + (globalSystemInterrupt - globalSystemInterruptBase) * 2;
+
+    uint32_t low = vector;                                                              //Fixed delivery, physical destination
+    if((flags & INTERRUPT_POLARITY_MASK) == INTERRUPT_ACTIVE_LOW)
+        low |= 1 << 13;
+    if((flags & INTERRUPT_TRIGGER_MASK) == INTERRUPT_LEVEL_TRIGGERED)
+        low |= 1 << 15;
+
+    Write(entry + 1, (uint32_t)destination << 24);
+    Write(entry, low);
+
+}
+
+/**
+ * @details Stop an input from raising interrupts
+ * @param globalSystemInterrupt The input
+ */
+void IOAPIC::Mask(uint32_t globalSystemInterrupt) {
+
+    uint8_t entry = 0x10 + (globalSystemInterrupt - globalSystemInterruptBase) * 2;
+    Write(entry, Read(entry) | (1 << 16));
+
+}
+
+///__APIC__
+
+AdvancedProgrammableInterruptController* AdvancedProgrammableInterruptController::activeAPIC = 0;
+
+/**
+ * @details Find the APICs through the ACPI MADT and move the ISA interrupts from the PICs to them, keeping the same vectors
+ * @param interruptManager The interrupt manager to switch over
+ * @param acpi The ACPI tables
+ */
+AdvancedProgrammableInterruptController::AdvancedProgrammableInterruptController(InterruptManager* interruptManager, AdvancedConfigurationAndPowerInterface* acpi) {
+
+    localAPIC = 0;
+    numIOAPICs = 0;
+
+    //CPUID leaf 1 EDX bit 9 says if there is a local APIC
+    uint32_t eax, ebx, ecx, edx;
+    asm volatile("cpuid" : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx) : "a"(1));
+    if(!(edx & (1 << 9)))
+        return;
+
+    if(acpi == 0 || PageManager::activePageManager == 0 || !acpi -> ParseMADT(&description) || description.numIOAPICs == 0)
+        return;
+
+    localAPIC = new LocalAPIC(description.localAPICAddress);
+    for(int i = 0; i < description.numIOAPICs; ++i)
+        ioAPICs[numIOAPICs++] = new IOAPIC(description.ioAPICs[i].address, description.ioAPICs[i].globalSystemInterruptBase);
+
+    //IRQ 2 is the PIC cascade, it never fires
+    uint8_t destination = localAPIC -> ID();
+    for(uint8_t irq = 0; irq < 16; ++irq){
+
+        if(irq == 2)
+            continue;
+
+        //Skip IRQs whose input was taken over by another IRQ (e.g. the timer is usually wired to input 2)
+        bool taken = false;
+        for(int i = 0; i < description.numOverrides; ++i)
+            if(description.overrides[i].globalSystemInterrupt == irq && description.overrides[i].source != irq)
+                taken = true;
+
+        if(!taken)
+            RouteIRQ(irq, interruptManager -> HardwareInterruptOffset() + irq, destination);
+    }
+
+    interruptManager -> UseAPIC(localAPIC);
+    activeAPIC = this;
+
+}
+
+AdvancedProgrammableInterruptController::~AdvancedProgrammableInterruptController() {
+
+    if(activeAPIC == this)
+        activeAPIC = 0;
+
+}
+
+/**
+ * @details Check if the APIC was found and is in use
+ * @return True if interrupts go through the APIC
+ */
+bool AdvancedProgrammableInterruptController::IsAvailable() {
+    return localAPIC != 0;
+}
+
+/**
+ * @details Get the local APIC of this CPU
+ * @return The local APIC
+ */
+LocalAPIC* AdvancedProgrammableInterruptController::Local() {
+    return localAPIC;
+}
+
+/**
+ * @details Get what the MADT described
+ * @return The description
+ */
+MultipleAPICDescription* AdvancedProgrammableInterruptController::Description() {
+    return &description;
+}
+
+/**
+ * @details Find which processor of the MADT the code is running on, used to index per CPU data
+ * @return The position of the processor in the MADT, 0 if it isn't in there
+ */
+int AdvancedProgrammableInterruptController::CurrentCPU() {
+
+    if(localAPIC == 0)
+        return 0;
+
+    uint8_t id = localAPIC -> ID();
+    for(int i = 0; i < description.numProcessors; ++i)
+        if(description.processors[i].apicID == id)
+            return i;
+
+    return 0;
+}
+
+/**
+ * @details Find the IO APIC that handles an input
+ * @param globalSystemInterrupt The input
+ * @return The IO APIC, 0 if there isn't one
+ */
+IOAPIC* AdvancedProgrammableInterruptController::FindIOAPIC(uint32_t globalSystemInterrupt) {
+
+    for(int i = 0; i < numIOAPICs; ++i)
+        if(ioAPICs[i] -> Handles(globalSystemInterrupt))
+            return ioAPICs[i];
+
+    return 0;
+}
+
+/**
+ * @details Translate an ISA IRQ to the IO APIC input it is wired to
+ * @param irq The ISA IRQ
+ * @param flags Set to the polarity and trigger mode of the input
+ * @return The global system interrupt
+ */
+uint32_t AdvancedProgrammableInterruptController::GlobalSystemInterrupt(uint8_t irq, uint16_t* flags) {
+
+    for(int i = 0; i < description.numOverrides; ++i){
+        if(description.overrides[i].source == irq){
+            *flags = description.overrides[i].flags;
+            return description.overrides[i].globalSystemInterrupt;
+        }
+    }
+
+    *flags = 0;                                         //ISA defaults: active high, edge triggered
+    return irq;
+}
+
+/**
+ * @details Send an IRQ to a vector on a CPU
+ * @param irq The ISA IRQ
+ * @param vector The vector to raise, its upper 4 bits are its priority
+ * @param destination The APIC ID of the CPU that should handle it
+ * @return True if the IRQ is wired to an IO APIC
+ */
+bool AdvancedProgrammableInterruptController::RouteIRQ(uint8_t irq, uint8_t vector, uint8_t destination) {
+
+    uint16_t flags;
+    uint32_t globalSystemInterrupt = GlobalSystemInterrupt(irq, &flags);
+
+    IOAPIC* ioAPIC = FindIOAPIC(globalSystemInterrupt);
+    if(ioAPIC == 0)
+        return false;
+
+    ioAPIC -> SetRedirection(globalSystemInterrupt, vector, destination, flags);
+    return true;
+}
+
+/**
+ * @details Stop an IRQ from being delivered
+ * @param irq The ISA IRQ
+ */
+void AdvancedProgrammableInterruptController::MaskIRQ(uint8_t irq) {
+
+    uint16_t flags;
+    uint32_t globalSystemInterrupt = GlobalSystemInterrupt(irq, &flags);
+
+    IOAPIC* ioAPIC = FindIOAPIC(globalSystemInterrupt);
+    if(ioAPIC != 0)
+        ioAPIC -> Mask(globalSystemInterrupt);
+
+}
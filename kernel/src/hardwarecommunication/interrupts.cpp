@@ -3,6 +3,11 @@
 //
 
 #include <hardwarecommunication/interrupts.h>
+#include <system/clock.h>
+#include <hardwarecommunication/apic.h>
+#include <hardwarecommunication/serial.h>
+#include <system/trace.h>
+#include <system/process.h>
 
 using namespace maxOS;
 using namespace maxOS::common;
@@ -42,6 +47,7 @@ uint32_t InterruptHandler::HandleInterrupt(uint32_t esp){
 InterruptManager::GateDescriptor InterruptManager::interruptDescriptorTable[256];
 
 InterruptManager* InterruptManager::ActiveInterruptManager = 0;
+InterruptStatistics InterruptManager::statistics[256];
 
 /**
  * @details This function is used to set an entry in the IDT
@@ -77,6 +83,7 @@ InterruptManager::InterruptManager(uint16_t hardwareInterruptOffset, system::Glo
 {
     this->threadManager = threadManager;
     this->hardwareInterruptOffset = hardwareInterruptOffset;
+    this->localAPIC = 0;
     uint32_t CodeSegment = globalDescriptorTable->CodeSegmentSelector();
 
     //Set all the entry's to Ignore so that the ones we don't specify aren't run as there won't be a handler for these and therefore would have caused a protection error
@@ -131,7 +138,47 @@ InterruptManager::InterruptManager(uint16_t hardwareInterruptOffset, system::Glo
     SetInterruptDescriptorTableEntry(hardwareInterruptOffset + 0x0E, CodeSegment, &HandleInterruptRequest0x0E, 0, IDT_INTERRUPT_GATE);  //0x2E - Primary ATA Hard Disk
     SetInterruptDescriptorTableEntry(hardwareInterruptOffset + 0x0F, CodeSegment, &HandleInterruptRequest0x0F, 0, IDT_INTERRUPT_GATE);  //0x2F - Secondary ATA Hard Disk
 
-    SetInterruptDescriptorTableEntry(                          0x80, CodeSegment, &HandleInterruptRequest0x80, 0, IDT_INTERRUPT_GATE);  //0x80 - Sys calls
+    //0x30 - 0x4F - Message signalled interrupts, given to devices by AllocateMessageVectors
+    static void (* const messageHandlers[numMessageVectors])() = {
+            &HandleInterruptRequest0x10,
+            &HandleInterruptRequest0x11,
+            &HandleInterruptRequest0x12,
+            &HandleInterruptRequest0x13,
+            &HandleInterruptRequest0x14,
+            &HandleInterruptRequest0x15,
+            &HandleInterruptRequest0x16,
+            &HandleInterruptRequest0x17,
+            &HandleInterruptRequest0x18,
+            &HandleInterruptRequest0x19,
+            &HandleInterruptRequest0x1A,
+            &HandleInterruptRequest0x1B,
+            &HandleInterruptRequest0x1C,
+            &HandleInterruptRequest0x1D,
+            &HandleInterruptRequest0x1E,
+            &HandleInterruptRequest0x1F,
+            &HandleInterruptRequest0x20,
+            &HandleInterruptRequest0x21,
+            &HandleInterruptRequest0x22,
+            &HandleInterruptRequest0x23,
+            &HandleInterruptRequest0x24,
+            &HandleInterruptRequest0x25,
+            &HandleInterruptRequest0x26,
+            &HandleInterruptRequest0x27,
+            &HandleInterruptRequest0x28,
+            &HandleInterruptRequest0x29,
+            &HandleInterruptRequest0x2A,
+            &HandleInterruptRequest0x2B,
+            &HandleInterruptRequest0x2C,
+            &HandleInterruptRequest0x2D,
+            &HandleInterruptRequest0x2E,
+            &HandleInterruptRequest0x2F,
+    };
+    for(int i = 0; i < numMessageVectors; ++i)
+        SetInterruptDescriptorTableEntry(hardwareInterruptOffset + 0x10 + i, CodeSegment, messageHandlers[i], 0, IDT_INTERRUPT_GATE);
+    usedMessageVectors = 0;
+    unhandledInterrupts = 0;
+
+    SetInterruptDescriptorTableEntry(                          0x80, CodeSegment, &HandleInterruptRequest0x80, 3, IDT_INTERRUPT_GATE);  //0x80 - Sys calls (DPL 3 so user processes can call it)
 
     //Send Initialization Control Words
     programmableInterruptControllerMasterCommandPort.Write(0x11);
@@ -216,14 +263,44 @@ uint32_t InterruptManager::HandleInterrupt(uint8_t interrupt, uint32_t esp)
  */
 uint32_t InterruptManager::DoHandleInterrupt(uint8_t interrupt, uint32_t esp)
 {
+    InterruptStatistics* vector = &statistics[interrupt];
+
     if(handlers[interrupt]!= 0){                                //If it has a handler for it
+
+        Tracer::Trace(TRACE_INTERRUPT_ENTER, interrupt, threadManager->CurrentPID());
+        uint64_t start = Clock::ReadTimestampCounter();
+
         esp = handlers[interrupt]->HandleInterrupt(esp);        //Run the handler
+
+        uint64_t ticks = Clock::ReadTimestampCounter() - start;
+        Tracer::Trace(TRACE_INTERRUPT_EXIT, interrupt, threadManager->CurrentPID());
+
+        //Time spent in device handlers is charged to whichever thread they interrupted
+        if(hardwareInterruptOffset <= interrupt && interrupt < hardwareInterruptOffset + 16 + numMessageVectors)
+            threadManager->AccountInterrupt(ticks);
+
+        //Bucket by the highest set bit, anything past 2^32 ticks goes in the last one
+        uint32_t bucket = 31;
+        if((ticks >> 32) == 0)
+            bucket = (uint32_t)ticks == 0 ? 0 : 31 - __builtin_clz((uint32_t)ticks);
+
+        vector->count++;
+        vector->totalTicks += ticks;
+        if(ticks > vector->maxTicks)
+            vector->maxTicks = ticks;
+        vector->histogram[bucket]++;
+
     }else{
-        if(interrupt != 0x20){   //If not the timer interrupt
-            printf("UNHANDLED INTERRUPT 0x");
-            printfHex(interrupt);
-            printf(" ");
+
+        //Printing here would make an interrupt storm worse, count it and let DumpStatistics report it
+        if(interrupt != hardwareInterruptOffset){
+            vector->unhandled++;
+            unhandledInterrupts++;
         }
+
+        //A CPU exception can't be ignored, returning would just run the faulting instruction again (NMIs are not caused by the code)
+        if(interrupt < 0x20 && interrupt != 0x02)
+            return HandleFault(interrupt, esp);
     }
 
     //TODO: Cast CPUState and uin3t esp to same
@@ -236,7 +313,11 @@ uint32_t InterruptManager::DoHandleInterrupt(uint8_t interrupt, uint32_t esp)
 
     }
 
-    if(hardwareInterruptOffset <= interrupt && interrupt < hardwareInterruptOffset+16) //Only if it is hardware (keep in mind that around line: 90, the hardware interrupt was remapped at 0x20) the hardware ranges from 0x20 to 0x30
+    if(localAPIC != 0 && hardwareInterruptOffset <= interrupt && interrupt < hardwareInterruptOffset + 16 + numMessageVectors)
+    {
+        localAPIC->EndOfInterrupt();                                       //One MMIO write instead of slow port writes to both PICs
+    }
+    else if(hardwareInterruptOffset <= interrupt && interrupt < hardwareInterruptOffset+16) //Only if it is hardware (keep in mind that around line: 90, the hardware interrupt was remapped at 0x20) the hardware ranges from 0x20 to 0x30
     {
         //Send Answer to tell PIC the interrupt was received
         programmableInterruptControllerMasterCommandPort.Write(0x20);      //0x20 is the answer the PIC wants for master
@@ -251,6 +332,211 @@ uint32_t InterruptManager::DoHandleInterrupt(uint8_t interrupt, uint32_t esp)
     return esp;
 }
 
+/**
+ * @details Deal with a CPU exception that nothing handled: the user process that caused it is killed, in the kernel it is fatal
+ * @param interrupt The exception vector
+ * @param esp The stack frame
+ * @return The stack frame of the next thread to run
+ */
+uint32_t InterruptManager::HandleFault(uint8_t interrupt, uint32_t esp)
+{
+    CPUState_Thread* cpu = (CPUState_Thread*)esp;
+
+    printf("\nEXCEPTION 0x");
+    printfHex(interrupt);
+    printf(" at 0x");
+    printfHex((cpu -> eip >> 24) & 0xFF);
+    printfHex((cpu -> eip >> 16) & 0xFF);
+    printfHex((cpu -> eip >> 8 ) & 0xFF);
+    printfHex((cpu -> eip      ) & 0xFF);
+
+    //A user process can just be killed
+    if((cpu -> cs & 3) == 3 && ProcessManager::activeProcessManager != 0){
+        printf(", killing process\n");
+        uint32_t next = ProcessManager::activeProcessManager -> Exit(esp);
+        if(next != esp)
+            return next;
+    }
+
+    //The kernel can't continue
+    printf(" in the kernel\n");
+    while(true)
+        asm volatile("cli; hlt");
+
+    return esp;
+}
+
+/**
+ * @details Switch to acknowledging interrupts through the local APIC, the PICs are masked so they can't raise anything anymore
+ * @param localAPIC The local APIC of this CPU
+ */
+void InterruptManager::UseAPIC(LocalAPIC* localAPIC) {
+
+    programmableInterruptControllerMasterDataPort.Write(0xFF);
+    programmableInterruptControllerSlaveDataPort.Write(0xFF);
+
+    this->localAPIC = localAPIC;
+
+}
+
+/**
+ * @details Reserve vectors for a device's message signalled interrupts. They are only delivered through the local APIC so this fails without one
+ * @param count How many vectors (a power of two, the block is aligned to its size as MSI needs)
+ * @return The first interrupt number, -1 if there aren't enough free
+ */
+int InterruptManager::AllocateMessageVectors(int count) {
+
+    if(localAPIC == 0 || count <= 0 || count > numMessageVectors || (count & (count - 1)) != 0)
+        return -1;
+
+    uint32_t mask = count == 32 ? 0xFFFFFFFF : ((1u << count) - 1);
+    for(int first = 0; first < numMessageVectors; first += count){
+        if(usedMessageVectors & (mask << first))
+            continue;
+
+        usedMessageVectors |= mask << first;
+        return hardwareInterruptOffset + 0x10 + first;
+    }
+
+    return -1;
+}
+
+/**
+ * @details Give back vectors from AllocateMessageVectors
+ * @param interrupt The first interrupt number
+ * @param count How many vectors
+ */
+void InterruptManager::FreeMessageVectors(uint8_t interrupt, int count) {
+
+    for(int i = 0; i < count; ++i){
+        int index = interrupt + i - (hardwareInterruptOffset + 0x10);
+        if(index >= 0 && index < numMessageVectors)
+            usedMessageVectors &= ~(1u << index);
+    }
+
+}
+
+/**
+ * @details Get what the dispatcher measured for a vector
+ * @param interrupt The interrupt number
+ * @return The statistics
+ */
+InterruptStatistics* InterruptManager::Statistics(uint8_t interrupt) {
+    return &statistics[interrupt];
+}
+
+/**
+ * @details Get how many interrupts arrived that had no handler
+ * @return The number across every vector
+ */
+uint32_t InterruptManager::UnhandledInterrupts() {
+    return unhandledInterrupts;
+}
+
+/**
+ * @details Start measuring again from zero
+ */
+void InterruptManager::ResetStatistics() {
+
+    uint32_t flags = DisableInterrupts();
+
+    for(int i = 0; i < 256; ++i){
+        statistics[i].count = 0;
+        statistics[i].totalTicks = 0;
+        statistics[i].maxTicks = 0;
+        statistics[i].unhandled = 0;
+        for(int bucket = 0; bucket < 32; ++bucket)
+            statistics[i].histogram[bucket] = 0;
+    }
+    unhandledInterrupts = 0;
+
+    RestoreInterrupts(flags);
+
+}
+
+/**
+ * @details Write the count, rate, handler time and time histogram of every vector that has been raised to the serial port
+ * @param log The serial port
+ */
+void InterruptManager::DumpStatistics(serial* log) {
+
+    if(log == 0)
+        return;
+
+    //Rates are per second of uptime, so they are only known once the clock is running
+    uint32_t seconds = 0, nanoseconds = 0;
+    if(Clock::activeClock != 0)
+        Clock::activeClock->GetTime(&seconds, &nanoseconds);
+    uint32_t ticksPerMillisecond = Clock::activeClock == 0 ? 0 : Clock::activeClock->TicksPerMillisecond();
+
+    log->Write("Interrupt statistics after ", 6);
+    log->WriteNumber(seconds);
+    log->Write("s (TSC ticks per ms: ", -1);
+    log->WriteNumber(ticksPerMillisecond);
+    log->Write(")\n", -1);
+
+    for(int i = 0; i < 256; ++i){
+
+        //Copy the counters out so an interrupt can't change them half way through (field by field, there is no memcpy)
+        InterruptStatistics vector;
+        uint32_t flags = DisableInterrupts();
+        vector.count = statistics[i].count;
+        vector.totalTicks = statistics[i].totalTicks;
+        vector.maxTicks = statistics[i].maxTicks;
+        vector.unhandled = statistics[i].unhandled;
+        for(int bucket = 0; bucket < 32; ++bucket)
+            vector.histogram[bucket] = statistics[i].histogram[bucket];
+        RestoreInterrupts(flags);
+
+        if(vector.count == 0 && vector.unhandled == 0)
+            continue;
+
+        log->Write("  vector ", -1);
+        log->WriteHex(i);
+        log->Write(": count ", -1);
+        log->WriteNumber(vector.count);
+        if(seconds != 0 && (vector.count >> 32) == 0){
+            log->Write(" (", -1);
+            log->WriteNumber((uint32_t)vector.count / seconds);
+            log->Write("/s)", -1);
+        }
+
+        if(vector.count != 0){
+            log->Write(", max ", -1);
+            log->WriteNumber(vector.maxTicks);
+            log->Write(", total ", -1);
+            log->WriteNumber(vector.totalTicks);
+        }
+
+        if(vector.unhandled != 0){
+            log->Write(", unhandled ", -1);
+            log->WriteNumber(vector.unhandled);
+        }
+        log->Write("\n", -1);
+
+        if(vector.count == 0)
+            continue;
+
+        //Only the buckets that were hit, as "2^n: count"
+        log->Write("    ticks log2:", -1);
+        for(int bucket = 0; bucket < 32; ++bucket){
+            if(vector.histogram[bucket] == 0)
+                continue;
+
+            log->Write(" ", -1);
+            log->WriteNumber(bucket);
+            log->Write(":", -1);
+            log->WriteNumber(vector.histogram[bucket]);
+        }
+        log->Write("\n", -1);
+    }
+
+    log->Write("  unhandled total: ", -1);
+    log->WriteNumber(unhandledInterrupts);
+    log->Write("\n", -1);
+
+}
+
 /**
  * @details This function returns the offset of the hardware interrupt
  * @return The offset of the hardware interrupt
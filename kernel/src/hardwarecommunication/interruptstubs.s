@@ -11,7 +11,10 @@
 .global _ZN5maxOS21hardwarecommunication16InterruptManager19HandleException\num\()Ev
 _ZN5maxOS21hardwarecommunication16InterruptManager19HandleException\num\()Ev:
     movb $\num, (interruptnumber)
-    #For an exception , the processor pushes an error value automatically
+    #For some exceptions the processor pushes an error value automatically, push 0 for the rest so the stack always matches CPUState
+    .if (\num != 0x08) && ((\num < 0x0A) || (\num > 0x0E)) && (\num != 0x11)
+    pushl $0
+    .endif
     jmp int_bottom
 .endm
 
@@ -63,6 +66,38 @@ HandleInterruptRequest 0x0C
 HandleInterruptRequest 0x0D
 HandleInterruptRequest 0x0E
 HandleInterruptRequest 0x0F
+HandleInterruptRequest 0x10
+HandleInterruptRequest 0x11
+HandleInterruptRequest 0x12
+HandleInterruptRequest 0x13
+HandleInterruptRequest 0x14
+HandleInterruptRequest 0x15
+HandleInterruptRequest 0x16
+HandleInterruptRequest 0x17
+HandleInterruptRequest 0x18
+HandleInterruptRequest 0x19
+HandleInterruptRequest 0x1A
+HandleInterruptRequest 0x1B
+HandleInterruptRequest 0x1C
+HandleInterruptRequest 0x1D
+HandleInterruptRequest 0x1E
+HandleInterruptRequest 0x1F
+HandleInterruptRequest 0x20
+HandleInterruptRequest 0x21
+HandleInterruptRequest 0x22
+HandleInterruptRequest 0x23
+HandleInterruptRequest 0x24
+HandleInterruptRequest 0x25
+HandleInterruptRequest 0x26
+HandleInterruptRequest 0x27
+HandleInterruptRequest 0x28
+HandleInterruptRequest 0x29
+HandleInterruptRequest 0x2A
+HandleInterruptRequest 0x2B
+HandleInterruptRequest 0x2C
+HandleInterruptRequest 0x2D
+HandleInterruptRequest 0x2E
+HandleInterruptRequest 0x2F
 HandleInterruptRequest 0x31
 HandleInterruptRequest 0x80
 
@@ -2,7 +2,10 @@
 // Created by 98max on 12/10/2022.
 //
 #include <hardwarecommunication/pci.h>
-#include <drivers/amd_am79c973.h>
+#include <hardwarecommunication/acpi.h>
+#include <hardwarecommunication/apic.h>
+#include <system/paging.h>
+#include <system/boottime.h>
 
 using namespace maxOS::common;
 using namespace maxOS::hardwarecommunication;
@@ -12,12 +15,35 @@ using namespace maxOS::system;
 void printf(char* str, bool clearLine = false); //Forward declaration
 void printfHex(uint8_t key);                    //Forward declaration
 
+//Set by the linker around the REGISTER_PCI_DRIVER entries
+extern "C" PeripheralComponentInterconnectDriverEntry start_pci_drivers;
+extern "C" PeripheralComponentInterconnectDriverEntry end_pci_drivers;
 
 
+///__BAR___
+
+BaseAdressRegister::BaseAdressRegister() {
+
+    preFetchable = false;
+    is64Bit = false;
+    adress = 0;
+    physicalAddress = 0;
+    size = 0;
+    type = MemoryMapping;
+
+}
+
 ///__DESCRIPTOR___
 
 PeripheralComponentInterconnectDeviceDescriptor::PeripheralComponentInterconnectDeviceDescriptor() {
 
+    portBase = 0;
+    interrupt = 0;
+    headerType = 0;
+    driver = 0;
+    msixTable = 0;
+    msixTableSize = 0;
+
 }
 
 PeripheralComponentInterconnectDeviceDescriptor::~PeripheralComponentInterconnectDeviceDescriptor() {
@@ -26,16 +52,63 @@ PeripheralComponentInterconnectDeviceDescriptor::~PeripheralComponentInterconnec
 
 ///__CONTROLLER___
 
+PeripheralComponentInterconnectController* PeripheralComponentInterconnectController::activeController = 0;
+
 PeripheralComponentInterconnectController::PeripheralComponentInterconnectController()
 : dataPort(0xCFC),      //PCI Controller
   commandPort(0xCF8)    //PCI Controller
 
 {
 
+    numDevices = 0;
+    enumerated = false;
+    activeController = this;
+
+    //Use ECAM if the firmware describes it, one MMIO access per dword instead of two port writes
+    ecam = 0;
+    ecamStartBus = 0;
+    ecamEndBus = 0;
+
+    PCIExpressDescription mcfg;
+    AdvancedConfigurationAndPowerInterface* acpi = AdvancedConfigurationAndPowerInterface::activeACPI;
+    if(acpi != 0 && PageManager::activePageManager != 0 && acpi -> ParseMCFG(&mcfg)){
+
+        //Every bus takes 1MB of address space, so only map the first few
+        ecamStartBus = mcfg.startBus;
+        ecamEndBus = mcfg.endBus;
+        if(ecamEndBus - ecamStartBus >= maxECAMBuses)
+            ecamEndBus = ecamStartBus + maxECAMBuses - 1;
+
+        ecam = (volatile uint8_t*)PageManager::activePageManager -> MapPhysicalMemory(mcfg.baseAddress, (uint32_t)(ecamEndBus - ecamStartBus + 1) << 20, PAGE_CACHE_DISABLE);
+    }
+
 }
 
 PeripheralComponentInterconnectController::~PeripheralComponentInterconnectController() {
 
+    if(activeController == this)
+        activeController = 0;
+
+}
+
+/**
+ * Get where a register is in the memory mapped config space
+ * @param bus Bus number
+ * @param device Device number
+ * @param function Function number
+ * @param registeroffset Register offset (0-4095)
+ * @return The dword holding the register, 0 if the bus isn't covered by ECAM
+ */
+volatile uint32_t* PeripheralComponentInterconnectController::ECAMAddress(uint16_t bus, uint16_t device, uint16_t function, uint32_t registeroffset) {
+
+    if(ecam == 0 || bus < ecamStartBus || bus > ecamEndBus)
+        return 0;
+
+    return (volatile uint32_t*)(ecam
+            + ((uint32_t)(bus - ecamStartBus) << 20)
+            + ((device & 0x1F) << 15)
+            + ((function & 0x07) << 12)
+            + (registeroffset & 0xFFC));
 }
 
 /**
@@ -43,10 +116,18 @@ PeripheralComponentInterconnectController::~PeripheralComponentInterconnectContr
  * @param bus Bus number
  * @param device Device number
  * @param function Function number
- * @param registeroffset Register offset
+ * @param registeroffset Register offset, above 0xFF is the extended config space which only ECAM can reach
  * @return  data from the PCI Controller
  */
 uint32_t PeripheralComponentInterconnectController::Read(uint16_t bus, uint16_t device, uint16_t function, uint32_t registeroffset) {
+
+    volatile uint32_t* memoryMapped = ECAMAddress(bus, device, function, registeroffset);
+    if(memoryMapped != 0)
+        return *memoryMapped >> (8* (registeroffset % 4));
+
+    if(registeroffset > 0xFF)
+        return 0xFFFFFFFF;                  //What a missing register reads as
+
     //Structure of the address I / O port :
     //31    | Enable bit
     //30-24 | Reserved
@@ -72,10 +153,20 @@ uint32_t PeripheralComponentInterconnectController::Read(uint16_t bus, uint16_t
  * @param bus Bus number
  * @param device Device number
  * @param function Function number
- * @param registeroffset Register offset
+ * @param registeroffset Register offset, above 0xFF is the extended config space which only ECAM can reach
  * @param value Value to write
  */
 void PeripheralComponentInterconnectController::Write(uint16_t bus, uint16_t device, uint16_t function, uint32_t registeroffset, uint32_t value) {
+
+    volatile uint32_t* memoryMapped = ECAMAddress(bus, device, function, registeroffset);
+    if(memoryMapped != 0){
+        *memoryMapped = value;
+        return;
+    }
+
+    if(registeroffset > 0xFF)
+        return;
+
     uint32_t id =
             0x1 << 31
             | ((bus & 0xFF) << 16)
@@ -86,6 +177,14 @@ void PeripheralComponentInterconnectController::Write(uint16_t bus, uint16_t dev
     dataPort.Write(value);
 }
 
+/**
+ * Check if registers past the first 256 bytes of config space can be reached
+ * @return True if config space is memory mapped
+ */
+bool PeripheralComponentInterconnectController::HasExtendedConfigSpace() {
+    return ecam != 0;
+}
+
 /**
  * Check if the device has a function
  * @param bus Bus number
@@ -98,6 +197,159 @@ bool PeripheralComponentInterconnectController::DeviceHasFunctions(uint16_t bus,
     return Read(bus,device,0,0x0E) & (1<<7);    //Read address, the 7th bit of it returns if there is a function
 }
 
+/**
+ * Scan the PCI hierarchy once and remember every function found, later lookups use the list instead of config space
+ */
+void PeripheralComponentInterconnectController::Enumerate() {
+
+    if(enumerated)
+        return;
+    enumerated = true;
+
+    //If the host bridge is multifunction each of its functions is the host controller of the bus with the same number
+    if(!DeviceHasFunctions(0, 0)){
+        EnumerateBus(0, 0);
+        return;
+    }
+
+    for(uint16_t function = 0; function < 8; ++function)
+        if((Read(0, 0, function, 0x00) & 0xFFFF) != 0xFFFF)
+            EnumerateBus(function, 0);
+}
+
+/**
+ * Find every device on a bus
+ * @param bus Bus number
+ * @param depth How many bridges are between it and the host, stops a misconfigured bridge from recursing forever
+ */
+void PeripheralComponentInterconnectController::EnumerateBus(uint16_t bus, int depth) {
+
+    for(uint16_t device = 0; device < 32; ++device){
+
+        //Don't look at the other functions if function 0 isn't there
+        uint16_t vendor = Read(bus, device, 0, 0x00);
+        if(vendor == 0x0000 || vendor == 0xFFFF)
+            continue;
+
+        int numFunctions = DeviceHasFunctions(bus, device) ? 8 : 1;
+        for(uint16_t function = 0; function < numFunctions; ++function)
+            EnumerateFunction(bus, device, function, depth);
+    }
+}
+
+/**
+ * Add a function to the device list, and scan the bus behind it if it is a PCI-to-PCI bridge
+ * @param bus Bus number
+ * @param device Device number
+ * @param function Function number
+ * @param depth How many bridges are between it and the host
+ */
+void PeripheralComponentInterconnectController::EnumerateFunction(uint16_t bus, uint16_t device, uint16_t function, int depth) {
+
+    //If there is no device then vendor ID is 0x0000, If the device is not ready to react then the vendor ID is 0x0001
+    uint16_t vendor = Read(bus, device, function, 0x00);
+    if(vendor == 0x0000 || vendor == 0x0001 || vendor == 0xFFFF || numDevices >= maxDevices)
+        return;
+
+    PeripheralComponentInterconnectDeviceDescriptor* dev = &devices[numDevices++];
+    dev -> bus = bus;
+    dev -> device = device;
+    dev -> function = function;
+
+    dev -> vendor_ID = vendor;
+    dev -> device_ID = Read(bus, device, function, 0x02);
+
+    dev -> class_id = Read(bus, device, function, 0x0B);
+    dev -> subclass_id = Read(bus, device, function, 0x0A);
+    dev -> interface_id = Read(bus, device, function, 0x09);
+
+    dev -> revision = Read(bus, device, function, 0x08);
+    dev -> interrupt = Read(bus, device, function, 0x3C);
+    dev -> headerType = Read(bus, device, function, 0x0E) & 0x7F;
+
+    //Only the raw values are read here, sizing a BAR means turning off decoding so that is left to the driver that claims the device
+    dev -> portBase = 0;
+    int numBars = dev -> headerType == 0x00 ? 6 : (dev -> headerType == 0x01 ? 2 : 0);
+    for (int barNum = 0; barNum < numBars; ++barNum) {
+        uint32_t bar = Read(bus, device, function, 0x10 + (barNum * 4));
+
+        if(!(bar & 0x1)){
+            if(((bar >> 1) & 0x3) == 2)             //The next slot is the upper half of a 64 bit memory BAR
+                barNum++;
+            continue;
+        }
+
+        if(bar & ~0x3)                              //Only if the address is really set
+            dev -> portBase = bar & 0xFFFC;         //The port number of an I/O BAR
+    }
+
+    //Bridges number their buses below the one they are on, anything else would loop
+    if(dev -> class_id == 0x06 && dev -> subclass_id == 0x04 && dev -> headerType == 0x01 && depth < 16){
+
+        uint16_t secondaryBus = Read(bus, device, function, 0x19) & 0xFF;
+        if(secondaryBus > bus)
+            EnumerateBus(secondaryBus, depth + 1);
+    }
+}
+
+/**
+ * Get how many functions were found
+ * @return The amount of devices in the list
+ */
+int PeripheralComponentInterconnectController::NumDevices() {
+
+    Enumerate();
+    return numDevices;
+}
+
+/**
+ * Get a function from the device list
+ * @param index The position in the list
+ * @return The device descriptor, 0 if the index is out of range
+ */
+PeripheralComponentInterconnectDeviceDescriptor* PeripheralComponentInterconnectController::GetDevice(int index) {
+
+    Enumerate();
+    if(index < 0 || index >= numDevices)
+        return 0;
+
+    return &devices[index];
+}
+
+/**
+ * Find a device by its IDs
+ * @param vendor_ID Vendor ID
+ * @param device_ID Device ID, PCI_VENDOR_ANY for any device of the vendor
+ * @return The first matching device descriptor, 0 if there isn't one
+ */
+PeripheralComponentInterconnectDeviceDescriptor* PeripheralComponentInterconnectController::FindDevice(uint16_t vendor_ID, uint16_t device_ID) {
+
+    Enumerate();
+    for(int i = 0; i < numDevices; ++i)
+        if(devices[i].vendor_ID == vendor_ID && (device_ID == PCI_VENDOR_ANY || devices[i].device_ID == device_ID))
+            return &devices[i];
+
+    return 0;
+}
+
+/**
+ * Find a device by what it is (e.g. 0x01, 0x01 for IDE controllers)
+ * @param class_id Class
+ * @param subclass_id Subclass
+ * @param after Continue the search after this device, 0 to start at the beginning
+ * @return The next matching device descriptor, 0 if there isn't one
+ */
+PeripheralComponentInterconnectDeviceDescriptor* PeripheralComponentInterconnectController::FindClass(uint8_t class_id, uint8_t subclass_id, PeripheralComponentInterconnectDeviceDescriptor* after) {
+
+    Enumerate();
+    int start = after == 0 ? 0 : (int)(after - devices) + 1;
+    for(int i = start; i < numDevices; ++i)
+        if(devices[i].class_id == class_id && devices[i].subclass_id == subclass_id)
+            return &devices[i];
+
+    return 0;
+}
+
 /**
  * Select the driver for the device
  * @param driverManager device driver manager
@@ -105,57 +357,237 @@ bool PeripheralComponentInterconnectController::DeviceHasFunctions(uint16_t bus,
  * @return Driver for the device
  */
 void PeripheralComponentInterconnectController::SelectDrivers(DriverManager* driverManager, InterruptManager* interruptManager) {
-    for (int bus = 0; bus < 8; ++bus) {
 
-        for (int device = 0; device < 32; ++device) {
+    Enumerate();
+
+    for (int i = 0; i < numDevices; ++i) {
+
+        PeripheralComponentInterconnectDeviceDescriptor* dev = &devices[i];
+        int probe = BootTimeline::BeginProbe("pci", (dev -> bus << 16) | (dev -> device << 8) | dev -> function);
+
+        //Only need one driver for the device, not every BAR
+        if(dev -> driver == 0){
+            dev -> driver = GetDriver(dev, interruptManager);
+            if(dev -> driver != 0)    //If there is a driver
+                driverManager->AddDriver(dev -> driver);
+        }
+
+        BootTimeline::EndProbe(probe);
+
+
+        //Display INFO
+        printf("    PCI BUS ");
+        printfHex(dev -> bus & 0xFF);
 
-            int numFunctions = (DeviceHasFunctions(bus,device)) ? 8 : 1;
+        printf(", DEVICE ");
+        printfHex(dev -> device & 0xFF);
 
-            for (int function = 0; function < numFunctions; ++function) {
-                PeripheralComponentInterconnectDeviceDescriptor deviceDescriptor = GetDeviceDescriptor(bus, device, function);
+        printf(", FUNCTION ");
+        printfHex(dev -> function & 0xFF);
 
-                //If there is no device then vendor ID is 0x0000, If the device is not ready to react then the vendor ID is 0x0001   (REMOVE 0xFFFF if things go wrong)
-                if(deviceDescriptor.vendor_ID == 0x0000 || deviceDescriptor.vendor_ID == 0x0001 || deviceDescriptor.vendor_ID == 0xFFFF){
-                    continue;
-                }
+        printf(", VENDOR ");
+        printfHex((dev -> vendor_ID & 0xFF00) >> 8);
+        printfHex(dev -> vendor_ID & 0xFF);
 
-                for (int barNum = 0; barNum < 6; ++barNum) {
-                    BaseAdressRegister bar = GetBaseAdressRegister(bus,device,function, barNum);
-                    if(bar.adress && (bar.type == InputOutput)){ //Only if the address is really set
-                        deviceDescriptor.portBase = (uint32_t)bar.adress;  //The adress returned is the port number for an I/O bar (for memory mapping it would be mem adress)
-                    }
-                }
+        printf(", DEVICE ");
+        printfHex((dev -> device_ID & 0xFF00) >> 8);
+        printfHex(dev -> device_ID & 0xFF);
 
-                //Only need one driver for the device, not every BAR
-                Driver* driver = GetDriver(deviceDescriptor, interruptManager);
-                if(driver != 0){    //If there is a driver
-                    driverManager->AddDriver(driver);
-                }
+        printf("\n");
+    }
+}
+
+/**
+ * Find a capability in the device's capability list
+ * @param bus Bus number
+ * @param device Device number
+ * @param function Function number
+ * @param id The capability ID (PeripheralComponentInterconnectCapability)
+ * @return Offset of the capability in the configuration space, 0 if the device doesn't have it
+ */
+uint8_t PeripheralComponentInterconnectController::FindCapability(uint16_t bus, uint16_t device, uint16_t function, uint8_t id) {
+
+    if(!(Read(bus, device, function, 0x06) & (1 << 4)))                    //Status bit 4: there is a capability list
+        return 0;
 
+    //Follow the list, a broken device could make it loop so give up after the most that fits
+    uint8_t pointer = Read(bus, device, function, 0x34) & 0xFC;
+    for(int i = 0; i < 48 && pointer != 0; ++i){
+
+        uint32_t header = Read(bus, device, function, pointer);
+        if((header & 0xFF) == id)
+            return pointer;
+
+        pointer = (header >> 8) & 0xFC;
+    }
 
-                //Display INFO
-                printf("    PCI BUS ");
-                printfHex(bus & 0xFF);
+    return 0;
+}
 
-                printf(", DEVICE ");
-                printfHex(device & 0xFF);
+/**
+ * Find a capability in the device's extended capability list (PCIe only)
+ * @param bus Bus number
+ * @param device Device number
+ * @param function Function number
+ * @param id The extended capability ID (PeripheralComponentInterconnectExtendedCapability)
+ * @return Offset of the capability in the configuration space, 0 if the device doesn't have it or the extended config space can't be reached
+ */
+uint16_t PeripheralComponentInterconnectController::FindExtendedCapability(uint16_t bus, uint16_t device, uint16_t function, uint16_t id) {
 
-                printf(", FUNCTION ");
-                printfHex(function & 0xFF);
+    if(ECAMAddress(bus, device, function, 0x100) == 0)
+        return 0;
 
-                printf(", VENDOR ");
-                printfHex((deviceDescriptor.vendor_ID & 0xFF00) >> 8);
-                printfHex(deviceDescriptor.vendor_ID & 0xFF);
+    //Bits 0-15 are the ID, bits 20-31 the next offset. Conventional devices read 0 or all ones here
+    uint16_t pointer = 0x100;
+    for(int i = 0; i < 960 && pointer >= 0x100; ++i){
 
-                printf(", DEVICE ");
-                printfHex((deviceDescriptor.device_ID & 0xFF00) >> 8);
-                printfHex(deviceDescriptor.device_ID & 0xFF);
+        uint32_t header = Read(bus, device, function, pointer);
+        if(header == 0 || header == 0xFFFFFFFF)
+            return 0;
 
-                printf("\n");
-            }
+        if((header & 0xFFFF) == id)
+            return pointer;
 
-        }
+        pointer = (header >> 20) & 0xFFC;
     }
+
+    return 0;
+}
+
+/**
+ * Check if message signalled interrupts can be used at all, they are delivered to the local APIC and some chipsets can't do them
+ * @return The address devices should write the message to, 0 if they can't be used
+ */
+static uint32_t MessageAddress(){
+
+    AdvancedProgrammableInterruptController* apic = AdvancedProgrammableInterruptController::activeAPIC;
+    if(apic == 0 || !apic -> IsAvailable())
+        return 0;
+
+    FixedACPIDescription fadt;
+    AdvancedConfigurationAndPowerInterface* acpi = AdvancedConfigurationAndPowerInterface::activeACPI;
+    if(acpi != 0 && acpi -> ParseFADT(&fadt) && (fadt.bootArchitectureFlags & BOOT_NO_MSI))
+        return 0;
+
+    return 0xFEE00000 | ((uint32_t)apic -> Local() -> ID() << 12);       //Fixed delivery to this CPU
+}
+
+/**
+ * Switch a device from its shared INTx line to MSI
+ * @param dev Device descriptor
+ * @param interruptManager Interrupt manager to allocate the vectors from
+ * @param count How many vectors the device should get (rounded up to a power of two, limited to what the device supports)
+ * @return The first interrupt number, the device uses consecutive ones from it. -1 if MSI isn't available
+ */
+int PeripheralComponentInterconnectController::EnableMSI(PeripheralComponentInterconnectDeviceDescriptor* dev, InterruptManager* interruptManager, int count) {
+
+    uint32_t address = MessageAddress();
+    uint8_t capability = FindCapability(dev -> bus, dev -> device, dev -> function, PCI_CAPABILITY_MSI);
+    if(address == 0 || capability == 0)
+        return -1;
+
+    uint32_t header = Read(dev -> bus, dev -> device, dev -> function, capability);
+    uint16_t control = header >> 16;
+
+    //Message control bits 1-3: log2 of the vectors the device can use
+    int supported = 1 << ((control >> 1) & 0x7);
+    int vectors = 1;
+    int log2Vectors = 0;
+    while(vectors < count && vectors < supported){
+        vectors <<= 1;
+        log2Vectors++;
+    }
+
+    int interrupt = interruptManager -> AllocateMessageVectors(vectors);
+    if(interrupt < 0)
+        return -1;
+
+    //The device adds its vector number to the low bits of the data
+    Write(dev -> bus, dev -> device, dev -> function, capability + 4, address);
+    uint8_t dataOffset = capability + 8;
+    if(control & (1 << 7)){                                                 //64 bit address
+        Write(dev -> bus, dev -> device, dev -> function, capability + 8, 0);
+        dataOffset = capability + 12;
+    }
+    uint32_t data = Read(dev -> bus, dev -> device, dev -> function, dataOffset);
+    Write(dev -> bus, dev -> device, dev -> function, dataOffset, (data & 0xFFFF0000) | interrupt);
+
+    //Enable it with the amount of vectors (bits 4-6), and stop the device using INTx
+    control = (control & ~0x70) | (log2Vectors << 4) | 0x1;
+    Write(dev -> bus, dev -> device, dev -> function, capability, (header & 0xFFFF) | ((uint32_t)control << 16));
+
+    uint32_t command = Read(dev -> bus, dev -> device, dev -> function, 0x04) & 0xFFFF;
+    Write(dev -> bus, dev -> device, dev -> function, 0x04, command | (1 << 10));
+
+    dev -> interrupt = interrupt - interruptManager -> HardwareInterruptOffset();
+    return interrupt;
+}
+
+/**
+ * Switch a device to MSI-X, every entry starts masked until AllocateMSIXVector gives it a vector
+ * @param dev Device descriptor, the table is stored in it
+ * @return True if the device now uses MSI-X
+ */
+bool PeripheralComponentInterconnectController::EnableMSIX(PeripheralComponentInterconnectDeviceDescriptor* dev) {
+
+    uint8_t capability = FindCapability(dev -> bus, dev -> device, dev -> function, PCI_CAPABILITY_MSIX);
+    if(MessageAddress() == 0 || capability == 0 || PageManager::activePageManager == 0)
+        return false;
+
+    uint32_t header = Read(dev -> bus, dev -> device, dev -> function, capability);
+    uint16_t control = header >> 16;
+    uint16_t tableSize = (control & 0x7FF) + 1;
+
+    //The table is in one of the device's memory BARs (the low 3 bits pick which), it has to be uncached even if the BAR is prefetchable
+    uint32_t tableLocation = Read(dev -> bus, dev -> device, dev -> function, capability + 4);
+    BaseAdressRegister bar = GetBaseAdressRegister(dev -> bus, dev -> device, dev -> function, tableLocation & 0x7);
+    if(bar.type != MemoryMapping || bar.adress == 0)
+        return false;                                                       //Unused or above 4GB
+
+    uint32_t tableAddress = (uint32_t)bar.adress + (tableLocation & ~0x7);
+    volatile uint32_t* table = (volatile uint32_t*)PageManager::activePageManager -> MapPhysicalMemory(tableAddress, tableSize * 16, PAGE_CACHE_DISABLE);
+    if(table == 0)
+        return false;
+
+    //Memory decoding has to be on to reach the table, INTx goes off
+    uint32_t command = Read(dev -> bus, dev -> device, dev -> function, 0x04) & 0xFFFF;
+    Write(dev -> bus, dev -> device, dev -> function, 0x04, command | 0x2 | (1 << 10));
+
+    for(uint16_t i = 0; i < tableSize; ++i)
+        table[i * 4 + 3] |= 0x1;                                            //Vector control: masked
+
+    control = (control & ~(1 << 14)) | (1 << 15);                           //Enable, clear the function mask
+    Write(dev -> bus, dev -> device, dev -> function, capability, (header & 0xFFFF) | ((uint32_t)control << 16));
+
+    dev -> msixTable = table;
+    dev -> msixTableSize = tableSize;
+    return true;
+}
+
+/**
+ * Give an MSI-X entry (e.g. a queue of the device) its own vector
+ * @param dev Device descriptor, EnableMSIX must have been called on it
+ * @param interruptManager Interrupt manager to allocate the vector from
+ * @param entry The entry in the device's MSI-X table
+ * @return The interrupt number, -1 if there are no vectors left
+ */
+int PeripheralComponentInterconnectController::AllocateMSIXVector(PeripheralComponentInterconnectDeviceDescriptor* dev, InterruptManager* interruptManager, uint16_t entry) {
+
+    uint32_t address = MessageAddress();
+    if(dev -> msixTable == 0 || entry >= dev -> msixTableSize || address == 0)
+        return -1;
+
+    int interrupt = interruptManager -> AllocateMessageVectors(1);
+    if(interrupt < 0)
+        return -1;
+
+    volatile uint32_t* tableEntry = dev -> msixTable + entry * 4;
+    tableEntry[0] = address;
+    tableEntry[1] = 0;
+    tableEntry[2] = interrupt;
+    tableEntry[3] &= ~0x1;                                                  //Unmask
+
+    return interrupt;
 }
 
 /**
@@ -181,91 +613,56 @@ PeripheralComponentInterconnectDeviceDescriptor PeripheralComponentInterconnectC
 
     result.revision = Read(bus, device, function, 0x8);
     result.interrupt = Read(bus, device, function, 0x3C);
+    result.headerType = Read(bus, device, function, 0x0E) & 0x7F;
 
     return result;
 }
 
 /**
- * Get the driver for the device
+ * Check a device against one line of a driver's match table
+ * @param id The match table line
  * @param dev Device descriptor
- * @param interruptManager Interrupt manager
- * @return Driver for the device, 0 if there is no driver
+ * @return True if the driver can handle the device
  */
-Driver* PeripheralComponentInterconnectController::GetDriver(PeripheralComponentInterconnectDeviceDescriptor dev, InterruptManager* interruptManager) {
-
-    Driver* driver = 0;
-    switch (dev.vendor_ID) {
-        case 0x1022:                            //AMD
-            switch (dev.device_ID) {
-                case 0x2000:                    //AMD - am79c971 (Ethernet Controller)
-                    driver = (amd_am79c973*)MemoryManager::activeMemoryManager->malloc(sizeof(amd_am79c973));       //Allocate memory region of the sie of the class
-                    if(driver != 0)                                                                                     //Check if space in memory
-                       new (driver) amd_am79c973(&dev, interruptManager);                                               //Create Driver Instance
-                    return driver;                                                                                      //Add Driver
-                    break;
-            }
-            break;
-        case 0x8089:                            //Intel
-            break;
-    }
+bool PeripheralComponentInterconnectController::Matches(const PeripheralComponentInterconnectDeviceID* id, PeripheralComponentInterconnectDeviceDescriptor* dev) {
 
-    //If there is no driver for the particular device, go into generic devices
-    switch (dev.class_id) {
-        case 0x03:                              //Graphics
-            switch (dev.subclass_id) {
-                case 0x00:                      //Graphics - VGA
-                    break;
-            }
-            break;
-    }
-    
-    
-    
-    return driver;
-}
+    if(id -> vendor_ID != PCI_VENDOR_ANY && id -> vendor_ID != dev -> vendor_ID)
+        return false;
 
+    if(id -> device_ID != PCI_VENDOR_ANY && id -> device_ID != dev -> device_ID)
+        return false;
 
-/**
- * Get the lowest set bit in a 32-bit value
- * @param value 32-bit value
- * @return Lowest set bit
- */
-uint32_t get_number_of_lowest_set_bit(uint32_t value)
-{
-    uint32_t pos = 0;
-    uint32_t mask = 0x00000001;
-    while (!(value & mask))
-    { ++pos; mask=mask<<1; }
-    return pos;
+    uint32_t classCode = ((uint32_t)dev -> class_id << 16) | ((uint32_t)dev -> subclass_id << 8) | dev -> interface_id;
+    return ((classCode ^ id -> classCode) & id -> classMask) == 0;
 }
 
 /**
- * Get the highest set bit in a 32-bit value
- * @param value  32-bit value
- * @return  Highest set bit
+ * Get the driver for the device from the drivers registered with REGISTER_PCI_DRIVER
+ * @param dev Device descriptor, it has to stay valid as long as the driver (the cached ones do)
+ * @param interruptManager Interrupt manager
+ * @return Driver for the device, 0 if there is no driver
  */
-uint32_t get_number_of_highest_set_bit(uint32_t value)
-{
-    uint32_t pos = 31;
-    uint32_t mask = 0x80000000;
-    while (!(value & mask))
-    { --pos; mask=mask>>1; }
-    return pos;
+Driver* PeripheralComponentInterconnectController::GetDriver(PeripheralComponentInterconnectDeviceDescriptor* dev, InterruptManager* interruptManager) {
+
+    for(PeripheralComponentInterconnectDriverEntry* entry = &start_pci_drivers; entry < &end_pci_drivers; ++entry)
+        for(int i = 0; i < entry -> numIDs; ++i)
+            if(Matches(&entry -> ids[i], dev))
+                return entry -> create(dev, interruptManager);
+
+    return 0;
 }
 
+
 /**
- * Get the base adress register
+ * Get the base adress register, the size is found by writing all ones to it and reading back which address bits stick
  * @param bus Bus number
  * @param device Device number
  * @param function Function number
  * @param barNum Base adress register number
- * @return Base adress register
+ * @return Base adress register, its size is 0 if it is unused (or is the upper half of a 64 bit BAR)
  */
 BaseAdressRegister PeripheralComponentInterconnectController::GetBaseAdressRegister(uint16_t bus, uint16_t device, uint16_t function, uint16_t bar) {
 
-
-
-
     BaseAdressRegister result;
 
     uint32_t headerType = Read(bus,device,function,0x0E) & 0x7F;  //Only get first 7 bits
@@ -281,70 +678,84 @@ BaseAdressRegister PeripheralComponentInterconnectController::GetBaseAdressRegis
         return result;
     }
 
+    //The slot after a 64 bit BAR holds its upper half
+    for (uint16_t previous = 0; previous < bar; ++previous) {
+        uint32_t previousValue = Read(bus, device, function, 0x10 + (previous * 4));
+        if(!(previousValue & 0x1) && ((previousValue >> 1) & 0x3) == 2){
+            if(previous + 1 == bar)
+                return result;
+            previous++;
+        }
+    }
 
     const uint32_t barOffset = 0x10 + (bar * 4);                            // Determine the offset of the current BAR (note: bar addresses begin at register 0x10, bars have the size of 4)
     uint32_t bar_value = Read(bus,device,function,barOffset);
     result.type = (bar_value & 0x1) ? InputOutput : MemoryMapping;          //Examine the last bit (check notes: last bit is type)
-    uint32_t temp;
+    result.is64Bit = result.type == MemoryMapping && ((bar_value >> 1) & 0x3) == 2;
+
+    //Stop the device decoding while the BAR holds all ones, it could overlap something else
+    uint32_t command = Read(bus, device, function, 0x04) & 0xFFFF;
+    Write(bus, device, function, 0x04, command & ~0x3);
+
+    Write(bus, device, function, barOffset, 0xFFFFFFFF);
+    uint32_t mask = Read(bus, device, function, barOffset);
+    Write(bus, device, function, barOffset, bar_value);
+
+    uint32_t upperValue = 0;
+    uint32_t upperMask = 0xFFFFFFFF;
+    if(result.is64Bit){
+        upperValue = Read(bus, device, function, barOffset + 4);
+        Write(bus, device, function, barOffset + 4, 0xFFFFFFFF);
+        upperMask = Read(bus, device, function, barOffset + 4);
+        Write(bus, device, function, barOffset + 4, upperValue);
+    }
+
+    Write(bus, device, function, 0x04, command);
 
     if(result.type == MemoryMapping){
-        result.preFetchable = ((bar_value >> 3) & 0x1) == 0x1;
-        switch((bar_value >> 1) & 0x3) //Shift by one which removes the last bit (access mode), [& 0x3] gives us only the bits with 0x3
-        {
-            case 0:                                                                                          // 32 Bit Mode
-            {
-                Write(bus,device,function,barOffset,0xFFFFFFF0);                            // overwrite with all 1s
-                const uint32_t barValue = Read(bus,device,function,barOffset) & 0xFFFFFFF0;       // and read back again
-                if (barValue == 0)                                                                          // at least one address bit must be 1 (i.e. writable).
-                {
-                    if (result.preFetchable)                                                                // unused BARs must be completely 0 (the prefetchable bit must not be set either)
-                    {
-                        printf("ERROR : 32-bit memory BAR"); printf(reinterpret_cast<char *>(bar)); printf("contains no writable address bits!\n");
-                        return result;
-                    }
-
-                    // Output BAR info :
-                     //  printf("BAR: "); printf(reinterpret_cast<char *>(bar)); printf("is unused!\n");
-                }
-                else
-                {
-                    const uint32_t lowestBit = get_number_of_lowest_set_bit(barValue);
-                    // it must be a valid 32-bit address :
-                    if ( (get_number_of_highest_set_bit(barValue) != 31) || (lowestBit > 31) || (lowestBit < 4) )
-                    {
-                        printf("ERROR : 32-bit memory BAR %u contains invalid writable address bits!\n",bar);
-                        return result;
-                    }
-
-                    // Output BAR info :
-                   // printf("BAR: "); printf(reinterpret_cast<char *>(bar)); printf(" works (32Bit)!\n");
-
-                }
-            }
-                break;
-            case 1: // 20 Bit Mode
-            case 2: // 64 Bit Mode
-                break;
-        }
 
-        //                   Shift bar by 3 (removing last 3 bits) check if it == 0x1
+        result.preFetchable = ((bar_value >> 3) & 0x1) == 0x1;
+        result.physicalAddress = ((uint64_t)upperValue << 32) | (bar_value & ~0xF);
 
+        uint64_t addressMask = ((uint64_t)upperMask << 32) | (mask & ~0xF);
+        result.size = (mask & ~0xF) == 0 ? 0 : ~addressMask + 1;        //No writable address bits means it is unused
     }
     else
     {  // I/O
-        result.adress = (uint8_t*)(bar_value & ~0x3); //~0x3 = cancle last 2 bits
+        result.physicalAddress = bar_value & ~0x3;                       //~0x3 = cancle last 2 bits
         result.preFetchable = false;
+
+        //Devices may leave the upper 16 bits of an I/O BAR hardwired to 0
+        uint32_t addressMask = mask & ~0x3;
+        result.size = addressMask == 0 ? 0 : (~(addressMask | 0xFFFF0000) + 1) & 0xFFFF;
     }
 
+    //Only addresses below 4GB can be reached without PAE
+    if(result.size != 0 && (result.physicalAddress >> 32) == 0)
+        result.adress = (uint8_t*)(uint32_t)result.physicalAddress;
+
     return result;
 }
 
+/**
+ * Make a memory BAR visible to the kernel and turn on memory decoding, prefetchable BARs are mapped write-combining
+ * @param dev Device descriptor
+ * @param bar Base adress register number
+ * @return The address to access the BAR at, 0 if it isn't a usable memory BAR
+ */
+void* PeripheralComponentInterconnectController::MapBaseAdressRegister(PeripheralComponentInterconnectDeviceDescriptor* dev, uint16_t bar) {
 
+    BaseAdressRegister result = GetBaseAdressRegister(dev -> bus, dev -> device, dev -> function, bar);
+    if(result.type != MemoryMapping || result.adress == 0 || PageManager::activePageManager == 0 || (result.size >> 32) != 0)
+        return 0;
 
+    uint32_t flags = result.preFetchable ? PAGE_WRITE_COMBINING : PAGE_CACHE_DISABLE;
+    void* address = PageManager::activePageManager -> MapPhysicalMemory((uint32_t)result.adress, (uint32_t)result.size, flags);
+    if(address == 0)
+        return 0;
 
+    uint32_t command = Read(dev -> bus, dev -> device, dev -> function, 0x04) & 0xFFFF;
+    Write(dev -> bus, dev -> device, dev -> function, 0x04, command | 0x2);
 
-
-
-
-
-
+    return address;
+}
@@ -7,6 +7,8 @@
 using namespace maxOS::common;
 using namespace maxOS::hardwarecommunication;
 
+//Reading and writing is inlined in the header, only the port number lives in the object
+
 Port::Port(uint16_t portnumber){
     this->portnumber = portnumber;
 }
@@ -25,24 +27,6 @@ Port8Bit::~Port8Bit() {
 
 }
 
-/**
- * @details Write a byte to the port (8Bit)
- * @param data the byte to write
- */
-void Port8Bit::Write(uint8_t data){
-    __asm__ volatile("outb %0, %1" : : "a" (data), "Nd" (portnumber));      //Nd--> d:The d register & N:Unsigned 8-bit integer constant
-}
-
-/**
- * @details Read a byte from the port (8Bit)
- * @return the byte read
- */
-uint8_t Port8Bit::Read(){
-    uint8_t result;
-    __asm__ volatile("inb %1, %0" : "=a" (result) : "Nd" (portnumber));
-    return result;
-}
-
 Port8BitSlow::Port8BitSlow(uint16_t portnumber)
 : Port8Bit(portnumber)
 {
@@ -52,16 +36,6 @@ Port8BitSlow::~Port8BitSlow() {
 
 }
 
-/**
- * @details Write a byte to the port (8BitSlow)
- * @param data the byte to write
- */
-void Port8BitSlow::Write(uint8_t data){
-    __asm__ volatile("outb %0, %1\njmp 1f\n1: jmp 1f\n1:" : : "a" (data), "Nd" (portnumber));
-}
-
-
-
 //16 BIT (asm is w)
 
 Port16Bit::Port16Bit(uint16_t portnumber)
@@ -73,24 +47,6 @@ Port16Bit::~Port16Bit() {
 
 }
 
-/**
- * @details Write a word to the port (16Bit)
- * @param data the word to write
- */
-void Port16Bit::Write(uint16_t data){
-    __asm__ volatile("outw %0, %1" : : "a" (data), "Nd" (portnumber));
-}
-
-/**
- * @details Read a word from the port (16Bit)
- * @return the word read
- */
-uint16_t Port16Bit::Read(){
-    uint16_t result;
-    __asm__ volatile("inw %1, %0" : "=a" (result) : "Nd" (portnumber));
-    return result;
-}
-
 //32 BIT (asm is l)
 
 Port32Bit::Port32Bit(uint16_t portnumber)
@@ -101,21 +57,3 @@ Port32Bit::Port32Bit(uint16_t portnumber)
 Port32Bit::~Port32Bit() {
 
 }
-
-/**
- * @details Write a double word to the port (32Bit)
- * @param data the double word to write
- */
-void Port32Bit::Write(uint32_t data){
-    __asm__ volatile("outl %0, %1" : : "a" (data), "Nd" (portnumber));
-}
-
-/**
- * @details Read a double word from the port (32Bit)
- * @return the double word read
- */
-uint32_t Port32Bit::Read(){
-    uint32_t result;
-    __asm__ volatile("inl %1, %0" : "=a" (result) : "Nd" (portnumber));
-    return result;
-}
\ No newline at end of file
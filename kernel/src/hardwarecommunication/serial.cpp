@@ -11,6 +11,8 @@ using namespace maxOS::hardwarecommunication;
 void printf(char* str, bool clearLine = false); //Forward declaration
 void printfHex(uint8_t key);                    //Forward declaration
 
+serial* serial::activeSerial = 0;
+
 /**
  * @details This function is the constructor for the serial port
  */
@@ -50,10 +52,15 @@ serial::serial(InterruptManager* interruptManager)
     //If the serial port is working  set it in normal operation mode
     modemCommandPort.Write(0x0F);
 
+    activeSerial = this;
+
 }
 
 serial::~serial() {
 
+    if(activeSerial == this)
+        activeSerial = 0;
+
 }
 
 /**
@@ -230,6 +237,65 @@ void serial::Write(char* str, int type) {
 
 
 
+}
+
+/**
+ * @details Write a number in decimal (without a header)
+ * @param number The number
+ */
+void serial::WriteNumber(uint64_t number) {
+
+    //Divide the high half first so each divl fits in 32 bits (there is no libgcc for 64 bit division)
+    char digits[21];
+    int position = 20;
+    digits[position] = '\0';
+
+    uint32_t ten = 10;
+    do{
+        uint32_t high = number >> 32;
+        uint32_t highQuotient = high / 10;
+        uint32_t lowQuotient, remainder;
+        asm("divl %4" : "=a"(lowQuotient), "=d"(remainder) : "a"((uint32_t)number), "d"(high % 10), "rm"(ten));
+
+        digits[--position] = '0' + remainder;
+        number = ((uint64_t)highQuotient << 32) | lowQuotient;
+    }while(number != 0);
+
+    Write(&digits[position], -1);
+
+}
+
+/**
+ * @details Write a number in hex (without a header)
+ * @param number The number
+ */
+void serial::WriteHex(uint32_t number) {
+
+    static const char hex[] = "0123456789ABCDEF";
+    char digits[11];
+
+    digits[0] = '0';
+    digits[1] = 'x';
+    for(int i = 0; i < 8; ++i)
+        digits[2 + i] = hex[(number >> (28 - i * 4)) & 0xF];
+    digits[10] = '\0';
+
+    Write(digits, -1);
+
+}
+
+/**
+ * @details Write binary data as it is (it may contain 0s, so Write can't be used)
+ * @param data The data
+ * @param length The amount of bytes
+ */
+void serial::WriteBytes(uint8_t* data, uint32_t length) {
+
+    for(uint32_t i = 0; i < length; ++i){
+        while(isTransmitEmpty() == 0);
+        dataPort.Write(data[i]);
+    }
+
 }
 
 /**
@@ -7,6 +7,8 @@
 #include <hardwarecommunication/interrupts.h>
 #include <hardwarecommunication/pci.h>
 #include <hardwarecommunication/serial.h>
+#include <hardwarecommunication/acpi.h>
+#include <hardwarecommunication/apic.h>
 
 //Drivers
 #include <drivers/driver.h>
@@ -32,6 +34,13 @@
 #include <system/syscalls.h>
 #include <system/memorymanagement.h>
 #include <system/multithreading.h>
+#include <system/clock.h>
+#include <system/iouring.h>
+#include <system/paging.h>
+#include <system/pagecache.h>
+#include <system/profiler.h>
+#include <system/trace.h>
+#include <system/boottime.h>
 
 using namespace maxOS;
 using namespace maxOS::common;
@@ -343,6 +352,8 @@ extern "C" void kernelMain(const void* multiboot_structure, uint32_t multiboot_m
 
 
 
+    BootTimeline::Stage("console");
+
     //NOTE: Will rewrite boot text stuff later
 
     Version* maxOSVer;
@@ -370,10 +381,12 @@ extern "C" void kernelMain(const void* multiboot_structure, uint32_t multiboot_m
 
     printf("\n[x] Kernel Booted \n");
 
+    BootTimeline::Stage("gdt");
     printf("[ ] Setting Up Global Descriptor Table... \n");
     GlobalDescriptorTable gdt;                                                              //Setup GDT
     printf("[x] GDT Setup \n");
 
+    BootTimeline::Stage("memory");
     printf("[ ] Setting Up Memory Management... \n");
     uint32_t* memupper = (uint32_t*)(((size_t)multiboot_structure) + 8);                    //memupper is a field at offset 8 in the Multiboot information structure and it indicates the amount upper memory in kilobytes.
                                                                                             //Lower memory starts at address 0, and upper memory starts at address 1 megabyte. The
@@ -381,6 +394,14 @@ extern "C" void kernelMain(const void* multiboot_structure, uint32_t multiboot_m
                                                                                             //memory is maximally the address of the first upper memory hole minus 1 megabyte.
     size_t  heap = 10*1024*1024;                                                            //Start at 10MB
 
+    //Programs loaded by GRUB as modules must not end up inside the heap
+    uint32_t multibootFlags = *(uint32_t*)multiboot_structure;
+    uint32_t moduleCount = (multibootFlags & 0x8) ? *(uint32_t*)(((size_t)multiboot_structure) + 20) : 0;
+    uint32_t* modules = (uint32_t*)*(uint32_t*)(((size_t)multiboot_structure) + 24);         //Each module is {start, end, string, reserved}
+    for(uint32_t i = 0; i < moduleCount; ++i)
+        if(modules[i * 4 + 1] > heap)
+            heap = (modules[i * 4 + 1] + 0xFFF) & ~0xFFF;
+
     //Print the heap address
     printf("heap: 0x");
     printfHex((heap >> 24) & 0xFF);
@@ -390,6 +411,8 @@ extern "C" void kernelMain(const void* multiboot_structure, uint32_t multiboot_m
 
 
     size_t  memSize = (*memupper)*1024 - heap - 10*1024;                                    //Convert memupper into MB, then subtract the hep and some padding
+    if(heap + memSize > DEVICE_WINDOW_START)                                                //The kernel can only see the memory it has identity mapped
+        memSize = DEVICE_WINDOW_START - heap;
     MemoryManager memoryManager(heap, memSize);                                    //Memory Mangement
     //Print the memory adress
     printf(" memSize: 0x");
@@ -409,9 +432,16 @@ extern "C" void kernelMain(const void* multiboot_structure, uint32_t multiboot_m
 
     printf("[x] Memory Management Setup \n");
 
+    BootTimeline::Stage("paging");
+    printf("[ ] Setting Up Paging... \n");
+    PageManager pageManager(32*1024*1024);                                                 //32MB of frames for process memory and page tables
+    PageCache pageCache;                                                                    //Shares executable pages between processes and caches disk pages
+    printf("[x] Paging Setup \n");
 
+
+    BootTimeline::Stage("threads");
     printf("[ ] Setting Thread Manager... \n");
-    ThreadManager threadManager;
+    ThreadManager threadManager(&gdt);
 
     /*
     __Tests__
@@ -430,10 +460,32 @@ extern "C" void kernelMain(const void* multiboot_structure, uint32_t multiboot_m
 
 
 
+    BootTimeline::Stage("interrupts");
     printf("[ ] Setting Up Interrupt Manager... \n");
     InterruptManager interrupts(0x20, &gdt, &threadManager);            //Instantiate the method
     printf("[x] Interrupt Manager Setup \n", true);
 
+    BootTimeline::Stage("apic");
+    printf("[ ] Setting Up APIC... \n");
+    AdvancedConfigurationAndPowerInterface acpi;                        //Firmware tables describing the hardware
+    AdvancedProgrammableInterruptController apic(&interrupts, &acpi);   //Replaces the PICs if the MADT describes an IO APIC
+    if(apic.IsAvailable()){
+        printf("[x] APIC Setup, CPUs: ");
+        printfHex(apic.Description() -> numProcessors);
+        printf("\n");
+    }
+    else
+        printf("[x] APIC Not Found, Using PIC \n");
+
+    BootTimeline::Stage("clock");
+    printf("[ ] Setting Up Clock... \n");
+    Clock clock(&interrupts);                                           //Calibrates the TSC and publishes the time to the vDSO page
+    printf("[x] Clock Setup \n");
+
+    Profiler profiler;                                                  //Samples the timer interrupt once started (syscall 515)
+    Tracer tracer;                                                      //Records tracepoints once they are enabled (syscall 516)
+
+    BootTimeline::Stage("serial");
     printf("[ ] Setting Up Serial Log... \n");
     serial serialLog(&interrupts);
     //serialLog.Test();
@@ -444,10 +496,16 @@ extern "C" void kernelMain(const void* multiboot_structure, uint32_t multiboot_m
 
 
 
+    BootTimeline::Stage("syscalls");
     printf("[ ] Setting Up System Calls Handler... \n");
     SyscallHandler syscalls(&interrupts, 0x80);                               //Instantiate the method
     printf("[x] System Calls Handler Setup \n", true);
 
+    BootTimeline::Stage("processes");
+    printf("[ ] Setting Up Process Manager... \n");
+    ProcessManager processManager(&interrupts, &threadManager);              //Handles page faults of user processes
+    printf("[x] Process Manager Setup \n");
+
     serialLog.Write("Memory Management Ready\n",1);
     serialLog.Write("Tasks Ready\n",1);
     serialLog.Write("Global Descriptor Table Ready\n",1);
@@ -459,6 +517,7 @@ extern "C" void kernelMain(const void* multiboot_structure, uint32_t multiboot_m
         Desktop desktop(320,200,0x00,0x00,0xA8);
     #endif
 
+    BootTimeline::Stage("drivers");
     printf("[ ] Setting Up Drivers... \n");
 
     DriverManager driverManager;
@@ -483,6 +542,7 @@ extern "C" void kernelMain(const void* multiboot_structure, uint32_t multiboot_m
             driverManager.AddDriver(&mouse);
         printf("    -Mouse setup\n");
 
+        BootTimeline::Stage("pci");
         printf("    -[ ]Setting PCI\n\n");
         PeripheralComponentInterconnectController PCIController;
         PCIController.SelectDrivers(&driverManager, &interrupts);
@@ -494,7 +554,8 @@ extern "C" void kernelMain(const void* multiboot_structure, uint32_t multiboot_m
             printf("    -VGA setup\n");
         #endif
 
-    driverManager.ActivateAll();
+    BootTimeline::Stage("driver activation");
+    driverManager.ActivateRequired();
     printf("[X] Drivers Setup\n");
 
 
@@ -545,17 +606,37 @@ extern "C" void kernelMain(const void* multiboot_structure, uint32_t multiboot_m
         //BUG: Long lines
     #endif
 
+    BootTimeline::Stage("ata");
     printf("[ ] Setting Up ATA Hard Drives... \n");
 
     //Interrupt 14 for Primary
-    AdvancedTechnologyAttachment ata0m(0x1F0, true);         //Primary master
-    AdvancedTechnologyAttachment ata0s(0x1F0, false);        //Primary Slave
-    printf("    -ATA Primary Master: ");     ata0m.Identify();     printf("\n");
-    printf("    -ATA Primary Slave: ");      ata0s.Identify();     printf("\n");
-
-    //Interrupt 15 for Primary
-    AdvancedTechnologyAttachment ata1m(0x170, true);         //Secondary master
-    AdvancedTechnologyAttachment ata1s(0x170, false);        //Secondary Slave
+    AdvancedTechnologyAttachmentChannel ataPrimary(0x1F0, 14, &interrupts);
+    AdvancedTechnologyAttachment ata0m(&ataPrimary, true);         //Primary master
+    AdvancedTechnologyAttachment ata0s(&ataPrimary, false);        //Primary Slave
+
+    //Interrupt 15 for Secondary
+    AdvancedTechnologyAttachmentChannel ataSecondary(0x170, 15, &interrupts);
+    AdvancedTechnologyAttachment ata1m(&ataSecondary, true);       //Secondary master
+    AdvancedTechnologyAttachment ata1s(&ataSecondary, false);      //Secondary Slave
+
+    //Use the IDE controller's bus master DMA if there is one, PIO otherwise
+    printf(ataPrimary.EnableDMA() ? (char*)"    -Primary channel: DMA\n" : (char*)"    -Primary channel: PIO\n");
+    printf(ataSecondary.EnableDMA() ? (char*)"    -Secondary channel: DMA\n" : (char*)"    -Secondary channel: PIO\n");
+
+    //Only the primary master is used during boot, the rest are identified by the driver workers once the scheduler runs.
+    //Devices on the same channel share its ports, so the slave waits for the master
+    int ata0mDriver = driverManager.AddDriver(&ata0m);
+    driverManager.AddDependency(driverManager.AddDriver(&ata0s, false), ata0mDriver);
+    int ata1mDriver = driverManager.AddDriver(&ata1m, false);
+    driverManager.AddDependency(driverManager.AddDriver(&ata1s, false), ata1mDriver);
+    driverManager.ActivateRequired();
+
+    //The disks are seeked, so sort their requests. Reads are preferred over the write back
+    DeadlineIOScheduler ata0mScheduler;
+    ata0m.SetScheduler(&ata0mScheduler);
+    printf("    -Primary master scheduler: ");
+    printf((char*)ata0m.Scheduler() -> Name());
+    printf("\n");
 
     /*
 
@@ -569,13 +650,21 @@ extern "C" void kernelMain(const void* multiboot_structure, uint32_t multiboot_m
 
     //Test
 
-    char* atamBuffer = "Test file write";
+    char* atamMessage = "Test file write";
+    uint8_t atamBuffer[512];
+    for(int i = 0; i < 512; ++i)
+        atamBuffer[i] = i < 16 ? atamMessage[i] : 0;
+
     printf("    -ATA Write test: ");
-    ata0m.Write28(0,(uint8_t*)atamBuffer,15);
+    printf(ata0m.Write(0, 1, atamBuffer) == 1 ? atamMessage : (char*)"Failed");
     printf("\n");
     ata0m.Flush();
+
+    for(int i = 0; i < 512; ++i)
+        atamBuffer[i] = 0;
+
     printf("    -ATA Read test: ");
-    ata0m.Read28(0,15);
+    printf(ata0m.ReadSectors(0, 1, atamBuffer) == 1 ? (char*)atamBuffer : (char*)"Failed");
     printf("\n");
 
 
@@ -583,8 +672,14 @@ extern "C" void kernelMain(const void* multiboot_structure, uint32_t multiboot_m
 
 
 
+    BootTimeline::Stage("network");
     printf("[x] Setting Up Network Driver \n");
-    amd_am79c973* eth0 = (amd_am79c973*)(driverManager.drivers[2]);
+    amd_am79c973* eth0 = amd_am79c973::activeNetworkCard;   //Where it is in the driver list depends on which disk controllers were found
+    if(eth0 == 0){
+        printf(" -  No network card found, halting\n");
+        while(true)
+            asm volatile("hlt");
+    }
 
         printf(" -  Setting Up IP, Gateway, Subnet... \n");
         eth0 -> SetIPAddress(IP_BE);                         //Set IP address
@@ -597,12 +692,32 @@ extern "C" void kernelMain(const void* multiboot_structure, uint32_t multiboot_m
 
     printf("[x] Network Driver Setup \n");
 
+    BootTimeline::Stage("io rings");
+    printf("[ ] Setting Up IO Rings... \n");
+    IORing::RegisterFile(&ata0m);                           //fd 0
+    IORing::RegisterFile(eth0);                             //fd 1
+    threadManager.CreateThread(IORing::Poller);             //Consumes submissions of SQPOLL rings
+    threadManager.CreateThread(Tracer::Drainer);            //Sends trace records over serial when the CPU is otherwise idle
+    threadManager.CreateThread(PageCache::WriteBackThread); //Writes dirty disk pages back and frees cached pages when memory runs low
+    threadManager.CreateThread(DriverManager::Worker);      //Activate the drivers boot didn't wait for
+    threadManager.CreateThread(DriverManager::Worker);
+    printf("[x] IO Rings Setup \n");
+
+    BootTimeline::Stage("user processes");
     Process kernelMain(kernProc, &threadManager);
+
+    //Every module GRUB loaded is a user program
+    for(uint32_t i = 0; i < moduleCount; ++i)
+        if(processManager.Spawn((uint8_t*)modules[i * 4], modules[i * 4 + 1] - modules[i * 4]) == 0)
+            printf("Could not start module\n");
     Process testProcess(taskA, &threadManager);
 
     k_sLog = serialLog;
     k_arp = arp;
 
+    BootTimeline::Finish();
+    BootTimeline::Report(&serialLog);
+
     //Interrupts should be the last thing as once the clock interrupt is sent the multitasker will start doing processes and tasks
     printf("[ ] Activating Interrupt Descriptor Table... \n");
     interrupts.Activate();
@@ -0,0 +1,132 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#include <system/boottime.h>
+#include <system/clock.h>
+
+using namespace maxOS;
+using namespace maxOS::common;
+using namespace maxOS::hardwarecommunication;
+using namespace maxOS::system;
+
+BootEvent BootTimeline::events[BootTimeline::maxEvents];
+int BootTimeline::numEvents = 0;
+int BootTimeline::currentStage = -1;
+
+/**
+ * @details Start a stage of boot, ending the one before it
+ * @param name The name of the stage
+ */
+void BootTimeline::Stage(char* name) {
+
+    uint64_t now = Clock::ReadTimestampCounter();
+    if(currentStage >= 0)
+        events[currentStage].end = now;
+
+    currentStage = -1;
+    if(numEvents >= maxEvents)
+        return;
+
+    currentStage = numEvents++;
+    events[currentStage].name = name;
+    events[currentStage].id = 0;
+    events[currentStage].start = now;
+    events[currentStage].end = now;
+    events[currentStage].probe = false;
+
+}
+
+/**
+ * @details End the last stage, boot is done
+ */
+void BootTimeline::Finish() {
+
+    if(currentStage >= 0)
+        events[currentStage].end = Clock::ReadTimestampCounter();
+
+    currentStage = -1;
+
+}
+
+/**
+ * @details Start timing the probe of a device
+ * @param name What kind of device it is
+ * @param id Which device it is
+ * @return The probe to pass to EndProbe, -1 if there is no room to record it
+ */
+int BootTimeline::BeginProbe(char* name, uint32_t id) {
+
+    if(numEvents >= maxEvents)
+        return -1;
+
+    int probe = numEvents++;
+    events[probe].name = name;
+    events[probe].id = id;
+    events[probe].start = Clock::ReadTimestampCounter();
+    events[probe].end = events[probe].start;
+    events[probe].probe = true;
+
+    return probe;
+}
+
+/**
+ * @details Stop timing the probe of a device
+ * @param probe What BeginProbe returned
+ */
+void BootTimeline::EndProbe(int probe) {
+
+    if(probe >= 0)
+        events[probe].end = Clock::ReadTimestampCounter();
+
+}
+
+/**
+ * @details Write when every stage started and how long it and the probes in it took, in microseconds since the first stage
+ * @param log The serial port
+ */
+void BootTimeline::Report(serial* log) {
+
+    if(log == 0 || numEvents == 0)
+        return;
+
+    //Only possible to convert once the clock has calibrated the TSC
+    if(Clock::activeClock == 0){
+        log -> Write("Boot timeline: the clock isn't running\n", 3);
+        return;
+    }
+
+    uint64_t bootStart = events[0].start;
+    uint64_t bootEnd = bootStart;
+    uint64_t probeTicks = 0;
+    for(int i = 0; i < numEvents; ++i){
+        if(events[i].end > bootEnd)
+            bootEnd = events[i].end;
+        if(events[i].probe)
+            probeTicks += events[i].end - events[i].start;
+    }
+
+    log -> Write("Boot timeline (us):\n", 6);
+    for(int i = 0; i < numEvents; ++i){
+
+        log -> Write(events[i].probe ? (char*)"      probe " : (char*)"  ", -1);
+        log -> Write(events[i].name, -1);
+        if(events[i].probe){
+            log -> Write(" ", -1);
+            log -> WriteHex(events[i].id);
+        }
+
+        log -> Write(" at ", -1);
+        log -> WriteNumber(Clock::activeClock -> TicksToMicroseconds(events[i].start - bootStart));
+        log -> Write(" took ", -1);
+        log -> WriteNumber(Clock::activeClock -> TicksToMicroseconds(events[i].end - events[i].start));
+        log -> Write("\n", -1);
+    }
+
+    log -> Write("  total ", -1);
+    log -> WriteNumber(Clock::activeClock -> TicksToMicroseconds(bootEnd - bootStart));
+    log -> Write(", of which device probes ", -1);
+    log -> WriteNumber(Clock::activeClock -> TicksToMicroseconds(probeTicks));
+    log -> Write("\n", -1);
+
+}
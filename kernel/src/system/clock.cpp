@@ -0,0 +1,304 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#include <system/clock.h>
+#include <system/vdso.h>
+#include <system/paging.h>
+#include <system/profiler.h>
+#include <hardwarecommunication/acpi.h>
+
+using namespace maxOS;
+using namespace maxOS::common;
+using namespace maxOS::hardwarecommunication;
+using namespace maxOS::system;
+
+Clock* Clock::activeClock = 0;
+
+/**
+ * @details Divide a 64 bit number by a 32 bit number without libgcc (the result must fit in 32 bits)
+ * @param dividend The number to divide
+ * @param divisor The number to divide by
+ * @return The quotient
+ */
+static uint32_t Divide64(uint64_t dividend, uint32_t divisor){
+
+    uint32_t quotient, remainder;
+    asm("divl %4" : "=a"(quotient), "=d"(remainder) : "a"((uint32_t)dividend), "d"((uint32_t)(dividend >> 32)), "rm"(divisor));
+    return quotient;
+
+}
+
+Clock::Clock(InterruptManager* interruptManager)
+: InterruptHandler(interruptManager -> HardwareInterruptOffset(), interruptManager),    //Timer is the first hardware interrupt
+  PITChannel2DataPort(0x42),
+  PITCommandPort(0x43),
+  PITGatePort(0x61),
+  CMOSAddressPort(0x70),
+  CMOSDataPort(0x71)
+{
+
+    activeClock = this;
+
+    //Newer machines say which CMOS register holds the century
+    FixedACPIDescription fadt;
+    AdvancedConfigurationAndPowerInterface* acpi = AdvancedConfigurationAndPowerInterface::activeACPI;
+    centuryRegister = (acpi != 0 && acpi -> ParseFADT(&fadt)) ? fadt.century : 0;
+
+    Calibrate();
+
+    //Start counting from now
+    seconds = 0;
+    nanoseconds = 0;
+    lastUpdate = ReadTimestampCounter();
+    bootTime = ReadRealTimeClock();
+
+    Update();
+
+}
+
+Clock::~Clock() {
+
+    if(activeClock == this)
+        activeClock = 0;
+
+}
+
+/**
+ * @details Count TSC ticks while PIT channel 2 counts down
+ * @param milliseconds How long to measure for (at most 54)
+ * @return The TSC ticks that passed
+ */
+uint64_t Clock::MeasureWithPIT(uint32_t milliseconds) {
+
+    const uint32_t PITFrequency = 1193182;                              //Hz
+    const uint16_t latch = PITFrequency / (1000 / milliseconds);
+
+    PITGatePort.Write((PITGatePort.Read() & 0xFD) | 0x01);             //Gate on, speaker off
+    PITCommandPort.Write(0xB0);                                         //Channel 2, lo/hi byte, mode 0 (interrupt on terminal count)
+    PITChannel2DataPort.Write(latch & 0xFF);
+    PITChannel2DataPort.Write(latch >> 8);                              //Counting starts once the high byte is written
+
+    uint64_t start = ReadTimestampCounter();
+    while((PITGatePort.Read() & 0x20) == 0);                            //Output goes high when the count reaches 0
+    uint64_t end = ReadTimestampCounter();
+
+    return end - start;
+}
+
+/**
+ * @details Count TSC ticks against the HPET main counter, which is far more precise than the PIT
+ * @param milliseconds How long to measure for
+ * @return The TSC ticks that passed, 0 if there is no usable HPET
+ */
+uint64_t Clock::MeasureWithHPET(uint32_t milliseconds) {
+
+    HighPrecisionEventTimerDescription hpet;
+    AdvancedConfigurationAndPowerInterface* acpi = AdvancedConfigurationAndPowerInterface::activeACPI;
+    if(acpi == 0 || PageManager::activePageManager == 0 || !acpi -> ParseHPET(&hpet))
+        return 0;
+
+    volatile uint32_t* registers = (volatile uint32_t*)PageManager::activePageManager -> MapPhysicalMemory(hpet.address, 1024, PAGE_CACHE_DISABLE);
+    if(registers == 0)
+        return 0;
+
+    //The period of the counter is in femtoseconds, the spec allows up to 100ns
+    uint32_t period = registers[0x04 / 4];
+    if(period < 10000 || period > 100000000)
+        return 0;
+
+    registers[0x10 / 4] |= 0x1;                                         //Make sure the main counter is running
+    uint32_t target = Divide64((uint64_t)milliseconds * 1000000000000ULL, period);
+
+    //Only the low half of the counter is read, the subtraction handles it wrapping
+    uint32_t counterStart = registers[0xF0 / 4];
+    uint64_t start = ReadTimestampCounter();
+    while(registers[0xF0 / 4] - counterStart < target);
+    uint64_t end = ReadTimestampCounter();
+
+    return end - start;
+}
+
+/**
+ * @details Work out how fast the TSC runs by timing 10ms on the HPET (or the PIT without one)
+ */
+void Clock::Calibrate() {
+
+    const uint32_t calibrationMilliseconds = 10;
+
+    uint64_t ticks = MeasureWithHPET(calibrationMilliseconds);
+    if(ticks == 0)
+        ticks = MeasureWithPIT(calibrationMilliseconds);
+
+    ticksPerMillisecond = (uint32_t)ticks / calibrationMilliseconds;
+    if(ticksPerMillisecond < 4000)                                      //Keep the divisions below from overflowing on a broken timer
+        ticksPerMillisecond = 4000;
+
+    //ns per tick scaled by 2^24, precise enough and cant overflow for any TSC above 4MHz
+    shift = 24;
+    mult = Divide64(1000000ULL << shift, ticksPerMillisecond);
+    microsecondMult = Divide64(1000ULL << shift, ticksPerMillisecond);
+    ticksPerMicrosecond = Divide64((uint64_t)ticksPerMillisecond << 16, 1000);
+
+}
+
+/**
+ * @details Read a register from the CMOS
+ * @param reg The register to read
+ * @return The value of the register
+ */
+uint8_t Clock::ReadCMOS(uint8_t reg) {
+
+    CMOSAddressPort.Write(reg);
+    return CMOSDataPort.Read();
+
+}
+
+/**
+ * @details Read the RTC and convert it to unix time
+ * @return Seconds since 1/1/1970
+ */
+uint32_t Clock::ReadRealTimeClock() {
+
+    while(ReadCMOS(0x0A) & 0x80);                                       //Wait for any update to finish
+
+    uint32_t second = ReadCMOS(0x00);
+    uint32_t minute = ReadCMOS(0x02);
+    uint32_t hour   = ReadCMOS(0x04);
+    uint32_t day    = ReadCMOS(0x07);
+    uint32_t month  = ReadCMOS(0x08);
+    uint32_t year   = ReadCMOS(0x09);
+    uint8_t statusB = ReadCMOS(0x0B);
+
+    //Convert from BCD unless the RTC is in binary mode
+    if(!(statusB & 0x04)){
+        second = (second & 0x0F) + ((second >> 4) * 10);
+        minute = (minute & 0x0F) + ((minute >> 4) * 10);
+        hour   = ((hour & 0x0F) + (((hour & 0x70) >> 4) * 10)) | (hour & 0x80);
+        day    = (day & 0x0F) + ((day >> 4) * 10);
+        month  = (month & 0x0F) + ((month >> 4) * 10);
+        year   = (year & 0x0F) + ((year >> 4) * 10);
+    }
+
+    //Convert 12 hour time to 24 hour time
+    if(!(statusB & 0x02) && (hour & 0x80))
+        hour = ((hour & 0x7F) + 12) % 24;
+
+    //Use the century register if the FADT gave one, otherwise assume the 2000s
+    if(centuryRegister != 0){
+        uint32_t century = ReadCMOS(centuryRegister);
+        if(!(statusB & 0x04))
+            century = (century & 0x0F) + ((century >> 4) * 10);
+        year += century * 100;
+    }else{
+        year += 2000;
+    }
+
+    //Days since the epoch
+    static const uint16_t daysBeforeMonth[12] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+    uint32_t days = (year - 1970) * 365
+                  + ((year - 1969) / 4)                                 //Leap years before this year (good until 2100)
+                  + daysBeforeMonth[(month - 1) % 12]
+                  + (day - 1);
+    if(month > 2 && (year % 4) == 0)                                    //This years leap day
+        days++;
+
+    return days * 86400 + hour * 3600 + minute * 60 + second;
+
+}
+
+/**
+ * @details Advance the time and publish it to the vDSO page
+ */
+void Clock::Update() {
+
+    uint64_t now = ReadTimestampCounter();
+    uint64_t elapsed = ((now - lastUpdate) * mult) >> shift;            //ns since the last update
+    lastUpdate = now;
+
+    elapsed += nanoseconds;
+    while(elapsed >= 1000000000){                                       //Only loops a few times as this is called every tick
+        elapsed -= 1000000000;
+        seconds++;
+    }
+    nanoseconds = (uint32_t)elapsed;
+
+    VirtualDynamicSharedObject::UpdateClock(mult, shift, lastUpdate, seconds, nanoseconds, bootTime);
+
+}
+
+/**
+ * @details Update the time on every timer interrupt
+ * @param esp The stack pointer
+ * @return The stack pointer (unchanged)
+ */
+uint32_t Clock::HandleInterrupt(uint32_t esp) {
+
+    Update();
+
+    if(Profiler::activeProfiler != 0)
+        Profiler::activeProfiler -> Sample((CPUState_Thread*)esp);
+
+    return esp;
+
+}
+
+/**
+ * @details Get how many times the TSC ticks in a millisecond
+ * @return The TSC frequency in kHz
+ */
+uint32_t Clock::TicksPerMillisecond() {
+    return ticksPerMillisecond;
+}
+
+/**
+ * @details Convert a TSC duration to microseconds
+ * @param ticks The amount of TSC ticks
+ * @return The amount of microseconds (saturates after ~71 minutes)
+ */
+uint32_t Clock::TicksToMicroseconds(uint64_t ticks) {
+
+    uint64_t microseconds = (ticks * microsecondMult) >> shift;
+    return microseconds > 0xFFFFFFFF ? 0xFFFFFFFF : (uint32_t)microseconds;
+
+}
+
+/**
+ * @details Convert microseconds to a TSC duration
+ * @param microseconds The amount of microseconds
+ * @return The amount of TSC ticks
+ */
+uint64_t Clock::MicrosecondsToTicks(uint32_t microseconds) {
+
+    return ((uint64_t)microseconds * ticksPerMicrosecond) >> 16;
+
+}
+
+/**
+ * @details Get the monotonic time since boot
+ * @param seconds Where to store the seconds
+ * @param nanoseconds Where to store the nanoseconds
+ */
+void Clock::GetTime(uint32_t* seconds, uint32_t* nanoseconds) {
+
+    uint64_t elapsed = ((ReadTimestampCounter() - lastUpdate) * mult) >> shift;
+    elapsed += this -> nanoseconds;
+    uint32_t resultSeconds = this -> seconds;
+
+    while(elapsed >= 1000000000){
+        elapsed -= 1000000000;
+        resultSeconds++;
+    }
+
+    *seconds = resultSeconds;
+    *nanoseconds = (uint32_t)elapsed;
+
+}
+
+/**
+ * @details Get the unix time the kernel booted at
+ * @return Seconds since 1/1/1970
+ */
+uint32_t Clock::BootTime() {
+    return bootTime;
+}
@@ -0,0 +1,97 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#include <system/elf.h>
+#include <system/paging.h>
+#include <system/process.h>
+
+using namespace maxOS;
+using namespace maxOS::common;
+using namespace maxOS::system;
+
+/**
+ * @details Create a loader for an executable that is already in memory
+ * @param image The ELF file
+ * @param size The size of the file
+ */
+ElfLoader::ElfLoader(uint8_t* image, uint32_t size) {
+
+    this -> image = image;
+    this -> size = size;
+
+}
+
+ElfLoader::~ElfLoader() {
+
+}
+
+/**
+ * @details Check that the file is a 32 bit i386 executable that this loader can handle
+ * @return True if the file can be loaded
+ */
+bool ElfLoader::IsValid() {
+
+    if(image == 0 || size < sizeof(ElfHeader))
+        return false;
+
+    ElfHeader* header = (ElfHeader*)image;
+
+    if(header -> identity[0] != 0x7F || header -> identity[1] != 'E' || header -> identity[2] != 'L' || header -> identity[3] != 'F')
+        return false;
+
+    if(header -> identity[4] != 1                           //32 bit
+    || header -> identity[5] != 1                           //Little endian
+    || header -> type != 2                                  //Executable
+    || header -> machine != 3)                              //i386
+        return false;
+
+    if(header -> programHeaderSize != sizeof(ElfProgramHeader))
+        return false;
+
+    //Program headers must be inside the file
+    return header -> programHeaderOffset <= size && header -> programHeaderCount * sizeof(ElfProgramHeader) <= size - header -> programHeaderOffset;
+}
+
+/**
+ * @details Get where execution starts
+ * @return The entry point
+ */
+uint32_t ElfLoader::EntryPoint() {
+    return ((ElfHeader*)image) -> entry;
+}
+
+/**
+ * @details Describe the loadable segments to the process, nothing is copied until the process touches a page (read only pages are then shared through the page cache)
+ * @param process The process to load into
+ * @return True if every segment was accepted
+ */
+bool ElfLoader::Load(Process* process) {
+
+    if(!IsValid())
+        return false;
+
+    ElfHeader* header = (ElfHeader*)image;
+    ElfProgramHeader* programHeaders = (ElfProgramHeader*)(image + header -> programHeaderOffset);
+
+    for(int i = 0; i < header -> programHeaderCount; ++i){
+
+        ElfProgramHeader* segment = &programHeaders[i];
+        if(segment -> type != ELF_PROGRAM_LOAD || segment -> memorySize == 0)
+            continue;
+
+        //Segments have to fit in user space and their data has to fit in the file
+        if(segment -> virtualAddress < USER_SPACE_START
+        || segment -> virtualAddress + segment -> memorySize > USER_SPACE_END
+        || segment -> virtualAddress + segment -> memorySize < segment -> virtualAddress
+        || segment -> fileSize > segment -> memorySize
+        || segment -> offset > size
+        || segment -> fileSize > size - segment -> offset)
+            return false;
+
+        if(!process -> AddRegion(segment -> virtualAddress, segment -> memorySize, (segment -> flags & ELF_PROGRAM_WRITE) != 0, image, size, segment -> offset, segment -> fileSize))
+            return false;
+    }
+
+    return true;
+}
@@ -7,14 +7,19 @@ using namespace maxOS;
 using namespace maxOS::common;
 using namespace maxOS::system;
 
+TaskStateSegment GlobalDescriptorTable::taskStateSegment;
+
 /**
  * Global Descriptor Table
  */
 GlobalDescriptorTable::GlobalDescriptorTable()
         : nullSegmentSelector(0, 0, 0),                     //Ignored
           unusedSegmentSelector(0, 0, 0),                   //Ignored
-          codeSegmentSelector(0, 64*1024*1024, 0x9A),       //0x9A Access for code
-          dataSegmentSelector(0, 64*1024*1024, 0x92)        //0x92 Access flag for data
+          codeSegmentSelector(0, 0xFFFFFFFF, 0x9A),         //0x9A Access for code (flat 4GB so that MMIO and user space are reachable)
+          dataSegmentSelector(0, 0xFFFFFFFF, 0x92),         //0x92 Access flag for data
+          userCodeSegmentSelector(0, 0xFFFFFFFF, 0xFA),     //0xFA Access for ring 3 code
+          userDataSegmentSelector(0, 0xFFFFFFFF, 0xF2),     //0xF2 Access for ring 3 data
+          taskStateSegmentSelector((uint32_t)&taskStateSegment, sizeof(TaskStateSegment) - 1, 0x89)      //0x89 Present 32 bit TSS
 {
     //Tell processor to use this table   (8 bytes)
     uint32_t gdt_t[2];
@@ -23,6 +28,18 @@ GlobalDescriptorTable::GlobalDescriptorTable()
 
     asm volatile("lgdt (%0)": :"p" (((uint8_t *) gdt_t)+2));    //Pass it as an unsigned 8Bit int to assembly (p means push adress)
 
+    //The TSS only provides the kernel stack for interrupts coming from ring 3
+    ((uint8_t*)&taskStateSegmentSelector)[6] &= 0x0F;          //System segments don't use the size flag
+    taskStateSegment.ss0 = DataSegmentSelector();
+    taskStateSegment.esp0 = 0;
+    taskStateSegment.ioMapBase = sizeof(TaskStateSegment);      //No IO permission bitmap
+    uint16_t tss = TaskStateSegmentSelector();
+    asm volatile("ltr %0" : : "r"(tss));
+
+    //The user data segment is DPL 3 so it can stay loaded in the kernel, that way iret to ring 3 doesn't have to swap it
+    uint16_t userData = UserDataSegmentSelector();
+    asm volatile("mov %0, %%ds\n mov %0, %%es\n mov %0, %%fs\n mov %0, %%gs" : : "r"(userData));
+
 }
 
 
@@ -49,6 +66,42 @@ uint16_t GlobalDescriptorTable::CodeSegmentSelector()
     return (uint8_t*)&codeSegmentSelector - (uint8_t*)this;
 }
 
+/**
+ * User Code Segment Selector
+ * @return The ring 3 code segment selector (with the RPL set)
+ */
+uint16_t GlobalDescriptorTable::UserCodeSegmentSelector()
+{
+    return ((uint8_t*)&userCodeSegmentSelector - (uint8_t*)this) | 3;
+}
+
+/**
+ * User Data Segment Selector
+ * @return The ring 3 data segment selector (with the RPL set)
+ */
+uint16_t GlobalDescriptorTable::UserDataSegmentSelector()
+{
+    return ((uint8_t*)&userDataSegmentSelector - (uint8_t*)this) | 3;
+}
+
+/**
+ * Task State Segment Selector
+ * @return The TSS selector offset
+ */
+uint16_t GlobalDescriptorTable::TaskStateSegmentSelector()
+{
+    return (uint8_t*)&taskStateSegmentSelector - (uint8_t*)this;
+}
+
+/**
+ * @details Set the stack the CPU switches to when an interrupt arrives from ring 3
+ * @param esp0 The top of the kernel stack of the thread that is about to run
+ */
+void GlobalDescriptorTable::SetKernelStack(uint32_t esp0)
+{
+    taskStateSegment.esp0 = esp0;
+}
+
 //Setup GDT for memory
 /**
  * @details Constructor for Segment Selector
@@ -0,0 +1,521 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#include <system/iouring.h>
+#include <system/clock.h>
+#include <system/memorymanagement.h>
+#include <system/process.h>
+#include <hardwarecommunication/interrupts.h>
+
+using namespace maxOS;
+using namespace maxOS::common;
+using namespace maxOS::hardwarecommunication;
+using namespace maxOS::system;
+
+///__FILE__
+
+IORingFile::IORingFile() {
+
+}
+
+IORingFile::~IORingFile() {
+
+}
+
+//By default a file doesn't support anything, drivers override what they can do
+
+int32_t IORingFile::Read(uint8_t*, uint32_t, uint32_t) {
+    return -1;
+}
+
+int32_t IORingFile::Write(uint8_t*, uint32_t, uint32_t) {
+    return -1;
+}
+
+int32_t IORingFile::Send(uint8_t*, uint32_t) {
+    return -1;
+}
+
+int32_t IORingFile::Receive(uint8_t*, uint32_t) {
+    return -1;
+}
+
+int32_t IORingFile::Sync() {
+    return -1;
+}
+
+///__RING__
+
+IORing* IORing::rings[IORing::maxRings] = {0};
+IORingFile* IORing::files[IORing::maxFiles] = {0};
+
+/**
+ * @details Create a ring and its shared queues. Rings of user processes get their queues in fresh frames mapped at the given address, the
+ * constructor has to run in the owner's address space. Check IsValid afterwards
+ * @param entries The size of the queues, a power of two
+ * @param flags The IORingSetupFlags
+ * @param owner The process that the ring belongs to
+ * @param addressSpace The address space of the owner, 0 for kernel threads
+ * @param address Where to map the queues in the owner's address space
+ */
+IORing::IORing(uint32_t entries, uint32_t flags, pid_t owner, PageDirectory* addressSpace, uint32_t address) {
+
+    this -> owner = owner;
+    this -> addressSpace = addressSpace;
+    this -> entries = entries;
+    this -> mask = entries - 1;
+    this -> flags = flags;
+    this -> activeTimeouts = 0;
+    this -> submissionHead = 0;
+    this -> queues = 0;
+
+    for(int i = 0; i < maxTimeouts; ++i)
+        timeouts[i].active = false;
+
+    //Header, submissions and completions in one block
+    size = sizeof(IORingQueues) + entries * sizeof(IORingSubmission) + entries * sizeof(IORingCompletion);
+
+    if(addressSpace == 0){
+
+        //Kernel threads can just use the heap
+        queues = (IORingQueues*)MemoryManager::activeMemoryManager -> malloc(size);
+        if(queues == 0)
+            return;
+
+    }else{
+
+        if(!MapQueues(address))
+            return;
+
+        queues = (IORingQueues*)address;
+    }
+
+    submissions = (IORingSubmission*)((uint8_t*)queues + sizeof(IORingQueues));
+    completions = (IORingCompletion*)((uint8_t*)submissions + entries * sizeof(IORingSubmission));
+
+    queues -> submissionHead = 0;
+    queues -> submissionTail = 0;
+    queues -> completionHead = 0;
+    queues -> completionTail = 0;
+    queues -> entries = entries;
+    queues -> mask = mask;
+    queues -> droppedCompletions = 0;
+    queues -> submissions = submissions;
+    queues -> completions = completions;
+
+}
+
+IORing::~IORing() {
+
+    if(queues == 0)
+        return;
+
+    if(addressSpace == 0){
+        MemoryManager::activeMemoryManager -> free(queues);
+        return;
+    }
+
+    //Give the frames back, the process may keep running without the ring
+    PageManager* pageManager = PageManager::activePageManager;
+    for(uint32_t page = 0; page < size; page += PAGE_SIZE){
+
+        uint32_t entry = pageManager -> Lookup(addressSpace, (uint32_t)queues + page);
+        if(!(entry & PAGE_PRESENT))
+            continue;
+
+        pageManager -> Unmap(addressSpace, (uint32_t)queues + page);
+        pageManager -> FreeFrame((void*)(entry & ~(PAGE_SIZE - 1)));
+    }
+
+}
+
+/**
+ * @details Map zeroed frames for the queues into the owner's address space, only the ring's own memory ends up visible to user space
+ * @param address The page aligned address to map them at
+ * @return True if all of the queues were mapped
+ */
+bool IORing::MapQueues(uint32_t address) {
+
+    PageManager* pageManager = PageManager::activePageManager;
+    for(uint32_t page = 0; page < size; page += PAGE_SIZE){
+
+        uint8_t* frame = (uint8_t*)pageManager -> AllocateFrame();
+        if(frame == 0 || pageManager -> Lookup(addressSpace, address + page) & PAGE_PRESENT
+           || !pageManager -> Map(addressSpace, address + page, (uint32_t)frame, PAGE_USER | PAGE_WRITABLE)){
+
+            if(frame != 0)
+                pageManager -> FreeFrame(frame);
+
+            //Undo the pages that were mapped
+            for(uint32_t mapped = 0; mapped < page; mapped += PAGE_SIZE){
+                uint32_t entry = pageManager -> Lookup(addressSpace, address + mapped);
+                pageManager -> Unmap(addressSpace, address + mapped);
+                pageManager -> FreeFrame((void*)(entry & ~(PAGE_SIZE - 1)));
+            }
+            return false;
+        }
+
+        //Frames are identity mapped for the kernel
+        for(uint32_t i = 0; i < PAGE_SIZE; ++i)
+            frame[i] = 0;
+    }
+
+    return true;
+}
+
+/**
+ * @details Check if the ring was set up
+ * @return True if the queues were allocated
+ */
+bool IORing::IsValid() {
+    return queues != 0;
+}
+
+/**
+ * @details Get the queues that are shared with user space
+ * @return The queues, as the owner sees them
+ */
+IORingQueues* IORing::Queues() {
+    return queues;
+}
+
+/**
+ * @details Post a completion to the completion queue
+ * @param userData The user data of the submission
+ * @param result The result of the operation
+ */
+void IORing::Complete(uint32_t userData, int32_t result) {
+
+    uint32_t tail = queues -> completionTail;
+
+    //If user space hasn't reaped the queue there is nowhere to put this
+    if(tail - queues -> completionHead >= entries){
+        queues -> droppedCompletions++;
+        return;
+    }
+
+    completions[tail & mask].userData = userData;
+    completions[tail & mask].result = result;
+
+    asm volatile("" : : : "memory");                                    //Entry must be visible before the tail moves
+    queues -> completionTail = tail + 1;
+
+}
+
+/**
+ * @details Check that a buffer of a submission belongs to the owner and map it in, so that a submission can't point a driver at kernel memory
+ * @param address The start of the buffer
+ * @param length The size of the buffer in bytes
+ * @param write Whether the operation writes to the buffer
+ * @return True if the buffer can be used
+ */
+bool IORing::IsOwnerMemory(uint32_t address, uint32_t length, bool write) {
+
+    if(addressSpace == 0)
+        return true;
+
+    Process* process = ProcessManager::activeProcessManager == 0 ? 0 : ProcessManager::activeProcessManager -> GetProcess(owner);
+    return process != 0 && process -> FaultIn(address, length, write);
+}
+
+/**
+ * @details Run a single submission
+ * @param entry The submission to run, it is in shared memory so it is copied before being looked at
+ */
+void IORing::Execute(IORingSubmission* entry) {
+
+    IORingSubmission submission;
+    submission.opcode = entry -> opcode;
+    submission.fd = entry -> fd;
+    submission.offset = entry -> offset;
+    submission.address = entry -> address;
+    submission.length = entry -> length;
+    submission.userData = entry -> userData;
+    asm volatile("" : : : "memory");                                    //Only use the copy from here on
+
+    IORingFile* file = (submission.fd >= 0 && submission.fd < maxFiles) ? files[submission.fd] : 0;
+    uint8_t* buffer = (uint8_t*)submission.address;
+    int32_t result = -1;
+
+    //Reads fill the buffer, writes only look at it
+    bool fills = submission.opcode == IORING_OP_READ || submission.opcode == IORING_OP_RECV;
+    bool usesBuffer = fills || submission.opcode == IORING_OP_WRITE || submission.opcode == IORING_OP_SEND;
+    if(usesBuffer && !IsOwnerMemory(submission.address, submission.length, fills))
+        file = 0;
+
+    switch (submission.opcode) {
+
+        case IORING_OP_NOP:
+            result = 0;
+            break;
+
+        case IORING_OP_READ:
+            if(file != 0) result = file -> Read(buffer, submission.length, submission.offset);
+            break;
+
+        case IORING_OP_WRITE:
+            if(file != 0) result = file -> Write(buffer, submission.length, submission.offset);
+            break;
+
+        case IORING_OP_SEND:
+            if(file != 0) result = file -> Send(buffer, submission.length);
+            break;
+
+        case IORING_OP_RECV:
+            if(file != 0) result = file -> Receive(buffer, submission.length);
+            break;
+
+        case IORING_OP_FSYNC:
+            if(file != 0) result = file -> Sync();
+            break;
+
+        case IORING_OP_TIMEOUT:
+            if(Clock::activeClock == 0)
+                break;
+
+            //Completes later, once the deadline has passed (checked by the poller and by threads waiting in Enter)
+            for(int i = 0; i < maxTimeouts; ++i){
+                if(timeouts[i].active)
+                    continue;
+
+                timeouts[i].deadline = Clock::ReadTimestampCounter() + Clock::activeClock -> MicrosecondsToTicks(submission.offset);
+                timeouts[i].userData = submission.userData;
+                timeouts[i].active = true;
+                activeTimeouts++;
+                return;
+            }
+            break;                                                      //No free timeout slots
+
+        default:
+            break;
+    }
+
+    Complete(submission.userData, result);
+
+}
+
+/**
+ * @details Complete any timeouts whose deadline has passed, the owner's address space has to be loaded
+ */
+void IORing::ExpireTimeouts() {
+
+    if(activeTimeouts == 0)
+        return;
+
+    uint64_t now = Clock::ReadTimestampCounter();
+    for(int i = 0; i < maxTimeouts; ++i){
+        if(timeouts[i].active && timeouts[i].deadline <= now){
+            timeouts[i].active = false;
+            activeTimeouts--;
+            Complete(timeouts[i].userData, 0);
+        }
+    }
+
+}
+
+/**
+ * @details Block the calling thread until there are enough completions to reap. Interrupts are on while it sleeps so the timer can run
+ * other threads (and the poller) meanwhile
+ * @param minComplete The amount of completions to wait for
+ */
+void IORing::Wait(uint32_t minComplete) {
+
+    while(true){
+
+        ExpireTimeouts();
+        if(queues -> completionTail - queues -> completionHead >= minComplete)
+            return;
+
+        //Nothing is in flight that could complete, waiting would never end
+        if(activeTimeouts == 0 && !(flags & IORING_SETUP_SQPOLL))
+            return;
+
+        asm volatile("sti\n hlt\n cli");
+    }
+
+}
+
+/**
+ * @details Consume submissions from the submission queue, the owner's address space has to be loaded
+ * @param count The maximum amount of submissions to consume, at most the size of the queue is taken per call
+ * @return The amount of submissions consumed, -1 if user space moved the tail further than the queue is long
+ */
+int32_t IORing::Submit(uint32_t count) {
+
+    //The head in shared memory is only written by the kernel, but user space can scribble over it so the kernel's copy is used
+    uint32_t head = submissionHead;
+    uint32_t tail = queues -> submissionTail;                           //Read once, user space can keep moving it
+    asm volatile("" : : : "memory");                                    //Read the tail before the entries it covers
+
+    if(tail - head > entries)
+        return -1;
+
+    if(count > entries)
+        count = entries;
+
+    uint32_t submitted = 0;
+    while(head != tail && submitted < count){
+        Execute(&submissions[head & mask]);
+        head++;
+        submitted++;
+    }
+
+    asm volatile("" : : : "memory");
+    submissionHead = head;
+    queues -> submissionHead = head;                                    //Hand the slots back to user space
+
+    ExpireTimeouts();
+    return submitted;
+
+}
+
+/**
+ * @details Make a file available to all rings
+ * @param file The file to register
+ * @return The fd to use in submissions, -1 if the table is full
+ */
+int IORing::RegisterFile(IORingFile* file) {
+
+    for(int i = 0; i < maxFiles; ++i){
+        if(files[i] == 0){
+            files[i] = file;
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * @details Create a ring for the calling process (the io_uring_setup syscall)
+ * @param parameters The requested size and flags, the queues are returned in it
+ * @return The ring ID, -1 on error
+ */
+int IORing::Setup(IORingParameters* parameters) {
+
+    if(parameters == 0 || parameters -> entries == 0 || parameters -> entries > 256)
+        return -1;
+
+    //Round up to a power of two so that indexes can be masked
+    uint32_t entries = 1;
+    while(entries < parameters -> entries)
+        entries <<= 1;
+
+    Process* process = ProcessManager::activeProcessManager == 0 ? 0 : ProcessManager::activeProcessManager -> CurrentProcess();
+    pid_t owner = process == 0 ? 0 : process -> GetPID();
+    PageDirectory* addressSpace = process == 0 ? 0 : process -> AddressSpace();
+
+    for(int i = 0; i < maxRings; ++i){
+        if(rings[i] != 0)
+            continue;
+
+        rings[i] = new IORing(entries, parameters -> flags, owner, addressSpace, USER_IORING_START + i * USER_IORING_SIZE);
+        if(rings[i] == 0)
+            return -1;
+
+        if(!rings[i] -> IsValid()){
+            delete rings[i];
+            rings[i] = 0;
+            return -1;
+        }
+
+        parameters -> entries = entries;
+        parameters -> queues = rings[i] -> Queues();
+        return i;
+    }
+
+    return -1;
+}
+
+/**
+ * @details Submit work to a ring and wait for it (the io_uring_enter syscall)
+ * @param ring The ring ID
+ * @param toSubmit The maximum amount of submissions to consume
+ * @param minComplete The amount of completions to wait for before returning
+ * @return The amount of submissions consumed, -1 on error
+ */
+int IORing::Enter(int ring, uint32_t toSubmit, uint32_t minComplete) {
+
+    if(ring < 0 || ring >= maxRings || rings[ring] == 0)
+        return -1;
+
+    //Only the owner can use a ring, its queues aren't mapped anywhere else
+    Process* process = ProcessManager::activeProcessManager == 0 ? 0 : ProcessManager::activeProcessManager -> CurrentProcess();
+    if(rings[ring] -> owner != (process == 0 ? 0 : process -> GetPID()))
+        return -1;
+
+    //Polled rings are only ever consumed by the poller thread
+    int32_t submitted = 0;
+    if(!(rings[ring] -> flags & IORING_SETUP_SQPOLL))
+        submitted = rings[ring] -> Submit(toSubmit);
+
+    if(submitted < 0)
+        return -1;
+
+    if(minComplete > rings[ring] -> entries)
+        minComplete = rings[ring] -> entries;
+
+    rings[ring] -> Wait(minComplete);
+    return submitted;
+}
+
+/**
+ * @details Destroy the rings of a process, called when it exits
+ * @param pid The process ID
+ */
+void IORing::Release(pid_t pid) {
+
+    for(int i = 0; i < maxRings; ++i){
+        if(rings[i] != 0 && rings[i] -> owner == pid){
+            delete rings[i];
+            rings[i] = 0;
+        }
+    }
+
+}
+
+/**
+ * @details Entry point of the kernel poller thread, consumes the submissions of every SQPOLL ring and expires the timeouts of every ring
+ */
+void IORing::Poller() {
+
+    PageManager* pageManager = PageManager::activePageManager;
+
+    while(true){
+
+        uint32_t submitted = 0;
+        for(int i = 0; i < maxRings; ++i){
+
+            //The ring's memory is only mapped in its owner's address space, borrow it without being switched away in the middle
+            uint32_t flags = DisableInterrupts();
+
+            IORing* ring = rings[i];
+            if(ring != 0){
+
+                PageDirectory* previous = pageManager -> CurrentAddressSpace();
+                if(ring -> addressSpace != 0)
+                    pageManager -> SwitchAddressSpace(ring -> addressSpace);
+
+                //A ring whose tail is out of range is skipped until user space puts it right
+                int32_t consumed = 0;
+                if(ring -> flags & IORING_SETUP_SQPOLL)
+                    consumed = ring -> Submit(ring -> entries);
+                else
+                    ring -> ExpireTimeouts();
+
+                if(consumed > 0)
+                    submitted += consumed;
+
+                pageManager -> SwitchAddressSpace(previous);
+            }
+
+            RestoreInterrupts(flags);
+        }
+
+        //Nothing to do, sleep until the next interrupt instead of spinning
+        if(submitted == 0)
+            asm volatile("hlt");
+    }
+
+}
@@ -203,4 +203,12 @@ void operator delete[](void* pointer){
 
     }
 
-}
\ No newline at end of file
+}
+//Sized delete (the compiler uses these when it knows the size of the object)
+void operator delete(void* pointer, unsigned size){
+    operator delete(pointer);
+}
+
+void operator delete[](void* pointer, unsigned size){
+    operator delete[](pointer);
+}
@@ -2,6 +2,10 @@
 // Created by 98max on 15/11/2022.
 //
 #include <system/multithreading.h>
+#include <system/vdso.h>
+#include <system/paging.h>
+#include <system/clock.h>
+#include <system/trace.h>
 
 #define nullptr 0
 
@@ -14,6 +18,7 @@ int ThreadManager::numThreads = 0;
 int ThreadManager::currentThread = -1;
 Thread *ThreadManager::Threads[256] = {nullptr};
 GlobalDescriptorTable *ThreadManager::gdt;
+ThreadManager* ThreadManager::activeThreadManager = nullptr;
 common::uint8_t ThreadManager::stack[256][5012];
 
 void printf(char* str, bool clearLine = false); //Forward declaration
@@ -43,40 +48,57 @@ Thread::~Thread()
 
 ThreadManager::ThreadManager()
 {
+    activeThreadManager = this;
 }
 
 ThreadManager::ThreadManager(GlobalDescriptorTable *gdt)
 {
     this->gdt = gdt;
+    activeThreadManager = this;
 }
 
 ThreadManager::~ThreadManager()
 {
+    if (activeThreadManager == this)
+        activeThreadManager = nullptr;
 }
 
 /**
  * @brief Add a thread to an empty place in the array
  *
  * @param Thread thread to add
+ * @param pid id of the process that owns the thread (0 for the kernel)
  * @return true if succesfully added
  * @return false if error
  */
-int ThreadManager::CreateThread(void entrypoint())
+int ThreadManager::CreateThread(void entrypoint(), pid_t pid)
 {
 
     if (numThreads >= 256)                                                  // if there are more than 256 threads, return false
         return false;
 
     int i = 0;
-    while (i <= 256)                                                        // find an empty place in the array
+    while (i < 256)                                                         // find an empty place in the array
     {
         if (Threads[i] == nullptr)                                          // if the place is empty
         {
             Thread *th = (Thread *)(stack[i] + (5012 - sizeof(Thread)));    // init space for thread
             th->init(gdt, entrypoint);                                      // init thread
             th->tid = i;                                                    // set thread id
-            Threads[numThreads] = th;                                       // add thread to array
-            Threads[numThreads]->cpustate->cs = gdt->CodeSegmentSelector(); // set code segment
+            th->pid = pid;                                                  // set owning process
+            th->addressSpace = nullptr;                                     // kernel threads don't switch address space
+            th->kernelStack = 0;                                            // kernel threads trap on the stack they run on
+            th->statistics.runTicks = 0;                                    // clear the accounting of the last thread in this slot
+            th->statistics.irqTicks = 0;
+            th->statistics.wakeupLatencyTicks = 0;
+            th->statistics.maxWakeupLatencyTicks = 0;
+            th->statistics.wakeups = 0;
+            th->statistics.voluntarySwitches = 0;
+            th->statistics.involuntarySwitches = 0;
+            th->readySince = Clock::ReadTimestampCounter();                 // ready to run from now on
+            th->scheduledAt = th->readySince;
+            Threads[i] = th;                                                // add thread to array
+            Threads[i]->cpustate->cs = gdt->CodeSegmentSelector();          // set code segment
             numThreads++;                                                   // increment number of threads
             return th->tid;                                                 // return thread id
         }
@@ -87,15 +109,68 @@ int ThreadManager::CreateThread(void entrypoint())
     return -1;                                                              // if no empty place was found, return -1
 }
 
+/**
+ * @brief Add a thread that runs in ring 3 inside a process's address space
+ *
+ * @param entrypoint user address to start at
+ * @param userStack top of the user stack
+ * @param pid id of the process that owns the thread
+ * @param addressSpace page directory of the process
+ * @return the thread id, -1 if there is no space
+ */
+int ThreadManager::CreateUserThread(uint32_t entrypoint, uint32_t userStack, pid_t pid, PageDirectory* addressSpace)
+{
+
+    int tid = CreateThread((void (*)())entrypoint, pid);
+    if (tid < 0)
+        return -1;
+
+    // iret sees a lower privilege level so it also pops the user stack
+    Thread *th = Threads[tid];
+
+    // traps from ring 3 get a stack of their own, the 4 KiB thread stack is too small for a syscall that ends up in a driver
+    th->kernelStack = (uint32_t)PageManager::activePageManager->AllocateKernelStack(tid);
+    if (th->kernelStack == 0)
+    {
+        TerminateThread(tid);
+        return -1;
+    }
+
+    th->addressSpace = addressSpace;
+    th->cpustate->cs = gdt->UserCodeSegmentSelector();
+    th->cpustate->ss = gdt->UserDataSegmentSelector();
+    th->cpustate->esp = userStack;
+    return tid;
+}
+
+/**
+ * @brief Get the process of the running thread
+ *
+ * @return the process id, 0 if the kernel is running
+ */
+pid_t ThreadManager::CurrentPID()
+{
+    if (currentThread < 0 || currentThread >= 256 || Threads[currentThread] == nullptr)
+        return 0;
+
+    return Threads[currentThread]->pid;
+}
+
 /**
  * @brief Schedules the next thread to be executed by checking its yieldsStatus.
  *
  * @param cpustate state
+ * @param voluntary true if the running thread gave up the CPU itself, false if it was preempted
  * @return CPUState_Thread* thread to be executed state
  */
-CPUState_Thread *ThreadManager::Schedule(CPUState_Thread* cpustate)
+CPUState_Thread *ThreadManager::Schedule(CPUState_Thread* cpustate, bool voluntary)
 {
 
+    uint64_t now = Clock::ReadTimestampCounter();
+    Thread *previous = (currentThread >= 0 && Threads[currentThread] != nullptr) ? Threads[currentThread] : nullptr;
+    if (previous != nullptr)                                                // charge the time slice that just ended
+        previous->statistics.runTicks += now - previous->scheduledAt;
+
     if(cpustate -> eax == 37){                                              // if eax is 37, it means that the thread is being killed
         TerminateThread(currentThread);                                  // kill the thread
     }
@@ -121,10 +196,42 @@ CPUState_Thread *ThreadManager::Schedule(CPUState_Thread* cpustate)
         {
 
             if (Threads[i]->yieldStatus)                                    // if the thread is yielded
+            {
                 Threads[i]->yieldStatus = false;                            // set yieldStatus to false
+                Threads[i]->readySince = now;                               // it sat this round out, so it is only ready from now
+            }
             else
             {
                 currentThread = i;                                          // set currentThread to i
+
+                if (Threads[i] != previous)                                 // a real context switch
+                {
+                    if (previous != nullptr)
+                    {
+                        if (voluntary)
+                            previous->statistics.voluntarySwitches++;
+                        else
+                            previous->statistics.involuntarySwitches++;
+                        previous->readySince = now;
+                    }
+
+                    Tracer::Trace(TRACE_CONTEXT_SWITCH, previous != nullptr ? previous->tid : -1, Threads[i]->tid);
+
+                    uint64_t latency = now - Threads[i]->readySince;
+                    Threads[i]->statistics.wakeups++;
+                    Threads[i]->statistics.wakeupLatencyTicks += latency;
+                    if (latency > Threads[i]->statistics.maxWakeupLatencyTicks)
+                        Threads[i]->statistics.maxWakeupLatencyTicks = latency;
+                }
+                Threads[i]->scheduledAt = now;
+
+                if (Threads[i]->addressSpace != nullptr)                    // user threads need their memory and a kernel stack for the next trap
+                {
+                    PageManager::activePageManager->SwitchAddressSpace(Threads[i]->addressSpace);
+                    gdt->SetKernelStack(Threads[i]->kernelStack);
+                }
+
+                VirtualDynamicSharedObject::SetProcess(Threads[i]->pid);    // let getpid() run without a syscall
                 return Threads[i] -> cpustate;                              // return the state of the thread
             }
         }
@@ -138,6 +245,54 @@ CPUState_Thread *ThreadManager::Schedule(CPUState_Thread* cpustate)
     return cpustate;
 }
 
+/**
+ * @brief Charge time spent in a hardware interrupt handler to the running thread
+ *
+ * @param ticks TSC ticks the handler took
+ */
+void ThreadManager::AccountInterrupt(uint64_t ticks)
+{
+    if (currentThread >= 0 && currentThread < 256 && Threads[currentThread] != nullptr)
+        Threads[currentThread]->statistics.irqTicks += ticks;
+}
+
+/**
+ * @brief Copy out the CPU usage of every thread (the data behind a task manager)
+ *
+ * @param info array to fill
+ * @param maxThreads size of the array
+ * @return the number of entries filled
+ */
+int ThreadManager::GetStatistics(ThreadInfo* info, int maxThreads)
+{
+    uint64_t now = Clock::ReadTimestampCounter();
+    int count = 0;
+
+    for (int i = 0; i < 256 && count < maxThreads; i++)
+    {
+        Thread *th = Threads[i];
+        if (th == nullptr)
+            continue;
+
+        info[count].tid = th->tid;
+        info[count].pid = th->pid;
+        info[count].statistics.runTicks = th->statistics.runTicks;
+        info[count].statistics.irqTicks = th->statistics.irqTicks;
+        info[count].statistics.wakeupLatencyTicks = th->statistics.wakeupLatencyTicks;
+        info[count].statistics.maxWakeupLatencyTicks = th->statistics.maxWakeupLatencyTicks;
+        info[count].statistics.wakeups = th->statistics.wakeups;
+        info[count].statistics.voluntarySwitches = th->statistics.voluntarySwitches;
+        info[count].statistics.involuntarySwitches = th->statistics.involuntarySwitches;
+
+        if (i == currentThread)                                             // include the slice that is still running
+            info[count].statistics.runTicks += now - th->scheduledAt;
+
+        count++;
+    }
+
+    return count;
+}
+
 /**
  * @brief Terminates a thread by removing it from an array by making its pointer nullptr
  *
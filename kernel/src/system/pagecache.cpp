@@ -0,0 +1,719 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#include <system/pagecache.h>
+#include <system/paging.h>
+#include <system/clock.h>
+#include <hardwarecommunication/interrupts.h>
+
+using namespace maxOS;
+using namespace maxOS::common;
+using namespace maxOS::hardwarecommunication;
+using namespace maxOS::drivers;
+using namespace maxOS::system;
+
+PageCache* PageCache::activePageCache = 0;
+
+PageCache::PageCache() {
+
+    activePageCache = this;
+
+    hits = 0;
+    misses = 0;
+    readAheads = 0;
+    writeBacks = 0;
+    numDirty = 0;
+    nextWriteBack = 0;
+
+    for(int i = 0; i < numBuckets; ++i)
+        buckets[i] = -1;
+
+    //Every slot starts on the free list
+    for(int i = 0; i < maxPages; ++i){
+        pages[i].owner = 0;
+        pages[i].frame = 0;
+        pages[i].flags = 0;
+        pages[i].io = -1;
+        pages[i].next = i + 1 < maxPages ? i + 1 : -1;
+    }
+    freePages = 0;
+    clockHand = 0;
+
+    for(int i = 0; i < maxIO; ++i)
+        ios[i].context = 0;
+
+    for(int i = 0; i < maxStreams; ++i)
+        streams[i].device = 0;
+    nextStream = 0;
+
+}
+
+PageCache::~PageCache() {
+
+    if(activePageCache == this)
+        activePageCache = 0;
+
+}
+
+/**
+ * @details Pick the bucket of a page
+ * @param owner The file or device
+ * @param index The page of the owner
+ * @return The bucket index
+ */
+uint32_t PageCache::Hash(void* owner, uint32_t index) {
+
+    uint32_t hash = ((uint32_t)owner >> 12) ^ (index * 2654435761u);
+    return (hash ^ (hash >> 16)) % numBuckets;
+
+}
+
+/**
+ * @details Convert a time to TSC ticks, assuming 1GHz until the clock is calibrated
+ * @param microseconds The time
+ * @return The amount of ticks
+ */
+uint64_t PageCache::MicrosecondsToTicks(uint32_t microseconds) {
+
+    if(Clock::activeClock == 0)
+        return (uint64_t)microseconds * 1000;
+
+    return Clock::activeClock -> MicrosecondsToTicks(microseconds);
+}
+
+/**
+ * @details Look a page up, interrupts have to be off
+ * @param owner The file or device
+ * @param index The page of the owner
+ * @return The slot, -1 if it isn't cached
+ */
+int16_t PageCache::Find(void* owner, uint32_t index) {
+
+    for(int16_t i = buckets[Hash(owner, index)]; i != -1; i = pages[i].next)
+        if(pages[i].owner == owner && pages[i].index == index)
+            return i;
+
+    return -1;
+}
+
+/**
+ * @details Give a page a slot and a frame, evicting old pages if either has run out. Interrupts have to be off
+ * @param owner The file or device
+ * @param index The page of the owner
+ * @param flags The flags it starts with
+ * @return The slot, -1 if out of memory
+ */
+int16_t PageCache::Insert(void* owner, uint32_t index, uint8_t flags) {
+
+    if(freePages == -1 && Evict() == 0)
+        return -1;
+
+    PageManager* pageManager = PageManager::activePageManager;
+    void* frame = pageManager -> AllocateFrame();
+    if(frame == 0 && Evict() != 0)
+        frame = pageManager -> AllocateFrame();
+    if(frame == 0)
+        return -1;
+
+    uint32_t bucket = Hash(owner, index);
+    int16_t slot = freePages;
+    freePages = pages[slot].next;
+
+    pages[slot].owner = owner;
+    pages[slot].index = index;
+    pages[slot].frame = frame;
+    pages[slot].flags = flags;
+    pages[slot].io = -1;
+    pages[slot].dirtied = 0;
+    pages[slot].next = buckets[bucket];
+    buckets[bucket] = slot;
+
+    return slot;
+}
+
+/**
+ * @details Drop a page, freeing its frame (processes that still map it keep their reference) and putting its slot on the free list
+ * @param slot The slot
+ */
+void PageCache::Remove(int16_t slot) {
+
+    CachedPage* page = &pages[slot];
+
+    int16_t* link = &buckets[Hash(page -> owner, page -> index)];
+    while(*link != slot)
+        link = &pages[*link].next;
+    *link = page -> next;
+
+    PageManager::activePageManager -> FreeFrame(page -> frame);
+    page -> owner = 0;
+    page -> frame = 0;
+    page -> flags = 0;
+    page -> next = freePages;
+    freePages = slot;
+
+}
+
+/**
+ * @details Find a page of a file, reading it into a new frame if it isn't cached. The cache keeps its own reference to the frame so it stays warm after every process using it has exited
+ * @param file The file (files are identified by where they are in memory)
+ * @param fileSize The size of the file, the page is zeroed past the end
+ * @param offset The page aligned offset into the file
+ * @return The frame holding the page (the caller must ShareFrame it before mapping it), 0 if out of memory
+ */
+void* PageCache::GetPage(uint8_t* file, uint32_t fileSize, uint32_t offset) {
+
+    uint32_t flags = DisableInterrupts();
+
+    int16_t slot = Find(file, offset / PAGE_SIZE);
+    if(slot != -1){
+        hits++;
+        pages[slot].flags |= CACHED_PAGE_REFERENCED;
+        RestoreInterrupts(flags);
+        return pages[slot].frame;
+    }
+
+    misses++;
+
+    slot = Insert(file, offset / PAGE_SIZE, CACHED_PAGE_UPTODATE);
+    if(slot == -1){
+        RestoreInterrupts(flags);
+        return 0;
+    }
+
+    uint8_t* frame = (uint8_t*)pages[slot].frame;
+    for(uint32_t i = 0; i < PAGE_SIZE; ++i)
+        frame[i] = offset + i < fileSize ? file[offset + i] : 0;
+
+    RestoreInterrupts(flags);
+    return frame;
+}
+
+/**
+ * @details Free pages when memory runs low, picked with the CLOCK algorithm: the hand sweeps the slots, a page used since the last sweep gets another
+ * chance, one that wasn't is dropped. Pages mapped by processes, dirty or with IO in flight are skipped
+ * @param count How many pages to free
+ * @return The amount of pages freed
+ */
+uint32_t PageCache::Evict(uint32_t count) {
+
+    uint32_t flags = DisableInterrupts();
+    PageManager* pageManager = PageManager::activePageManager;
+    uint32_t evicted = 0;
+
+    //Two turns, so pages that were only referenced are reached again after their bit was cleared
+    for(int scanned = 0; scanned < 2 * maxPages && evicted < count; ++scanned){
+
+        int16_t slot = clockHand;
+        clockHand = (clockHand + 1) % maxPages;
+
+        CachedPage* page = &pages[slot];
+        if(page -> owner == 0 || page -> io != -1 || (page -> flags & CACHED_PAGE_DIRTY))
+            continue;
+
+        if(pageManager -> FrameReferences(page -> frame) > 1)
+            continue;
+
+        if(page -> flags & CACHED_PAGE_REFERENCED){
+            page -> flags &= ~CACHED_PAGE_REFERENCED;
+            continue;
+        }
+
+        Remove(slot);
+        evicted++;
+    }
+
+    RestoreInterrupts(flags);
+    return evicted;
+}
+
+/**
+ * @details Take a transfer from the pool, interrupts have to be off
+ * @return Its index, -1 if they are all in flight
+ */
+int PageCache::AllocateIO() {
+
+    for(int i = 0; i < maxIO; ++i)
+        if(ios[i].context == 0)
+            return i;
+
+    return -1;
+}
+
+/**
+ * @details Start reading a device page into its frame or writing it back, interrupts have to be off
+ * @param slot The page
+ * @param operation BLOCK_READ or BLOCK_WRITE
+ * @return False if there was no free transfer
+ */
+bool PageCache::StartIO(int16_t slot, BlockOperation operation) {
+
+    int io = AllocateIO();
+    if(io == -1)
+        return false;
+
+    CachedPage* page = &pages[slot];
+    BlockDevice* device = (BlockDevice*)page -> owner;
+
+    //The last page of a device can be partial
+    uint32_t sectorsPerPage = PAGE_SIZE / device -> Limits() -> sectorSize;
+    uint64_t sector = (uint64_t)page -> index * sectorsPerPage;
+    uint32_t count = sectorsPerPage;
+    if(sector + count > device -> Capacity())
+        count = device -> Capacity() - sector;
+
+    if(operation == BLOCK_READ && count < sectorsPerPage)
+        for(uint32_t i = 0; i < PAGE_SIZE; ++i)
+            ((uint8_t*)page -> frame)[i] = 0;
+
+    page -> io = io;
+    ios[io].operation = operation;
+    ios[io].sector = sector;
+    ios[io].count = count;
+    ios[io].buffer = (uint8_t*)page -> frame;
+    ios[io].callback = IODone;
+    ios[io].context = page;
+
+    device -> SubmitIO(&ios[io]);
+    return true;
+}
+
+/**
+ * @details Called when a read or write back of a page completes (usually from an IRQ handler)
+ * @param io The transfer
+ */
+void PageCache::IODone(BlockIO* io) {
+
+    PageCache* cache = activePageCache;
+    CachedPage* page = (CachedPage*)io -> context;
+    io -> context = 0;
+    page -> io = -1;
+
+    if(io -> operation == BLOCK_READ){
+        page -> flags |= io -> result == (int)io -> count ? CACHED_PAGE_UPTODATE : CACHED_PAGE_ERROR;
+        return;
+    }
+
+    //A failed write back is retried next time, unless the page got dirty again in the meantime anyway
+    if(io -> result != (int)io -> count && !(page -> flags & CACHED_PAGE_DIRTY)){
+        page -> flags |= CACHED_PAGE_DIRTY;
+        page -> dirtied = Clock::ReadTimestampCounter();
+        cache -> numDirty++;
+    }
+}
+
+/**
+ * @details Wait for the transfer of a page to complete, other threads run in the meantime
+ * @param slot The page
+ */
+void PageCache::WaitIO(int16_t slot) {
+
+    int io = pages[slot].io;
+    if(io == -1)
+        return;
+
+    ((BlockDevice*)pages[slot].owner) -> Wait(&ios[io]);
+
+}
+
+/**
+ * @details Read ahead of a stream that turned out to be sequential. Pages are read in the background, the block layer merges them into large requests
+ * @param device The device
+ * @param index The first page that is being read
+ * @param count How many pages are being read
+ */
+void PageCache::ReadAhead(BlockDevice* device, uint32_t index, uint32_t count) {
+
+    ReadAheadStream* stream = 0;
+    for(int i = 0; i < maxStreams && stream == 0; ++i)
+        if(streams[i].device == device && streams[i].nextIndex == index)
+            stream = &streams[i];
+
+    //A new stream might be random access, so it only gets read ahead once it continues
+    if(stream == 0){
+        stream = &streams[nextStream];
+        nextStream = (nextStream + 1) % maxStreams;
+
+        stream -> device = device;
+        stream -> window = 0;
+        stream -> ahead = 0;
+    }
+    else
+    {
+        stream -> window = stream -> window == 0 ? minReadAhead : stream -> window * 2;
+        if(stream -> window > maxReadAhead)
+            stream -> window = maxReadAhead;
+    }
+
+    stream -> nextIndex = index + count;
+    if(stream -> window == 0)
+        return;
+
+    uint32_t sectorsPerPage = PAGE_SIZE / device -> Limits() -> sectorSize;
+    uint32_t start = stream -> ahead > index + count ? stream -> ahead : index + count;
+    uint32_t end = index + count + stream -> window;
+
+    for(uint32_t i = start; i < end; ++i){
+
+        if((uint64_t)i * sectorsPerPage >= device -> Capacity())
+            break;
+
+        if(Find(device, i) != -1)
+            continue;
+
+        int16_t slot = Insert(device, i, CACHED_PAGE_DEVICE);
+        if(slot == -1)
+            break;
+
+        if(!StartIO(slot, BLOCK_READ)){
+            Remove(slot);
+            break;
+        }
+
+        readAheads++;
+        stream -> ahead = i + 1;
+    }
+}
+
+/**
+ * @details Read from a block device through the cache
+ * @param device The device
+ * @param offset The byte offset to read from
+ * @param buffer Where to put the data
+ * @param length The amount of bytes
+ * @return The amount of bytes read, -1 if nothing could be read
+ */
+int32_t PageCache::Read(BlockDevice* device, uint64_t offset, uint8_t* buffer, uint32_t length) {
+
+    uint64_t size = device -> Capacity() * device -> Limits() -> sectorSize;
+    if(offset >= size)
+        return -1;
+    if(offset + length > size)
+        length = size - offset;
+    if(length == 0)
+        return 0;
+
+    //Shifts, as 64 bit division needs libgcc
+    uint32_t first = offset >> 12;
+    uint32_t last = (offset + length - 1) >> 12;
+
+    //Start every missing page at once (plugged, so they become one request) and extend the read ahead behind them
+    uint32_t flags = DisableInterrupts();
+    device -> Plug();
+    for(uint32_t index = first; index <= last; ++index){
+
+        if(Find(device, index) != -1){
+            hits++;
+            continue;
+        }
+
+        misses++;
+        int16_t slot = Insert(device, index, CACHED_PAGE_DEVICE);
+        if(slot == -1)
+            break;
+
+        if(!StartIO(slot, BLOCK_READ)){
+            Remove(slot);
+            break;
+        }
+    }
+    ReadAhead(device, first, last - first + 1);
+    device -> Unplug();
+    RestoreInterrupts(flags);
+
+    uint32_t done = 0;
+    while(done < length){
+
+        uint64_t position = offset + done;
+        uint32_t index = position >> 12;
+        uint32_t pageOffset = position & (PAGE_SIZE - 1);
+        uint32_t chunk = PAGE_SIZE - pageOffset;
+        if(chunk > length - done)
+            chunk = length - done;
+
+        flags = DisableInterrupts();
+        int16_t slot = Find(device, index);
+
+        //Evicted again before it was used, or no memory the first time round
+        if(slot == -1){
+            slot = Insert(device, index, CACHED_PAGE_DEVICE);
+            if(slot == -1 || !StartIO(slot, BLOCK_READ)){
+                if(slot != -1)
+                    Remove(slot);
+                RestoreInterrupts(flags);
+                break;
+            }
+        }
+
+        CachedPage* page = &pages[slot];
+        if(page -> io != -1){
+            RestoreInterrupts(flags);
+            WaitIO(slot);
+            continue;
+        }
+
+        //A read that failed is tried again by the next user
+        if(!(page -> flags & CACHED_PAGE_UPTODATE)){
+            Remove(slot);
+            RestoreInterrupts(flags);
+            break;
+        }
+
+        page -> flags |= CACHED_PAGE_REFERENCED;
+        uint8_t* frame = (uint8_t*)page -> frame;
+        for(uint32_t i = 0; i < chunk; ++i)
+            buffer[done + i] = frame[pageOffset + i];
+
+        RestoreInterrupts(flags);
+        done += chunk;
+    }
+
+    return done == 0 ? -1 : (int32_t)done;
+}
+
+/**
+ * @details Write to a block device through the cache, the pages are only marked dirty and written back later (the write back thread or Sync)
+ * @param device The device
+ * @param offset The byte offset to write to
+ * @param buffer The data
+ * @param length The amount of bytes
+ * @return The amount of bytes written, -1 if nothing could be written
+ */
+int32_t PageCache::Write(BlockDevice* device, uint64_t offset, uint8_t* buffer, uint32_t length) {
+
+    uint64_t size = device -> Capacity() * device -> Limits() -> sectorSize;
+    if(offset >= size)
+        return -1;
+    if(offset + length > size)
+        length = size - offset;
+
+    //Don't let dirty pages fill the cache, they can't be evicted
+    if(numDirty > dirtyLimit)
+        Sync(device);
+
+    uint32_t done = 0;
+    while(done < length){
+
+        uint64_t position = offset + done;
+        uint32_t index = position >> 12;
+        uint32_t pageOffset = position & (PAGE_SIZE - 1);
+        uint32_t chunk = PAGE_SIZE - pageOffset;
+        if(chunk > length - done)
+            chunk = length - done;
+
+        uint32_t flags = DisableInterrupts();
+        int16_t slot = Find(device, index);
+
+        if(slot == -1){
+
+            //A whole page is overwritten, otherwise the rest of it has to be read first
+            bool whole = chunk == PAGE_SIZE;
+            slot = Insert(device, index, whole ? CACHED_PAGE_DEVICE | CACHED_PAGE_UPTODATE : CACHED_PAGE_DEVICE);
+            if(slot == -1 || (!whole && !StartIO(slot, BLOCK_READ))){
+                if(slot != -1)
+                    Remove(slot);
+                RestoreInterrupts(flags);
+                break;
+            }
+        }
+
+        //Wait for the read of the rest of the page, or for its write back so the device doesn't get a mix
+        CachedPage* page = &pages[slot];
+        if(page -> io != -1){
+            RestoreInterrupts(flags);
+            WaitIO(slot);
+            continue;
+        }
+
+        if(!(page -> flags & CACHED_PAGE_UPTODATE)){
+            Remove(slot);
+            RestoreInterrupts(flags);
+            break;
+        }
+
+        uint8_t* frame = (uint8_t*)page -> frame;
+        for(uint32_t i = 0; i < chunk; ++i)
+            frame[pageOffset + i] = buffer[done + i];
+
+        page -> flags |= CACHED_PAGE_REFERENCED;
+        if(!(page -> flags & CACHED_PAGE_DIRTY)){
+            page -> flags |= CACHED_PAGE_DIRTY;
+            page -> dirtied = Clock::ReadTimestampCounter();
+            numDirty++;
+        }
+
+        RestoreInterrupts(flags);
+        done += chunk;
+    }
+
+    return done == 0 ? -1 : (int32_t)done;
+}
+
+/**
+ * @details Start writing back the dirty pages of a device, plugged so neighbouring pages become one request
+ * @param device The device
+ * @param all True to write back every dirty page, otherwise only those dirty for longer than dirtyExpire
+ * @return The amount of pages started
+ */
+uint32_t PageCache::WriteBack(BlockDevice* device, bool all) {
+
+    uint32_t flags = DisableInterrupts();
+    uint64_t expired = Clock::ReadTimestampCounter() - MicrosecondsToTicks(dirtyExpire);
+    uint32_t started = 0;
+
+    device -> Plug();
+    for(int16_t slot = 0; slot < maxPages; ++slot){
+
+        CachedPage* page = &pages[slot];
+        if(page -> owner != device || !(page -> flags & CACHED_PAGE_DIRTY) || page -> io != -1)
+            continue;
+
+        if(!all && page -> dirtied > expired)
+            continue;
+
+        //Cleared before the write, a write during it makes the page dirty again
+        page -> flags &= ~CACHED_PAGE_DIRTY;
+        numDirty--;
+        if(!StartIO(slot, BLOCK_WRITE)){
+            page -> flags |= CACHED_PAGE_DIRTY;
+            numDirty++;
+            break;
+        }
+
+        started++;
+    }
+    device -> Unplug();
+
+    writeBacks += started;
+    RestoreInterrupts(flags);
+    return started;
+}
+
+/**
+ * @details Start writing back the pages that have been dirty for too long, on every device
+ * @return The amount of pages started
+ */
+uint32_t PageCache::WriteBackExpired() {
+
+    uint64_t expired = Clock::ReadTimestampCounter() - MicrosecondsToTicks(dirtyExpire);
+    uint32_t started = 0;
+
+    //Each round writes back one device, stop once a round finds nothing (or no transfer was free)
+    while(true){
+
+        BlockDevice* device = 0;
+        uint32_t flags = DisableInterrupts();
+        for(int16_t slot = 0; slot < maxPages && device == 0; ++slot)
+            if((pages[slot].flags & CACHED_PAGE_DIRTY) && pages[slot].io == -1 && pages[slot].dirtied <= expired)
+                device = (BlockDevice*)pages[slot].owner;
+        RestoreInterrupts(flags);
+
+        if(device == 0)
+            break;
+
+        uint32_t count = WriteBack(device, false);
+        if(count == 0)
+            break;
+        started += count;
+    }
+
+    return started;
+}
+
+/**
+ * @details Write every dirty page of a device back, wait for it and flush the device's own cache
+ * @param device The device
+ * @return 0 if everything is on the device, -1 otherwise
+ */
+int32_t PageCache::Sync(BlockDevice* device) {
+
+    //A round writes back at most maxIO pages, and pages that were being written back when this started still need waiting for
+    for(int attempts = 0; attempts < maxPages / maxIO + 4; ++attempts){
+
+        WriteBack(device, true);
+
+        bool pending = false;
+        for(int16_t slot = 0; slot < maxPages; ++slot){
+
+            if(pages[slot].owner != device)
+                continue;
+
+            if(pages[slot].io != -1)
+                WaitIO(slot);
+
+            if(pages[slot].owner == device && (pages[slot].flags & CACHED_PAGE_DIRTY))
+                pending = true;
+        }
+
+        if(!pending)
+            return device -> FlushCache();
+    }
+
+    return -1;
+}
+
+/**
+ * @details Writes back pages once they have been dirty for dirtyExpire, and evicts pages when free frames run low so allocations don't have to
+ */
+void PageCache::WriteBackThread() {
+
+    while(true){
+
+        PageCache* cache = activePageCache;
+        if(cache != 0){
+
+            uint64_t now = Clock::ReadTimestampCounter();
+            if(now >= cache -> nextWriteBack){
+                cache -> nextWriteBack = now + MicrosecondsToTicks(writeBackInterval);
+                cache -> WriteBackExpired();
+            }
+
+            if(PageManager::activePageManager -> FreeFrames() < lowFreeFrames)
+                cache -> Evict();
+        }
+
+        //Nothing to do until the next interrupt
+        asm volatile("hlt");
+    }
+
+}
+
+/**
+ * @details Get how many lookups found the page already in memory
+ * @return The amount of hits
+ */
+uint32_t PageCache::Hits() {
+    return hits;
+}
+
+/**
+ * @details Get how many lookups had to read the page in
+ * @return The amount of misses
+ */
+uint32_t PageCache::Misses() {
+    return misses;
+}
+
+/**
+ * @details Get how many pages were read before they were asked for
+ * @return The amount of pages
+ */
+uint32_t PageCache::ReadAheads() {
+    return readAheads;
+}
+
+/**
+ * @details Get how many dirty pages were written back
+ * @return The amount of pages
+ */
+uint32_t PageCache::WriteBacks() {
+    return writeBacks;
+}
+
+/**
+ * @details Get how many pages are waiting to be written back
+ * @return The amount of pages
+ */
+uint32_t PageCache::DirtyPages() {
+    return numDirty;
+}
@@ -0,0 +1,562 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#include <system/paging.h>
+#include <system/memorymanagement.h>
+
+using namespace maxOS;
+using namespace maxOS::common;
+using namespace maxOS::system;
+
+PageManager* PageManager::activePageManager = 0;
+
+//Bits of 4KB page table entries that have other meanings in 4MB directory entries
+static const uint32_t PAGE_TABLE_PAT = 0x080;               //PAT bit of a 4KB page, PAGE_WRITE_COMBINING is 4MB pages only
+static const uint32_t PAGE_INHERITED = 0x200;               //Available to software: the page got its attributes from a split 4MB page, no one asked for them
+
+/**
+ * @details Zero a 4KB page
+ * @param page The page to zero
+ */
+static void ZeroPage(void* page){
+
+    uint32_t* words = (uint32_t*)page;
+    for(int i = 0; i < 1024; ++i)
+        words[i] = 0;
+
+}
+
+/**
+ * @details Sets up the frame pool and the kernel address space, then turns on paging
+ * @param poolSize How many bytes of the heap to hand out as physical frames
+ */
+PageManager::PageManager(size_t poolSize) {
+
+    activePageManager = this;
+
+    //Carve the frame pool out of the heap (4KB aligned)
+    uint32_t pool = (uint32_t)MemoryManager::activeMemoryManager -> malloc(poolSize + PAGE_SIZE);
+    poolStart = (pool + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1);
+    poolFrames = pool == 0 ? 0 : poolSize / PAGE_SIZE;
+
+    freeFrames = 0;
+    numFreeFrames = 0;
+    frameReferences = (uint16_t*)MemoryManager::activeMemoryManager -> malloc(poolFrames * sizeof(uint16_t));
+    for(uint32_t i = 0; i < poolFrames; ++i)
+        frameReferences[i] = 0;
+    for(uint32_t i = poolFrames; i > 0; --i)
+        FreeFrame((void*)(poolStart + (i - 1) * PAGE_SIZE));
+
+    //The kernel is identity mapped with 4MB pages, this is shared by every address space. The device window starts empty
+    kernelDirectory = (PageDirectory*)AllocateFrame();
+    ZeroPage(kernelDirectory);
+    for(uint32_t i = 0; i < (DEVICE_WINDOW_START >> 22); ++i)
+        (*kernelDirectory)[i] = (i << 22) | PAGE_PRESENT | PAGE_WRITABLE | PAGE_HUGE;
+    deviceWindowNext = DEVICE_WINDOW_START;
+
+    //The kernel stacks have their own page tables, made now so every address space shares them
+    for(uint32_t i = (KERNEL_STACKS_START >> 22); i < (KERNEL_IDENTITY_END >> 22); ++i){
+        void* table = AllocateFrame();
+        ZeroPage(table);
+        (*kernelDirectory)[i] = (uint32_t)table | PAGE_PRESENT | PAGE_WRITABLE;
+    }
+
+    currentDirectory = kernelDirectory;
+    for(int i = 0; i < maxAddressSpaces; ++i)
+        addressSpaces[i] = 0;
+
+    //CPUID leaf 1 EDX bit 16 says if there is a PAT. Entries 0-3 keep their power on meaning (so PWT and PCD work as usual), entry 4 becomes write-combining
+    uint32_t eax, ebx, ecx, edx;
+    asm volatile("cpuid" : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx) : "a"(1));
+    writeCombining = edx & (1 << 16);
+    if(writeCombining){
+
+        uint32_t low, high;
+        asm volatile("rdmsr" : "=a"(low), "=d"(high) : "c"(0x277));
+        high = (high & ~0xFF) | 0x01;
+        asm volatile("wrmsr" : : "a"(low), "d"(high), "c"(0x277));
+    }
+
+    asm volatile(
+            "mov %%cr4, %%eax\n"
+            "or $0x10, %%eax\n"             //PSE: allow 4MB pages
+            "mov %%eax, %%cr4\n"
+            "mov %0, %%cr3\n"
+            "mov %%cr0, %%eax\n"
+            "or $0x80010000, %%eax\n"       //PG: enable paging, WP: the kernel also respects read only pages (needed for copy on write)
+            "mov %%eax, %%cr0\n"
+            : : "r"(kernelDirectory) : "eax", "memory");
+
+}
+
+PageManager::~PageManager() {
+
+    if(activePageManager == this)
+        activePageManager = 0;
+
+}
+
+/**
+ * @details Allocate a physical frame
+ * @return The frame (identity mapped so it can be used directly), 0 if there are none left
+ */
+void* PageManager::AllocateFrame() {
+
+    if(freeFrames == 0)
+        return 0;
+
+    uint32_t* frame = freeFrames;
+    freeFrames = (uint32_t*)frame[0];
+    numFreeFrames--;
+    frameReferences[((uint32_t)frame - poolStart) / PAGE_SIZE] = 1;
+    return frame;
+
+}
+
+/**
+ * @details Drop a reference to a frame, it goes back to the pool once nothing uses it. Frames that aren't from the pool (e.g. kernel pages mapped to users) are ignored
+ * @param frame The frame to free
+ */
+void PageManager::FreeFrame(void* frame) {
+
+    uint32_t address = (uint32_t)frame;
+    if(address < poolStart || address >= poolStart + poolFrames * PAGE_SIZE)
+        return;
+
+    uint16_t* references = &frameReferences[(address - poolStart) / PAGE_SIZE];
+    if(*references > 1){
+        (*references)--;
+        return;
+    }
+
+    *references = 0;
+    ((uint32_t*)frame)[0] = (uint32_t)freeFrames;
+    freeFrames = (uint32_t*)frame;
+    numFreeFrames++;
+
+}
+
+/**
+ * @details Add a reference to a frame, used when the same frame is mapped more than once
+ * @param frame The frame to share
+ */
+void PageManager::ShareFrame(void* frame) {
+
+    uint32_t address = (uint32_t)frame;
+    if(address < poolStart || address >= poolStart + poolFrames * PAGE_SIZE)
+        return;
+
+    frameReferences[(address - poolStart) / PAGE_SIZE]++;
+
+}
+
+/**
+ * @details Get how many users a frame has
+ * @param frame The frame
+ * @return The amount of references, 0 for free frames and frames that aren't from the pool
+ */
+uint32_t PageManager::FrameReferences(void* frame) {
+
+    uint32_t address = (uint32_t)frame;
+    if(address < poolStart || address >= poolStart + poolFrames * PAGE_SIZE)
+        return 0;
+
+    return frameReferences[(address - poolStart) / PAGE_SIZE];
+}
+
+/**
+ * @details Get the amount of free frames
+ * @return The amount of free frames
+ */
+uint32_t PageManager::FreeFrames() {
+    return numFreeFrames;
+}
+
+/**
+ * @details Get the kernel address space
+ * @return The kernel page directory
+ */
+PageDirectory* PageManager::KernelAddressSpace() {
+    return kernelDirectory;
+}
+
+/**
+ * @details Get the address space that is loaded
+ * @return The current page directory
+ */
+PageDirectory* PageManager::CurrentAddressSpace() {
+    return currentDirectory;
+}
+
+/**
+ * @details Create a new address space, the kernel is mapped in it but user space is empty
+ * @return The page directory, 0 if out of memory
+ */
+PageDirectory* PageManager::CreateAddressSpace() {
+
+    PageDirectory* directory = (PageDirectory*)AllocateFrame();
+    if(directory == 0)
+        return 0;
+
+    int slot = 0;
+    while(slot < maxAddressSpaces && addressSpaces[slot] != 0)
+        slot++;
+
+    if(slot == maxAddressSpaces){
+        FreeFrame(directory);
+        return 0;
+    }
+
+    for(uint32_t i = 0; i < 1024; ++i){
+        bool user = i >= (USER_SPACE_START >> 22) && i < (USER_SPACE_END >> 22);
+        (*directory)[i] = user ? 0 : (*kernelDirectory)[i];
+    }
+
+    addressSpaces[slot] = directory;
+    return directory;
+}
+
+/**
+ * @details Free an address space and every user page in it
+ * @param directory The page directory to free
+ */
+void PageManager::DestroyAddressSpace(PageDirectory* directory) {
+
+    if(directory == kernelDirectory)
+        return;
+
+    if(directory == currentDirectory)
+        SwitchAddressSpace(kernelDirectory);
+
+    for(int i = 0; i < maxAddressSpaces; ++i)
+        if(addressSpaces[i] == directory)
+            addressSpaces[i] = 0;
+
+    for(uint32_t i = (USER_SPACE_START >> 22); i < (USER_SPACE_END >> 22); ++i){
+
+        if(!((*directory)[i] & PAGE_PRESENT))
+            continue;
+
+        uint32_t* table = (uint32_t*)((*directory)[i] & ~0xFFF);
+        for(int j = 0; j < 1024; ++j)
+            if(table[j] & PAGE_PRESENT)
+                FreeFrame((void*)(table[j] & ~0xFFF));
+
+        FreeFrame(table);
+    }
+
+    FreeFrame(directory);
+}
+
+/**
+ * @details Load an address space into the CPU
+ * @param directory The page directory to use
+ */
+void PageManager::SwitchAddressSpace(PageDirectory* directory) {
+
+    if(directory == currentDirectory)                       //Reloading CR3 flushes the TLB, avoid it when possible
+        return;
+
+    currentDirectory = directory;
+    asm volatile("mov %0, %%cr3" : : "r"(directory) : "memory");
+
+}
+
+/**
+ * @details Find the page table entry of a virtual address
+ * @param directory The page directory to look in
+ * @param virtualAddress The virtual address
+ * @param create Whether to create the page table if it doesn't exist
+ * @return The page table entry, 0 if there isn't one
+ */
+uint32_t* PageManager::GetPageTableEntry(PageDirectory* directory, uint32_t virtualAddress, bool create) {
+
+    uint32_t* directoryEntry = &(*directory)[virtualAddress >> 22];
+
+    if((*directoryEntry & PAGE_PRESENT) && (*directoryEntry & PAGE_HUGE))
+        return 0;                                           //Kernel 4MB pages have no page table
+
+    if(!(*directoryEntry & PAGE_PRESENT)){
+
+        if(!create)
+            return 0;
+
+        void* table = AllocateFrame();
+        if(table == 0)
+            return 0;
+
+        ZeroPage(table);
+        *directoryEntry = (uint32_t)table | PAGE_PRESENT | PAGE_WRITABLE | PAGE_USER;      //Permissions are decided by the page table entries
+    }
+
+    uint32_t* table = (uint32_t*)(*directoryEntry & ~0xFFF);
+    return &table[(virtualAddress >> 12) & 0x3FF];
+}
+
+/**
+ * @details Map a page
+ * @param directory The page directory to map it in
+ * @param virtualAddress The virtual address of the page
+ * @param physicalAddress The physical address of the page
+ * @param flags The PageFlags to map it with
+ * @return True if it was mapped, false if out of memory
+ */
+bool PageManager::Map(PageDirectory* directory, uint32_t virtualAddress, uint32_t physicalAddress, uint32_t flags) {
+
+    uint32_t* entry = GetPageTableEntry(directory, virtualAddress, true);
+    if(entry == 0)
+        return false;
+
+    *entry = (physicalAddress & ~0xFFF) | (flags & 0xFFF) | PAGE_PRESENT;
+
+    if(directory == currentDirectory)
+        FlushPage(virtualAddress);
+
+    return true;
+}
+
+/**
+ * @details Unmap a page (the frame is not freed)
+ * @param directory The page directory to unmap it from
+ * @param virtualAddress The virtual address of the page
+ */
+void PageManager::Unmap(PageDirectory* directory, uint32_t virtualAddress) {
+
+    uint32_t* entry = GetPageTableEntry(directory, virtualAddress, false);
+    if(entry == 0)
+        return;
+
+    *entry = 0;
+
+    if(directory == currentDirectory)
+        FlushPage(virtualAddress);
+
+}
+
+/**
+ * @details Look up the mapping of a virtual address
+ * @param directory The page directory to look in
+ * @param virtualAddress The virtual address
+ * @return The page table entry (physical address and flags), 0 if not mapped
+ */
+uint32_t PageManager::Lookup(PageDirectory* directory, uint32_t virtualAddress) {
+
+    uint32_t* entry = GetPageTableEntry(directory, virtualAddress, false);
+    return entry == 0 ? 0 : *entry;
+
+}
+
+/**
+ * @details Find the physical memory behind an address, for devices that access memory themselves (DMA)
+ * @param virtualAddress The address in the kernel or a process's address space
+ * @param write True if the device will write to it, copy on write pages can't be used for that
+ * @param directory The address space of user addresses, 0 for the current one
+ * @return The physical address, 0 if it isn't backed by memory a device can use
+ */
+uint32_t PageManager::PhysicalAddress(uint32_t virtualAddress, bool write, PageDirectory* directory) {
+
+    if(virtualAddress < DEVICE_WINDOW_START)
+        return virtualAddress;
+
+    if(virtualAddress >= KERNEL_STACKS_START && virtualAddress < KERNEL_IDENTITY_END)
+        directory = kernelDirectory;
+    else if(virtualAddress < USER_SPACE_START || virtualAddress >= USER_SPACE_END)
+        return 0;
+
+    uint32_t entry = Lookup(directory == 0 ? currentDirectory : directory, virtualAddress);
+    if(!(entry & PAGE_PRESENT) || (write && !(entry & PAGE_WRITABLE)))
+        return 0;
+
+    return (entry & ~(PAGE_SIZE - 1)) | (virtualAddress & (PAGE_SIZE - 1));
+}
+
+/**
+ * @details Get the kernel stack of a thread slot, it is mapped the first time and then kept for whatever thread uses the slot next (a
+ * thread can be terminated while it is still running on its stack)
+ * @param slot The thread slot
+ * @return The top of the stack, 0 if out of memory
+ */
+void* PageManager::AllocateKernelStack(int slot) {
+
+    uint32_t top = KERNEL_STACKS_START + (slot + 1) * KERNEL_STACK_SLOT;
+    if(slot < 0 || top > KERNEL_IDENTITY_END)
+        return 0;
+
+    for(uint32_t page = top - KERNEL_STACK_SIZE; page < top; page += PAGE_SIZE){
+
+        if(Lookup(kernelDirectory, page) & PAGE_PRESENT)
+            continue;
+
+        void* frame = AllocateFrame();
+        if(frame == 0 || !Map(kernelDirectory, page, (uint32_t)frame, PAGE_WRITABLE)){
+            FreeFrame(frame);
+            return 0;
+        }
+        FlushPage(page);                                    //The table is shared, whichever directory is loaded
+    }
+
+    return (void*)top;
+}
+
+/**
+ * @details Set a kernel page directory entry, in the kernel directory and every address space
+ * @param index The page directory entry
+ * @param entry The value
+ */
+void PageManager::SetKernelEntry(uint32_t index, uint32_t entry) {
+
+    if((*kernelDirectory)[index] == entry)
+        return;
+
+    (*kernelDirectory)[index] = entry;
+    for(int i = 0; i < maxAddressSpaces; ++i)
+        if(addressSpaces[i] != 0)
+            (*addressSpaces[i])[index] = entry;
+    FlushPage(index << 22);
+
+}
+
+/**
+ * @details Turn a kernel 4MB page into a page table of 4KB pages with the same attributes, so part of it can be mapped differently
+ * @param index The page directory entry
+ * @return True if the entry is a page table now
+ */
+bool PageManager::SplitKernelEntry(uint32_t index) {
+
+    uint32_t entry = (*kernelDirectory)[index];
+    if(!(entry & PAGE_HUGE))
+        return true;
+
+    uint32_t* table = (uint32_t*)AllocateFrame();
+    if(table == 0)
+        return false;
+
+    uint32_t flags = PAGE_PRESENT | PAGE_INHERITED | (entry & (PAGE_WRITABLE | PAGE_WRITE_THROUGH | PAGE_CACHE_DISABLE));
+    if(entry & PAGE_WRITE_COMBINING)
+        flags |= PAGE_TABLE_PAT;
+
+    for(uint32_t i = 0; i < 1024; ++i)
+        table[i] = ((entry & 0xFFC00000) + i * PAGE_SIZE) | flags;
+
+    SetKernelEntry(index, (uint32_t)table | PAGE_PRESENT | PAGE_WRITABLE);
+    return true;
+}
+
+/**
+ * @details Identity map physical memory in the kernel part of the address space. 4MB pages are used where possible, a 4MB page that is
+ * already mapped with other cache attributes is split so only the requested pages change
+ * @param physicalAddress The first physical address
+ * @param last The last physical address
+ * @param flags The 4MB page entry flags
+ * @return False if some of the memory was already mapped with other attributes (or out of memory)
+ */
+bool PageManager::MapKernelPages(uint32_t physicalAddress, uint32_t last, uint32_t flags) {
+
+    uint32_t pageFlags = PAGE_PRESENT | (flags & (PAGE_WRITABLE | PAGE_WRITE_THROUGH | PAGE_CACHE_DISABLE));
+    if(flags & PAGE_WRITE_COMBINING)
+        pageFlags |= PAGE_TABLE_PAT;
+
+    for(uint32_t i = physicalAddress >> 22; i <= (last >> 22); ++i){
+
+        uint32_t entry = (*kernelDirectory)[i];
+        if(!(entry & PAGE_PRESENT)){
+            SetKernelEntry(i, (i << 22) | flags);
+            continue;
+        }
+
+        if(entry == ((i << 22) | flags))
+            continue;
+
+        if(!SplitKernelEntry(i))
+            return false;
+
+        //Only the pages that were asked for, the rest keep what they had
+        uint32_t* table = (uint32_t*)((*kernelDirectory)[i] & ~0xFFF);
+        uint32_t first = (i == (physicalAddress >> 22)) ? (physicalAddress >> 12) & 0x3FF : 0;
+        uint32_t end = (i == (last >> 22)) ? (last >> 12) & 0x3FF : 1023;
+        for(uint32_t page = first; page <= end; ++page){
+
+            uint32_t wanted = ((i << 22) + page * PAGE_SIZE) | pageFlags;
+            if(!(table[page] & PAGE_INHERITED) && table[page] != wanted)
+                return false;
+
+            table[page] = wanted;
+            FlushPage((i << 22) + page * PAGE_SIZE);
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @details Map physical memory that can't be identity mapped into the device window, mapping the same memory again reuses the pages
+ * @param physicalAddress The first physical address
+ * @param last The last physical address
+ * @param flags The 4MB page entry flags
+ * @return The address to access the memory at, 0 if the window is full
+ */
+void* PageManager::MapDeviceWindow(uint32_t physicalAddress, uint32_t last, uint32_t flags) {
+
+    uint32_t numPages = (last >> 22) - (physicalAddress >> 22) + 1;
+    uint32_t first = DEVICE_WINDOW_START >> 22;
+    uint32_t used = (deviceWindowNext - DEVICE_WINDOW_START) >> 22;
+
+    //Look for a run of pages that already maps it
+    for(uint32_t i = first; i + numPages <= first + used; ++i){
+
+        uint32_t page = 0;
+        while(page < numPages && (*kernelDirectory)[i + page] == ((((physicalAddress >> 22) + page) << 22) | flags))
+            page++;
+
+        if(page == numPages)
+            return (void*)((i << 22) | (physicalAddress & 0x3FFFFF));
+    }
+
+    if(numPages > ((DEVICE_WINDOW_END - deviceWindowNext) >> 22))
+        return 0;
+
+    uint32_t virtualAddress = deviceWindowNext;
+    for(uint32_t page = 0; page < numPages; ++page)
+        SetKernelEntry((virtualAddress >> 22) + page, ((physicalAddress >> 22) + page) << 22 | flags);
+
+    deviceWindowNext += numPages << 22;
+    return (void*)(virtualAddress | (physicalAddress & 0x3FFFFF));
+}
+
+/**
+ * @details Make physical memory above the identity mapped area (e.g. device registers) visible to the kernel. Memory in the kernel part of the address space is identity mapped with 4MB pages (4KB pages where the cache attributes of a 4MB page would differ), memory where user space is goes into the device window
+ * @param physicalAddress The first physical address
+ * @param size The amount of bytes
+ * @param flags Extra PageFlags, PAGE_CACHE_DISABLE for device registers, PAGE_WRITE_COMBINING for prefetchable device memory (e.g. framebuffers, uncached if there is no PAT)
+ * @return The address to access the memory at, 0 if it can't be mapped
+ */
+void* PageManager::MapPhysicalMemory(uint32_t physicalAddress, uint32_t size, uint32_t flags) {
+
+    //Already visible, unless it needs other cache attributes than the identity mapping has
+    bool identity = physicalAddress + size <= DEVICE_WINDOW_START && physicalAddress + size >= physicalAddress;
+    if(identity && !(flags & (PAGE_WRITE_THROUGH | PAGE_CACHE_DISABLE | PAGE_WRITE_COMBINING)))
+        return (void*)physicalAddress;
+
+    uint32_t last = (size == 0 ? physicalAddress : physicalAddress + size - 1);
+    if(last < physicalAddress)
+        last = 0xFFFFFFFF;
+
+    uint32_t entryFlags = PAGE_PRESENT | PAGE_WRITABLE | PAGE_HUGE | (flags & (PAGE_WRITE_THROUGH | PAGE_CACHE_DISABLE));
+    if(flags & PAGE_WRITE_COMBINING)
+        entryFlags = writeCombining ? PAGE_PRESENT | PAGE_WRITABLE | PAGE_HUGE | PAGE_WRITE_COMBINING : entryFlags | PAGE_CACHE_DISABLE;
+
+    //User space can't be taken over by the kernel
+    if(!identity && physicalAddress < USER_SPACE_END)
+        return last < USER_SPACE_END ? MapDeviceWindow(physicalAddress, last, entryFlags) : 0;
+
+    return MapKernelPages(physicalAddress, last, entryFlags) ? (void*)physicalAddress : 0;
+}
+
+/**
+ * @details Check if PAGE_WRITE_COMBINING really gives write-combining memory
+ * @return True if the CPU has a PAT
+ */
+bool PageManager::SupportsWriteCombining() {
+    return writeCombining;
+}
@@ -3,9 +3,20 @@
 //
 
 #include <system/process.h>
+#include <system/vdso.h>
+#include <system/pagecache.h>
+#include <system/trace.h>
+#include <system/iouring.h>
 
 using namespace maxOS;
+using namespace maxOS::common;
 using namespace maxOS::system;
+using namespace maxOS::hardwarecommunication;
+
+void printf(char* str, bool clearLine = false); //Forward declaration
+void printfHex(uint8_t key);                    //Forward declaration
+
+pid_t Process::nextPID = 1;                                 //0 is the kernel
 
 
 Process::Process(void entrypoint(), ThreadManager* threadManager) {
@@ -13,23 +24,72 @@ Process::Process(void entrypoint(), ThreadManager* threadManager) {
 
     //Create main thread
     this -> threadManager = threadManager;
+    this -> pid = nextPID++;
+    this -> addressSpace = 0;
 
 
 
 
-    mainThreadID = threadManager -> CreateThread(entrypoint);
+    mainThreadID = threadManager -> CreateThread(entrypoint, pid);
 
     //Clear child threads
     for (int i = 0; i < 6; ++i) {
         childThreads[i] = -1;
     }
 
+    if(ProcessManager::activeProcessManager != 0)
+        ProcessManager::activeProcessManager -> AddProcess(this);
+
+}
+
+/**
+ * @details Create a user process with its own address space, the executable is mapped in lazily as it is used
+ * @param executable The executable to run
+ * @param threadManager The thread manager to run it on
+ */
+Process::Process(ElfLoader* executable, ThreadManager* threadManager) {
+
+    this -> threadManager = threadManager;
+    this -> pid = nextPID++;
+    this -> mainThreadID = -1;
+
+    for (int i = 0; i < 6; ++i) {
+        childThreads[i] = -1;
+    }
+
+    //Everything but the kernel is empty until the process faults on it
+    PageManager* pageManager = PageManager::activePageManager;
+    addressSpace = pageManager -> CreateAddressSpace();
+    if(addressSpace == 0)
+        return;
+
+    if(!executable -> Load(this))
+        return;
+
+    if(!AddRegion(USER_STACK_TOP - USER_STACK_SIZE, USER_STACK_SIZE, true, 0, 0))
+        return;
+
+    //The vDSO page is shared read only by every process
+    if(!pageManager -> Map(addressSpace, USER_VDSO_ADDRESS, (uint32_t)VirtualDynamicSharedObject::Page(), PAGE_USER))
+        return;
+
+    mainThreadID = threadManager -> CreateUserThread(executable -> EntryPoint(), USER_STACK_TOP, pid, addressSpace);
+
+    if(ProcessManager::activeProcessManager != 0)
+        ProcessManager::activeProcessManager -> AddProcess(this);
+
 }
 
 Process::~Process() {
 
     Kill();
+    IORing::Release(pid);
+
+    if(addressSpace != 0)
+        PageManager::activePageManager -> DestroyAddressSpace(addressSpace);
 
+    if(ProcessManager::activeProcessManager != 0)
+        ProcessManager::activeProcessManager -> RemoveProcess(this);
 
 }
 
@@ -49,7 +109,7 @@ void Process::CreateChildThread(void (*entrypoint)()) {
     if(numChildThreads < 6){                                                                            //If there is space for a new thread
         for (int i = 0; i < 6; ++i) {                                                                   //Loop through child threads
             if(childThreads[numChildThreads] == -1){                                                    //If the thread is empty
-                childThreads[numChildThreads] = threadManager -> CreateThread(entrypoint);                 //Create a new thread
+                childThreads[numChildThreads] = threadManager -> CreateThread(entrypoint, pid);            //Create a new thread
                 numChildThreads++;                                                                      //Increase the number of child threads
                 break;
             }
@@ -125,3 +185,379 @@ void Process::Kill() {
     threadManager -> TerminateThread(mainThreadID);
 }
 
+/**
+ * @breif Get the ID of the process
+ * @return The process ID
+ */
+pid_t Process::GetPID() {
+    return pid;
+}
+
+/**
+ * @details Get the address space of the process
+ * @return The page directory, 0 for kernel processes
+ */
+PageDirectory* Process::AddressSpace() {
+    return addressSpace;
+}
+
+/**
+ * @details Reserve a range of user memory, nothing is mapped until the process touches it
+ * @param start The first address of the region
+ * @param size The size of the region in bytes
+ * @param writable Whether the process can write to the region
+ * @param file The file to fill the region from (0 for zeroed memory)
+ * @param fileSize The size of the file
+ * @param offset Where the region's data starts in the file
+ * @param sourceSize The amount of bytes to take from the file, the rest is zeroed
+ * @return True if the region was added
+ */
+bool Process::AddRegion(uint32_t start, uint32_t size, bool writable, uint8_t* file, uint32_t fileSize, uint32_t offset, uint32_t sourceSize) {
+
+    if(numRegions >= 8 || start < USER_SPACE_START || start + size > USER_SPACE_END || start + size < start)
+        return false;
+
+    regions[numRegions].start = start;
+    regions[numRegions].end = start + size;
+    regions[numRegions].writable = writable;
+    regions[numRegions].file = file;
+    regions[numRegions].fileSize = fileSize;
+    regions[numRegions].offset = offset;
+    regions[numRegions].sourceSize = sourceSize;
+    numRegions++;
+
+    return true;
+}
+
+/**
+ * @details Check that a buffer the process gave the kernel is its own memory, so the kernel can't be made to read or write anything else
+ * through it. Pages of the regions that aren't mapped yet are fine, touching them faults them in like it would for the process
+ * @param address The start of the buffer
+ * @param length The size of the buffer in bytes
+ * @param write Whether the kernel will write to the buffer
+ * @return True if the whole buffer is in the process's regions (always for kernel processes)
+ */
+bool Process::IsUserMemory(uint32_t address, uint32_t length, bool write) {
+
+    if(addressSpace == 0)
+        return true;
+
+    uint32_t end = address + length;
+    if(end < address || address < USER_SPACE_START || end > USER_SPACE_END)
+        return false;
+
+    //Walk the regions the buffer covers, it can span ones that are next to each other
+    while(address < end){
+
+        MemoryRegion* region = 0;
+        for(int i = 0; i < numRegions; ++i)
+            if(address >= regions[i].start && address < regions[i].end)
+                region = &regions[i];
+
+        if(region == 0 || (write && !region -> writable))
+            return false;
+
+        address = region -> end;
+    }
+
+    return true;
+}
+
+/**
+ * @details Make sure the pages of a buffer are mapped the way the kernel is going to use them, for when the kernel touches the buffer while
+ * another thread is running (so a fault on it wouldn't be blamed on this process)
+ * @param address The start of the buffer
+ * @param length The size of the buffer in bytes
+ * @param write Whether the kernel will write to the buffer, shared pages get their private copy now
+ * @return True if the buffer is the process's memory and all of it is mapped
+ */
+bool Process::FaultIn(uint32_t address, uint32_t length, bool write) {
+
+    if(addressSpace == 0)
+        return true;
+
+    if(!IsUserMemory(address, length, write))
+        return false;
+
+    PageManager* pageManager = PageManager::activePageManager;
+    for(uint32_t page = address & ~(PAGE_SIZE - 1); page < address + length; page += PAGE_SIZE){
+
+        uint32_t entry = pageManager -> Lookup(addressSpace, page);
+        bool present = (entry & PAGE_PRESENT) != 0;
+        if(present && (!write || (entry & PAGE_WRITABLE)))
+            continue;
+
+        if(!HandlePageFault(page, (present ? 0x1 : 0) | (write ? 0x2 : 0)))
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * @details Allocate a frame for a process, dropping unused cached pages if memory has run out
+ * @return The frame, 0 if out of memory
+ */
+static uint8_t* AllocateProcessFrame(){
+
+    uint8_t* frame = (uint8_t*)PageManager::activePageManager -> AllocateFrame();
+    if(frame == 0 && PageCache::activePageCache != 0 && PageCache::activePageCache -> Evict() != 0)
+        frame = (uint8_t*)PageManager::activePageManager -> AllocateFrame();
+
+    return frame;
+}
+
+/**
+ * @details Check if a page of a region can be mapped straight from the page cache: it has to line up with a page of the file and can't contain any of the zeroed part of the region
+ * @param region The region
+ * @param page The page aligned address
+ * @return True if the page can be shared
+ */
+static bool IsShareable(MemoryRegion* region, uint32_t page){
+
+    if(region -> file == 0 || PageCache::activePageCache == 0)
+        return false;
+
+    if((region -> start - region -> offset) & (PAGE_SIZE - 1))
+        return false;
+
+    return page + PAGE_SIZE <= region -> start + region -> sourceSize || region -> sourceSize == region -> end - region -> start;
+}
+
+/**
+ * @details Map the page a fault happened on if it belongs to one of the process's regions. File pages are mapped read only from the page cache, writes to them get a private copy
+ * @param address The address that faulted (CR2)
+ * @param error The page fault error code
+ * @return True if the page was mapped and the process can continue
+ */
+bool Process::HandlePageFault(uint32_t address, uint32_t error) {
+
+    if(addressSpace == 0)
+        return false;
+
+    MemoryRegion* region = 0;
+    for(int i = 0; i < numRegions; ++i)
+        if(address >= regions[i].start && address < regions[i].end)
+            region = &regions[i];
+
+    bool write = (error & 0x2) != 0;
+    if(region == 0 || (write && !region -> writable))
+        return false;
+
+    PageManager* pageManager = PageManager::activePageManager;
+    uint32_t page = address & ~(PAGE_SIZE - 1);
+
+    //Present pages only fault because of their protection, the only fixable case is a write to a shared page (copy on write)
+    if(error & 0x1){
+
+        uint32_t entry = pageManager -> Lookup(addressSpace, page);
+        if(!write || !(entry & PAGE_PRESENT))
+            return false;
+
+        uint8_t* shared = (uint8_t*)(entry & ~(PAGE_SIZE - 1));
+
+        //Nobody else uses it anymore (the cache dropped it), so it can just be made writable
+        if(pageManager -> FrameReferences(shared) == 1)
+            return pageManager -> Map(addressSpace, page, (uint32_t)shared, PAGE_USER | PAGE_WRITABLE);
+
+        uint8_t* frame = AllocateProcessFrame();
+        if(frame == 0)
+            return false;
+
+        for(uint32_t i = 0; i < PAGE_SIZE; ++i)
+            frame[i] = shared[i];
+
+        if(!pageManager -> Map(addressSpace, page, (uint32_t)frame, PAGE_USER | PAGE_WRITABLE)){
+            pageManager -> FreeFrame(frame);
+            return false;
+        }
+
+        pageManager -> FreeFrame(shared);                     //Drop this process's reference
+        return true;
+    }
+
+    //Reads of file pages share the cached copy, it stays read only even in writable regions until the first write
+    if(!write && IsShareable(region, page)){
+
+        void* cached = PageCache::activePageCache -> GetPage(region -> file, region -> fileSize, region -> offset + page - region -> start);
+        if(cached != 0){
+
+            pageManager -> ShareFrame(cached);
+            if(pageManager -> Map(addressSpace, page, (uint32_t)cached, PAGE_USER))
+                return true;
+
+            pageManager -> FreeFrame(cached);
+            return false;
+        }
+    }
+
+    uint8_t* frame = AllocateProcessFrame();
+    if(frame == 0)
+        return false;
+
+    //Copy in the part of the file that overlaps this page, everything else is zero
+    for(uint32_t i = 0; i < PAGE_SIZE; ++i){
+        uint32_t offset = page + i - region -> start;
+        bool inSource = region -> file != 0 && page + i >= region -> start && offset < region -> sourceSize;
+        frame[i] = inSource ? region -> file[region -> offset + offset] : 0;
+    }
+
+    if(!pageManager -> Map(addressSpace, page, (uint32_t)frame, PAGE_USER | (region -> writable ? PAGE_WRITABLE : 0))){
+        pageManager -> FreeFrame(frame);
+        return false;
+    }
+
+    return true;
+}
+
+///__Manager__///
+
+ProcessManager* ProcessManager::activeProcessManager = 0;
+
+/**
+ * @details Keeps track of the processes and handles their page faults
+ * @param interruptManager The interrupt manager to receive page faults from
+ * @param threadManager The thread manager that runs the processes
+ */
+ProcessManager::ProcessManager(InterruptManager* interruptManager, ThreadManager* threadManager)
+: InterruptHandler(0x0E, interruptManager)
+{
+
+    this -> threadManager = threadManager;
+    for(int i = 0; i < maxProcesses; ++i)
+        processes[i] = 0;
+
+    activeProcessManager = this;
+
+}
+
+ProcessManager::~ProcessManager() {
+
+    if(activeProcessManager == this)
+        activeProcessManager = 0;
+
+}
+
+/**
+ * @details Start tracking a process
+ * @param process The process
+ * @return True if there was space for it
+ */
+bool ProcessManager::AddProcess(Process* process) {
+
+    for(int i = 0; i < maxProcesses; ++i){
+        if(processes[i] == 0){
+            processes[i] = process;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @details Stop tracking a process
+ * @param process The process
+ */
+void ProcessManager::RemoveProcess(Process* process) {
+
+    for(int i = 0; i < maxProcesses; ++i)
+        if(processes[i] == process)
+            processes[i] = 0;
+
+}
+
+/**
+ * @details Find a process
+ * @param pid The ID of the process
+ * @return The process, 0 if there isn't one
+ */
+Process* ProcessManager::GetProcess(pid_t pid) {
+
+    for(int i = 0; i < maxProcesses; ++i)
+        if(processes[i] != 0 && processes[i] -> pid == pid)
+            return processes[i];
+
+    return 0;
+}
+
+/**
+ * @details Get the process that is running
+ * @return The process, 0 if the kernel is running
+ */
+Process* ProcessManager::CurrentProcess() {
+    return GetProcess(threadManager -> CurrentPID());
+}
+
+/**
+ * @details Start a user process from an ELF executable
+ * @param image The executable, this must stay in memory for the life of the process
+ * @param size The size of the executable
+ * @return The process, 0 if it could not be started
+ */
+Process* ProcessManager::Spawn(uint8_t* image, uint32_t size) {
+
+    ElfLoader executable(image, size);
+    if(!executable.IsValid())
+        return 0;
+
+    Process* process = new Process(&executable, threadManager);
+    if(process -> mainThreadID < 0){
+        delete process;
+        return 0;
+    }
+
+    return process;
+}
+
+/**
+ * @details End the running user process (the exit syscall or a fatal fault)
+ * @param esp The stack frame
+ * @return The stack frame of the next thread to run
+ */
+uint32_t ProcessManager::Exit(uint32_t esp) {
+
+    Process* process = CurrentProcess();
+    if(process == 0 || process -> addressSpace == 0)
+        return esp;
+
+    delete process;
+    return (uint32_t)threadManager -> Schedule((CPUState_Thread*)esp);
+}
+
+/**
+ * @details Handle a page fault by mapping in the page, or by killing the process if the access isn't allowed
+ * @param esp The stack frame
+ * @return The stack frame to return to
+ */
+uint32_t ProcessManager::HandleInterrupt(uint32_t esp) {
+
+    CPUState_Thread* cpu = (CPUState_Thread*)esp;
+
+    uint32_t address;
+    asm volatile("mov %%cr2, %0" : "=r"(address));
+    Tracer::Trace(TRACE_PAGE_FAULT, address, cpu -> error);
+
+    Process* process = CurrentProcess();
+    if(process != 0 && process -> HandlePageFault(address, cpu -> error))
+        return esp;
+
+    printf("\nPAGE FAULT at 0x");
+    printfHex((address >> 24) & 0xFF);
+    printfHex((address >> 16) & 0xFF);
+    printfHex((address >> 8 ) & 0xFF);
+    printfHex((address      ) & 0xFF);
+
+    //A user process can just be killed
+    if((cpu -> cs & 3) == 3){
+        printf(", killing process\n");
+        return Exit(esp);
+    }
+
+    //The kernel can't continue
+    printf(" in the kernel\n");
+    while(true)
+        asm volatile("cli; hlt");
+
+    return esp;
+}
@@ -0,0 +1,437 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#include <system/profiler.h>
+#include <system/symbols.h>
+#include <system/paging.h>
+#include <hardwarecommunication/apic.h>
+
+using namespace maxOS;
+using namespace maxOS::common;
+using namespace maxOS::hardwarecommunication;
+using namespace maxOS::system;
+
+Profiler* Profiler::activeProfiler = 0;
+
+/**
+ * @details Set up an (empty, stopped) sample buffer for every CPU
+ */
+Profiler::Profiler() {
+
+    int numCPUs = 1;
+    if(AdvancedProgrammableInterruptController::activeAPIC != 0)
+        numCPUs = AdvancedProgrammableInterruptController::activeAPIC -> Description() -> numProcessors;
+    if(numCPUs > PROFILER_MAX_CPUS)
+        numCPUs = PROFILER_MAX_CPUS;
+
+    //Buffers are allocated up front, samples are taken in interrupt context where the heap can't be used
+    for(int i = 0; i < PROFILER_MAX_CPUS; ++i){
+        buffers[i].samples = i < numCPUs ? new ProfileSample[PROFILER_SAMPLES_PER_CPU] : 0;
+        buffers[i].count = 0;
+        buffers[i].dropped = 0;
+    }
+
+    running = false;
+    activeProfiler = this;
+
+}
+
+Profiler::~Profiler() {
+
+    if(activeProfiler == this)
+        activeProfiler = 0;
+
+    for(int i = 0; i < PROFILER_MAX_CPUS; ++i)
+        if(buffers[i].samples != 0)
+            delete[] buffers[i].samples;
+
+}
+
+/**
+ * @details Start taking samples on every timer interrupt
+ */
+void Profiler::Start() {
+    running = true;
+}
+
+/**
+ * @details Stop taking samples, the ones taken are kept
+ */
+void Profiler::Stop() {
+    running = false;
+}
+
+/**
+ * @details Throw away every sample
+ */
+void Profiler::Reset() {
+
+    bool wasRunning = running;
+    running = false;
+
+    for(int i = 0; i < PROFILER_MAX_CPUS; ++i){
+        buffers[i].count = 0;
+        buffers[i].dropped = 0;
+    }
+
+    running = wasRunning;
+
+}
+
+/**
+ * @details Check if samples are being taken
+ * @return True if the profiler is running
+ */
+bool Profiler::IsRunning() {
+    return running;
+}
+
+/**
+ * @details Get how many samples have been kept across every CPU
+ * @return The amount of samples
+ */
+uint32_t Profiler::Samples() {
+
+    uint32_t total = 0;
+    for(int i = 0; i < PROFILER_MAX_CPUS; ++i)
+        total += buffers[i].count;
+
+    return total;
+}
+
+/**
+ * @details Find which buffer belongs to the running CPU
+ * @return The index of the CPU in the MADT, 0 without an APIC
+ */
+int Profiler::CurrentCPU() {
+
+    AdvancedProgrammableInterruptController* apic = AdvancedProgrammableInterruptController::activeAPIC;
+    int cpu = apic == 0 ? 0 : apic -> CurrentCPU();
+
+    return cpu < PROFILER_MAX_CPUS ? cpu : 0;
+}
+
+/**
+ * @details Check that a saved frame pointer can be followed without faulting
+ * @param frame The frame pointer
+ * @return True if it points at kernel memory that is always mapped
+ */
+bool Profiler::ValidFrame(uint32_t frame) {
+    return frame >= 0x100000 && (frame & 0x3) == 0 && frame + 8 <= KERNEL_IDENTITY_END;
+}
+
+/**
+ * @details Record where the CPU was when the timer interrupted it, called from the timer interrupt
+ * @param state The state the interrupt saved
+ */
+void Profiler::Sample(CPUState_Thread* state) {
+
+    if(!running)
+        return;
+
+    ProfileBuffer* buffer = &buffers[CurrentCPU()];
+    if(buffer -> samples == 0 || buffer -> count >= (uint32_t)PROFILER_SAMPLES_PER_CPU){
+        buffer -> dropped++;
+        return;
+    }
+
+    ProfileSample* sample = &buffer -> samples[buffer -> count];
+    sample -> eip = state -> eip;
+    sample -> user = (state -> cs & 0x3) != 0;
+    sample -> depth = 0;
+
+    //The kernel is built with frame pointers: [ebp] is the caller's ebp and [ebp + 4] the return address
+    uint32_t frame = state -> ebp;
+    while(!sample -> user && sample -> depth < PROFILER_MAX_DEPTH && ValidFrame(frame)){
+
+        uint32_t* saved = (uint32_t*)frame;
+        if(saved[1] == 0)
+            break;
+
+        sample -> callers[sample -> depth++] = saved[1];
+
+        //Stacks grow down, so the caller's frame is always higher up (this also stops loops)
+        if(saved[0] <= frame)
+            break;
+        frame = saved[0];
+    }
+
+    buffer -> count++;
+
+}
+
+/**
+ * @details Turn the frames of a sample into symbol indices, outermost last
+ * @param sample The sample
+ * @param frames Where to put the indices (PROFILER_MAX_DEPTH + 1 of them), unknown addresses are Count() and user code Count() + 1
+ * @return The amount of frames
+ */
+static int SampleFrames(ProfileSample* sample, int* frames) {
+
+    int unknown = KernelSymbols::Count();
+    if(sample -> user){
+        frames[0] = unknown + 1;
+        return 1;
+    }
+
+    int index = KernelSymbols::Find(sample -> eip);
+    frames[0] = index < 0 ? unknown : index;
+
+    for(int i = 0; i < sample -> depth; ++i){
+        //A return address points after the call, so look up the byte before it
+        index = KernelSymbols::Find(sample -> callers[i] - 1);
+        frames[i + 1] = index < 0 ? unknown : index;
+    }
+
+    return sample -> depth + 1;
+}
+
+/**
+ * @details Get the name of a symbol index from SampleFrames
+ * @param index The index
+ * @return The name
+ */
+static char* FrameName(int index) {
+
+    int unknown = KernelSymbols::Count();
+    if(index == unknown)
+        return "??";
+    if(index == unknown + 1)
+        return "[user]";
+
+    return KernelSymbols::Get(index) -> name;
+}
+
+/**
+ * @details Count the samples that land in each function
+ * @param inclusive Count a function for every sample it is on the stack of instead of only the ones it was running in
+ * @return An array of counts indexed like SampleFrames, delete it after use
+ */
+uint32_t* Profiler::CountSymbols(bool inclusive) {
+
+    uint32_t numCounts = KernelSymbols::Count() + 2;
+    uint32_t* counts = new uint32_t[numCounts];
+    for(uint32_t i = 0; i < numCounts; ++i)
+        counts[i] = 0;
+
+    int frames[PROFILER_MAX_DEPTH + 1];
+    for(int cpu = 0; cpu < PROFILER_MAX_CPUS; ++cpu){
+        for(uint32_t i = 0; i < buffers[cpu].count; ++i){
+
+            int numFrames = SampleFrames(&buffers[cpu].samples[i], frames);
+            if(!inclusive){
+                counts[frames[0]]++;
+                continue;
+            }
+
+            //Recursion would count a function more than once
+            for(int frame = 0; frame < numFrames; ++frame){
+                bool seen = false;
+                for(int earlier = 0; earlier < frame && !seen; ++earlier)
+                    seen = frames[earlier] == frames[frame];
+
+                if(!seen)
+                    counts[frames[frame]]++;
+            }
+        }
+    }
+
+    return counts;
+}
+
+/**
+ * @details Write the functions that were sampled most, by the samples they were running in (self) and on the stack of (total)
+ * @param log The serial port
+ */
+void Profiler::DumpFlat(serial* log) {
+
+    bool wasRunning = running;
+    running = false;
+
+    uint32_t total = Samples();
+    uint32_t* self = CountSymbols(false);
+    uint32_t* inclusive = CountSymbols(true);
+    uint32_t numCounts = KernelSymbols::Count() + 2;
+
+    log -> Write("Flat profile, samples: ", 6);
+    log -> WriteNumber(total);
+    log -> Write("\n    self%  self  total  function\n", -1);
+
+    //Repeatedly take the biggest remaining count, the table is too big to sort in place
+    for(int line = 0; line < 30; ++line){
+
+        uint32_t best = 0;
+        for(uint32_t i = 1; i < numCounts; ++i)
+            if(self[i] > self[best])
+                best = i;
+
+        if(self[best] == 0)
+            break;
+
+        log -> Write("    ", -1);
+        log -> WriteNumber(self[best] * 100 / total);
+        log -> Write("%  ", -1);
+        log -> WriteNumber(self[best]);
+        log -> Write("  ", -1);
+        log -> WriteNumber(inclusive[best]);
+        log -> Write("  ", -1);
+        log -> Write(FrameName(best), -1);
+        log -> Write("\n", -1);
+
+        self[best] = 0;
+    }
+
+    delete[] self;
+    delete[] inclusive;
+
+    running = wasRunning;
+
+}
+
+/**
+ * @details Add one to an entry of a small table of (symbol, count) pairs
+ * @param symbols The symbols of the table
+ * @param counts The counts of the table
+ * @param used How many entries are used
+ * @param symbol The symbol to count, full tables count everything new in the last entry
+ */
+static void Tally(int* symbols, uint32_t* counts, int* used, int symbol) {
+
+    for(int i = 0; i < *used; ++i){
+        if(symbols[i] == symbol){
+            counts[i]++;
+            return;
+        }
+    }
+
+    if(*used == 8){
+        symbols[7] = -1;
+        counts[7]++;
+        return;
+    }
+
+    symbols[*used] = symbol;
+    counts[*used] = 1;
+    (*used)++;
+
+}
+
+/**
+ * @details Write a table of (symbol, count) pairs from Tally
+ * @param log The serial port
+ * @param prefix Written before each line
+ * @param symbols The symbols of the table
+ * @param counts The counts of the table
+ * @param used How many entries are used
+ */
+static void WriteTally(serial* log, char* prefix, int* symbols, uint32_t* counts, int used) {
+
+    for(int i = 0; i < used; ++i){
+        log -> Write(prefix, -1);
+        log -> WriteNumber(counts[i]);
+        log -> Write("  ", -1);
+        log -> Write(symbols[i] == -1 ? (char*)"(others)" : FrameName(symbols[i]), -1);
+        log -> Write("\n", -1);
+    }
+
+}
+
+/**
+ * @details Write the functions that were on the stack most, each with who called them and what they called
+ * @param log The serial port
+ */
+void Profiler::DumpCallGraph(serial* log) {
+
+    bool wasRunning = running;
+    running = false;
+
+    uint32_t* inclusive = CountSymbols(true);
+    uint32_t* self = CountSymbols(false);
+    uint32_t numCounts = KernelSymbols::Count() + 2;
+
+    log -> Write("Call graph profile, samples: ", 6);
+    log -> WriteNumber(Samples());
+    log -> Write("\n", -1);
+
+    int frames[PROFILER_MAX_DEPTH + 1];
+    for(int entry = 0; entry < 15; ++entry){
+
+        uint32_t best = 0;
+        for(uint32_t i = 1; i < numCounts; ++i)
+            if(inclusive[i] > inclusive[best])
+                best = i;
+
+        if(inclusive[best] == 0)
+            break;
+
+        int callers[8], callees[8];
+        uint32_t callerCounts[8], calleeCounts[8];
+        int numCallers = 0, numCallees = 0;
+
+        for(int cpu = 0; cpu < PROFILER_MAX_CPUS; ++cpu){
+            for(uint32_t i = 0; i < buffers[cpu].count; ++i){
+
+                int numFrames = SampleFrames(&buffers[cpu].samples[i], frames);
+                for(int frame = 0; frame < numFrames; ++frame){
+                    if(frames[frame] != (int)best)
+                        continue;
+
+                    if(frame + 1 < numFrames)
+                        Tally(callers, callerCounts, &numCallers, frames[frame + 1]);
+                    if(frame > 0)
+                        Tally(callees, calleeCounts, &numCallees, frames[frame - 1]);
+                    break;
+                }
+            }
+        }
+
+        WriteTally(log, "        caller ", callers, callerCounts, numCallers);
+        log -> Write("    [", -1);
+        log -> WriteNumber(inclusive[best]);
+        log -> Write(" total, ", -1);
+        log -> WriteNumber(self[best]);
+        log -> Write(" self]  ", -1);
+        log -> Write(FrameName(best), -1);
+        log -> Write("\n", -1);
+        WriteTally(log, "        callee ", callees, calleeCounts, numCallees);
+        log -> Write("\n", -1);
+
+        inclusive[best] = 0;
+    }
+
+    delete[] self;
+    delete[] inclusive;
+
+    running = wasRunning;
+
+}
+
+/**
+ * @details Write every sample as a "outermost;...;innermost 1" line, the folded stack format flamegraph.pl reads
+ * @param log The serial port
+ */
+void Profiler::DumpFoldedStacks(serial* log) {
+
+    bool wasRunning = running;
+    running = false;
+
+    log -> Write("Folded stacks:\n", 6);
+
+    int frames[PROFILER_MAX_DEPTH + 1];
+    for(int cpu = 0; cpu < PROFILER_MAX_CPUS; ++cpu){
+        for(uint32_t i = 0; i < buffers[cpu].count; ++i){
+
+            int numFrames = SampleFrames(&buffers[cpu].samples[i], frames);
+            for(int frame = numFrames - 1; frame >= 0; --frame){
+                log -> Write(FrameName(frames[frame]), -1);
+                log -> Write(frame == 0 ? (char*)" 1\n" : (char*)";", -1);
+            }
+        }
+    }
+
+    log -> Write("End of folded stacks\n", 6);
+
+    running = wasRunning;
+
+}
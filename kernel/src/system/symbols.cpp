@@ -0,0 +1,70 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#include <system/symbols.h>
+
+using namespace maxOS;
+using namespace maxOS::common;
+using namespace maxOS::system;
+
+//Emitted by toolchain/symbols.sh, sorted by address
+extern "C" KernelSymbol kernelSymbols[];
+extern "C" uint32_t numKernelSymbols;
+
+/**
+ * @details Get how many functions are in the table (0 until the image has been linked twice)
+ * @return The amount of symbols
+ */
+uint32_t KernelSymbols::Count() {
+    return numKernelSymbols;
+}
+
+/**
+ * @details Get a symbol by its position in the table
+ * @param index The position
+ * @return The symbol, 0 if the index is past the end
+ */
+KernelSymbol* KernelSymbols::Get(uint32_t index) {
+
+    if(index >= numKernelSymbols)
+        return 0;
+
+    return &kernelSymbols[index];
+}
+
+/**
+ * @details Find the function an address is in
+ * @param address The address (e.g. a sampled EIP or a return address)
+ * @return The index of the function, -1 if the address is before the first one or there is no table
+ */
+int KernelSymbols::Find(uint32_t address) {
+
+    if(numKernelSymbols == 0 || address < kernelSymbols[0].address)
+        return -1;
+
+    //Binary search for the last symbol at or below the address
+    uint32_t low = 0;
+    uint32_t high = numKernelSymbols;
+    while(high - low > 1){
+        uint32_t middle = (low + high) / 2;
+        if(kernelSymbols[middle].address <= address)
+            low = middle;
+        else
+            high = middle;
+    }
+
+    return low;
+}
+
+/**
+ * @details Get the name of the function an address is in
+ * @param address The address
+ * @return The name, "??" if it isn't known
+ */
+char* KernelSymbols::Name(uint32_t address) {
+
+    int index = Find(address);
+    return index < 0 ? (char*)"??" : kernelSymbols[index].name;
+
+}
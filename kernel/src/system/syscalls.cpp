@@ -3,6 +3,13 @@
 //
 
 #include <system/syscalls.h>
+#include <system/clock.h>
+#include <system/vdso.h>
+#include <system/iouring.h>
+#include <system/process.h>
+#include <hardwarecommunication/serial.h>
+#include <system/profiler.h>
+#include <system/trace.h>
 
 using namespace maxOS;
 using namespace maxOS::common;
@@ -14,6 +21,32 @@ void printfHex(uint8_t key);                    //Forward declaration
 char printfInt( long num );                     //Forward declaration
 
 
+/**
+ * @details Check that a buffer passed to a syscall belongs to the caller. Kernel threads can pass any kernel pointer, user code only its own memory
+ * @param cpu The stack frame of the syscall
+ * @param address The start of the buffer
+ * @param length The size of the buffer in bytes
+ * @param write Whether the syscall writes to the buffer
+ * @return True if the syscall can use the buffer
+ */
+static bool IsCallerMemory(CPUState_Thread* cpu, uint32_t address, uint32_t length, bool write){
+
+    if((cpu -> cs & 3) == 0)
+        return true;
+
+    Process* process = ProcessManager::activeProcessManager == 0 ? 0 : ProcessManager::activeProcessManager -> CurrentProcess();
+    return process != 0 && process -> IsUserMemory(address, length, write);
+}
+
+/**
+ * @details Check if a syscall comes from the kernel, the system wide debugging controls aren't for user processes
+ * @param cpu The stack frame of the syscall
+ * @return True if the caller runs in ring 0
+ */
+static bool IsPrivileged(CPUState_Thread* cpu){
+    return (cpu -> cs & 3) == 0;
+}
+
 ///__Handler__///
 
 SyscallHandler::SyscallHandler(InterruptManager* interruptManager, uint8_t InterruptNumber)
@@ -36,11 +69,115 @@ uint32_t SyscallHandler::HandleInterrupt(uint32_t esp)
 
     switch(cpu->eax)
     {
+        case 1:                                 //Exit (only user processes, kernel processes return from their entry point)
+            if(ProcessManager::activeProcessManager != 0)
+                return ProcessManager::activeProcessManager -> Exit(esp);
+            break;
+
         case 4:                                 //Write
             printf((char*)cpu->ebx);
             cpu -> ecx = (uint32_t)"b";
             break;
 
+        case 20:                                //Get PID (slow path, libraries read it from the vDSO page)
+            cpu -> eax = VirtualDynamicSharedObject::Page() -> pid;
+            break;
+
+        case 158:                               //Yield, give the rest of the time slice to another thread
+            if(ThreadManager::activeThreadManager != 0)
+                return (uint32_t)ThreadManager::activeThreadManager -> Schedule(cpu, true);
+            break;
+
+        case 265:                               //Clock Get Time (slow path, libraries read it from the vDSO page)
+        {
+            uint32_t* timespec = (uint32_t*)cpu -> ecx;
+            if(Clock::activeClock == 0 || timespec == 0 || !IsCallerMemory(cpu, cpu -> ecx, 2 * sizeof(uint32_t), true)){
+                cpu -> eax = -1;
+                break;
+            }
+
+            Clock::activeClock -> GetTime(&timespec[0], &timespec[1]);
+            if(cpu -> ebx == 0)                 //CLOCK_REALTIME
+                timespec[0] += Clock::activeClock -> BootTime();
+            cpu -> eax = 0;
+            break;
+        }
+
+        case 425:                               //IO Ring Setup
+            if(!IsCallerMemory(cpu, cpu -> ebx, sizeof(IORingParameters), true)){
+                cpu -> eax = -1;
+                break;
+            }
+
+            cpu -> eax = IORing::Setup((IORingParameters*)cpu -> ebx);
+            break;
+
+        case 426:                               //IO Ring Enter: ebx = ring, ecx = submissions to consume, edx = completions to wait for
+            cpu -> eax = IORing::Enter(cpu -> ebx, cpu -> ecx, cpu -> edx);
+            break;
+
+        case 512:                               //Get the address of the vDSO page (maxOS specific)
+        {
+            //User processes see it at a fixed address, kernel threads use it where it is
+            Process* process = ProcessManager::activeProcessManager == 0 ? 0 : ProcessManager::activeProcessManager -> CurrentProcess();
+            cpu -> eax = (process != 0 && process -> AddressSpace() != 0) ? USER_VDSO_ADDRESS : (uint32_t)VirtualDynamicSharedObject::Page();
+            break;
+        }
+
+        case 513:                               //Get the CPU usage of every thread (maxOS specific), times are TSC ticks and edx returns the ticks per millisecond
+            if(ThreadManager::activeThreadManager == 0 || cpu -> ebx == 0 || (int32_t)cpu -> ecx <= 0 || cpu -> ecx > 256
+               || !IsCallerMemory(cpu, cpu -> ebx, cpu -> ecx * sizeof(ThreadInfo), true)){
+                cpu -> eax = -1;
+                break;
+            }
+
+            cpu -> eax = ThreadManager::activeThreadManager -> GetStatistics((ThreadInfo*)cpu -> ebx, cpu -> ecx);
+            cpu -> edx = Clock::activeClock == 0 ? 0 : Clock::activeClock -> TicksPerMillisecond();
+            break;
+
+        case 514:                               //Write the per vector interrupt statistics to the serial port, ebx != 0 also resets them (maxOS specific)
+            if(!IsPrivileged(cpu) || serial::activeSerial == 0){
+                cpu -> eax = -1;
+                break;
+            }
+
+            interruptManager -> DumpStatistics(serial::activeSerial);
+            if(cpu -> ebx != 0)
+                interruptManager -> ResetStatistics();
+            cpu -> eax = 0;
+            break;
+
+        case 515:                               //Control the sampling profiler (maxOS specific): ebx = 0 stop, 1 start, 2 reset, 3 flat profile, 4 call graph, 5 folded stacks (reports go to the serial port)
+        {
+            Profiler* profiler = Profiler::activeProfiler;
+            if(!IsPrivileged(cpu) || profiler == 0 || (cpu -> ebx >= 3 && serial::activeSerial == 0)){
+                cpu -> eax = -1;
+                break;
+            }
+
+            cpu -> eax = 0;
+            switch (cpu -> ebx) {
+                case 0: profiler -> Stop(); break;
+                case 1: profiler -> Start(); break;
+                case 2: profiler -> Reset(); break;
+                case 3: profiler -> DumpFlat(serial::activeSerial); break;
+                case 4: profiler -> DumpCallGraph(serial::activeSerial); break;
+                case 5: profiler -> DumpFoldedStacks(serial::activeSerial); break;
+                default: cpu -> eax = -1; break;
+            }
+            break;
+        }
+
+        case 516:                               //Choose which tracepoints are recorded (maxOS specific): ebx = a bit per TraceEvent, 0 stops tracing. Returns the previous mask
+            if(!IsPrivileged(cpu) || Tracer::activeTracer == 0){
+                cpu -> eax = -1;
+                break;
+            }
+
+            cpu -> eax = Tracer::activeTracer -> EnabledEvents();
+            Tracer::activeTracer -> Enable(cpu -> ebx);
+            break;
+
          default:
             break;
     }
@@ -0,0 +1,266 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#include <system/trace.h>
+#include <system/clock.h>
+#include <system/multithreading.h>
+#include <hardwarecommunication/apic.h>
+#include <hardwarecommunication/interrupts.h>
+
+using namespace maxOS;
+using namespace maxOS::common;
+using namespace maxOS::hardwarecommunication;
+using namespace maxOS::system;
+
+Tracer* Tracer::activeTracer = 0;
+
+#define MAXOS_TRACE_DESCRIPTION(id, phase, name, argument0, argument1) { phase, name, { argument0, argument1 } },
+const TraceEventDescription Tracer::events[TRACE_NUM_EVENTS] = {
+    MAXOS_TRACE_EVENTS(MAXOS_TRACE_DESCRIPTION)
+};
+#undef MAXOS_TRACE_DESCRIPTION
+
+/**
+ * @details Set up an empty ring for every CPU, nothing is recorded until events are enabled
+ */
+Tracer::Tracer() {
+
+    int numCPUs = 1;
+    if(AdvancedProgrammableInterruptController::activeAPIC != 0)
+        numCPUs = AdvancedProgrammableInterruptController::activeAPIC -> Description() -> numProcessors;
+
+    //Records are added in interrupt context where the heap can't be used, so the rings are allocated now
+    for(int i = 0; i < TRACE_MAX_CPUS; ++i){
+        rings[i].records = i < numCPUs ? new TraceRecord[TRACE_RECORDS_PER_CPU] : 0;
+        rings[i].head = 0;
+        rings[i].tail = 0;
+        rings[i].dropped = 0;
+        reportedDropped[i] = 0;
+    }
+
+    enabledEvents = 0;
+    describedEvents = false;
+    activeTracer = this;
+
+}
+
+Tracer::~Tracer() {
+
+    if(activeTracer == this)
+        activeTracer = 0;
+
+    for(int i = 0; i < TRACE_MAX_CPUS; ++i)
+        if(rings[i].records != 0)
+            delete[] rings[i].records;
+
+}
+
+/**
+ * @details Choose which events are recorded
+ * @param eventMask A bit per TraceEvent, 0 stops tracing
+ */
+void Tracer::Enable(uint32_t eventMask) {
+    enabledEvents = eventMask & ((1 << TRACE_NUM_EVENTS) - 1);
+}
+
+/**
+ * @details Get which events are recorded
+ * @return A bit per TraceEvent
+ */
+uint32_t Tracer::EnabledEvents() {
+    return enabledEvents;
+}
+
+/**
+ * @details Find which ring belongs to the running CPU
+ * @return The index of the CPU in the MADT, 0 without an APIC
+ */
+int Tracer::CurrentCPU() {
+
+    AdvancedProgrammableInterruptController* apic = AdvancedProgrammableInterruptController::activeAPIC;
+    int cpu = apic == 0 ? 0 : apic -> CurrentCPU();
+
+    return cpu < TRACE_MAX_CPUS ? cpu : 0;
+}
+
+/**
+ * @details Add a record to the ring of this CPU, safe to call from any context (use Trace, it skips disabled events)
+ * @param event The event
+ * @param argument0 The first argument of the event
+ * @param argument1 The second argument of the event
+ */
+void Tracer::Record(TraceEvent event, uint32_t argument0, uint32_t argument1) {
+
+    TraceRing* ring = &rings[CurrentCPU()];
+    if(ring -> records == 0)
+        return;
+
+    //Reserve a slot, retrying if an interrupt reserved one in between. Full rings drop the record rather than overwriting one being drained
+    uint32_t slot;
+    do{
+        slot = ring -> head;
+        if(slot - ring -> tail >= TRACE_RECORDS_PER_CPU){
+            __sync_fetch_and_add(&ring -> dropped, 1);
+            return;
+        }
+    }while(!__sync_bool_compare_and_swap(&ring -> head, slot, slot + 1));
+
+    TraceRecord* record = &ring -> records[slot % TRACE_RECORDS_PER_CPU];
+    record -> timestamp = Clock::ReadTimestampCounter();
+    record -> event = event;
+    record -> pid = ThreadManager::activeThreadManager == 0 ? 0 : ThreadManager::activeThreadManager -> CurrentPID();
+    record -> arguments[0] = argument0;
+    record -> arguments[1] = argument1;
+
+    //x86 doesn't reorder stores, so the drain thread never sees the sequence before the rest of the record
+    asm volatile("" : : : "memory");
+    record -> sequence = slot + 1;
+
+}
+
+/**
+ * @details Send a frame: "MXTR", the type, the CPU, the payload length, the payload and a checksum of the payload
+ * @param log The serial port
+ * @param type The TraceFrameType
+ * @param cpu The CPU the frame is about
+ * @param payload The payload
+ * @param length The length of the payload
+ */
+void Tracer::WriteFrame(serial* log, uint8_t type, uint8_t cpu, uint8_t* payload, uint16_t length) {
+
+    uint8_t header[8] = { 'M', 'X', 'T', 'R', type, cpu, (uint8_t)(length & 0xFF), (uint8_t)(length >> 8) };
+
+    uint8_t checksum = 0;
+    for(uint16_t i = 0; i < length; ++i)
+        checksum += payload[i];
+
+    //Sent with interrupts on, a frame takes milliseconds at this baud rate. If other logging gets in between the checksum won't match and the decoder skips the frame
+    log -> WriteBytes(header, 8);
+    log -> WriteBytes(payload, length);
+    log -> WriteBytes(&checksum, 1);
+
+}
+
+/**
+ * @details Send the names of every event and the TSC frequency, so the decoder doesn't need to know them
+ * @param log The serial port
+ */
+void Tracer::DescribeEvents(serial* log) {
+
+    uint8_t payload[128];
+
+    for(int event = 0; event < TRACE_NUM_EVENTS; ++event){
+
+        //Event, phase, then the name and argument names as 0 terminated strings
+        uint16_t length = 0;
+        payload[length++] = event;
+        payload[length++] = events[event].phase;
+
+        char* strings[3] = { events[event].name, events[event].arguments[0], events[event].arguments[1] };
+        for(int i = 0; i < 3; ++i){
+            for(char* c = strings[i]; *c != '\0' && length < sizeof(payload) - 1; ++c)
+                payload[length++] = *c;
+            payload[length++] = '\0';
+        }
+
+        WriteFrame(log, TRACE_FRAME_DESCRIPTION, 0, payload, length);
+    }
+
+    uint32_t ticksPerMillisecond = Clock::activeClock == 0 ? 0 : Clock::activeClock -> TicksPerMillisecond();
+    WriteFrame(log, TRACE_FRAME_CLOCK, 0, (uint8_t*)&ticksPerMillisecond, 4);
+
+    describedEvents = true;
+
+}
+
+/**
+ * @details Send the finished records of a CPU in frames of up to 8
+ * @param log The serial port
+ * @param cpu The CPU
+ * @return The amount of records sent
+ */
+uint32_t Tracer::DrainRing(serial* log, int cpu) {
+
+    TraceRing* ring = &rings[cpu];
+    if(ring -> records == 0)
+        return 0;
+
+    //Records on the wire don't have the sequence
+    const uint32_t recordSize = sizeof(TraceRecord) - sizeof(uint32_t);
+    uint8_t payload[8 * recordSize];
+    uint32_t sent = 0;
+
+    while(true){
+
+        //Only taking the records out is done with interrupts off, so the slots are handed back in one go
+        uint32_t flags = DisableInterrupts();
+
+        uint32_t count = 0;
+        while(count < 8 && ring -> tail != ring -> head){
+
+            //Stop at a record that was reserved but not written yet (its writer was interrupted)
+            TraceRecord* record = &ring -> records[ring -> tail % TRACE_RECORDS_PER_CPU];
+            if(record -> sequence != ring -> tail + 1)
+                break;
+
+            uint8_t* source = (uint8_t*)record;
+            for(uint32_t i = 0; i < recordSize; ++i)
+                payload[count * recordSize + i] = source[i];
+
+            //Only hand the slot back once it has been copied
+            asm volatile("" : : : "memory");
+            ring -> tail++;
+            count++;
+        }
+
+        RestoreInterrupts(flags);
+
+        if(count == 0)
+            break;
+
+        WriteFrame(log, TRACE_FRAME_RECORDS, cpu, payload, count * recordSize);
+        sent += count;
+    }
+
+    uint32_t dropped = ring -> dropped;
+    if(dropped != reportedDropped[cpu]){
+        WriteFrame(log, TRACE_FRAME_DROPPED, cpu, (uint8_t*)&dropped, 4);
+        reportedDropped[cpu] = dropped;
+    }
+
+    return sent;
+}
+
+/**
+ * @details Send every finished record over the serial port
+ * @param log The serial port
+ * @return The amount of records sent
+ */
+uint32_t Tracer::Drain(serial* log) {
+
+    if(!describedEvents)
+        DescribeEvents(log);
+
+    uint32_t sent = 0;
+    for(int cpu = 0; cpu < TRACE_MAX_CPUS; ++cpu)
+        sent += DrainRing(log, cpu);
+
+    return sent;
+}
+
+/**
+ * @details The drain thread: sends records whenever there are some and sleeps until the next interrupt otherwise, so it only
+ *          uses the CPU when others leave it idle or tracing is producing records
+ */
+void Tracer::Drainer() {
+
+    while(true){
+
+        //Once tracing has started the rest of the records still go out after it is stopped
+        bool tracing = activeTracer != 0 && serial::activeSerial != 0 && (activeTracer -> enabledEvents != 0 || activeTracer -> describedEvents);
+        if(!tracing || activeTracer -> Drain(serial::activeSerial) == 0)
+            asm volatile("hlt");
+    }
+
+}
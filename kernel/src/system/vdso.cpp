@@ -0,0 +1,72 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#include <system/vdso.h>
+
+using namespace maxOS;
+using namespace maxOS::common;
+using namespace maxOS::system;
+
+VDSOData VirtualDynamicSharedObject::page __attribute__((section(".vdso_data"), aligned(4096)));
+
+/**
+ * @details Get the shared page, user code only ever reads from it
+ * @return The shared page
+ */
+VDSOData* VirtualDynamicSharedObject::Page() {
+    return &page;
+}
+
+/**
+ * @details Mark the page as being written, readers will spin until EndWrite
+ */
+void VirtualDynamicSharedObject::BeginWrite() {
+    page.sequence++;                                        //Odd = write in progress
+    asm volatile("" : : : "memory");                        //Stop the compiler moving the data writes above this
+}
+
+/**
+ * @details Mark the page as consistent again
+ */
+void VirtualDynamicSharedObject::EndWrite() {
+    asm volatile("" : : : "memory");                        //Stop the compiler moving the data writes below this
+    page.sequence++;                                        //Even = stable
+}
+
+/**
+ * @details Publish the current time, called by the clock on every tick
+ * @param mult The multiplier to convert TSC ticks to ns
+ * @param shift The shift to convert TSC ticks to ns
+ * @param tscBase The TSC value that the time was taken at
+ * @param seconds Seconds since boot
+ * @param nanoseconds Nanoseconds into the current second
+ * @param bootTime Unix time at boot
+ */
+void VirtualDynamicSharedObject::UpdateClock(uint32_t mult, uint32_t shift, uint64_t tscBase, uint32_t seconds, uint32_t nanoseconds, uint32_t bootTime) {
+
+    BeginWrite();
+    page.mult = mult;
+    page.shift = shift;
+    page.tscBase = tscBase;
+    page.seconds = seconds;
+    page.nanoseconds = nanoseconds;
+    page.bootTime = bootTime;
+    EndWrite();
+
+}
+
+/**
+ * @details Publish the running process, called by the scheduler when it switches threads
+ * @param pid The process ID of the thread that is about to run
+ */
+void VirtualDynamicSharedObject::SetProcess(pid_t pid) {
+
+    if(page.pid == pid)                                     //Most switches stay in the same process
+        return;
+
+    BeginWrite();
+    page.pid = pid;
+    EndWrite();
+
+}
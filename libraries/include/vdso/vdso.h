@@ -0,0 +1,33 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#ifndef MAXOS_LIBRARIES_VDSO_H
+#define MAXOS_LIBRARIES_VDSO_H
+
+#include <common/types.h>
+#include <system/vdso.h>
+
+namespace OSlib{
+
+    namespace vdso{
+
+        enum ClockID{
+            CLOCK_REALTIME = 0,
+            CLOCK_MONOTONIC = 1
+        };
+
+        struct timespec{
+            maxOS::common::int32_t tv_sec;
+            maxOS::common::int32_t tv_nsec;
+        };
+
+        //Both of these read the kernel maintained vDSO page so they never trap after the first call
+        int clock_gettime(int clockID, timespec* time);
+        maxOS::common::pid_t getpid();
+
+    }
+
+}
+
+#endif //MAXOS_LIBRARIES_VDSO_H
@@ -0,0 +1,89 @@
+//
+// Created by 98max on 19/10/2026.
+//
+
+#include <vdso/vdso.h>
+
+using namespace maxOS::common;
+using namespace maxOS::system;
+using namespace OSlib::vdso;
+
+static const VDSOData* page = 0;
+
+/**
+ * @details Find the vDSO page, only the first call goes into the kernel
+ * @return The vDSO page
+ */
+static const VDSOData* GetPage(){
+
+    if(page == 0){
+        uint32_t address;
+        asm volatile("int $0x80" : "=a"(address) : "a"(512));     //Get the address of the vDSO page
+        page = (const VDSOData*)address;
+    }
+
+    return page;
+}
+
+/**
+ * @details Read the time stamp counter
+ * @return The TSC value
+ */
+static inline uint64_t ReadTimestampCounter(){
+    uint32_t low, high;
+    asm volatile("rdtsc" : "=a"(low), "=d"(high));
+    return ((uint64_t)high << 32) | low;
+}
+
+/**
+ * @details Get the time of a clock without a syscall
+ * @param clockID CLOCK_REALTIME or CLOCK_MONOTONIC
+ * @param time Where to store the time
+ * @return 0 on success, -1 on an unknown clock
+ */
+int OSlib::vdso::clock_gettime(int clockID, timespec* time){
+
+    if(clockID != CLOCK_REALTIME && clockID != CLOCK_MONOTONIC)
+        return -1;
+
+    const VDSOData* data = GetPage();
+    uint32_t sequence, seconds, bootTime;
+    uint64_t nanoseconds;
+
+    //Seqlock read: retry if the kernel was writing, or wrote while we were reading
+    do {
+        sequence = data -> sequence;
+        asm volatile("" : : : "memory");
+
+        if(sequence & 1)
+            continue;
+
+        nanoseconds = ((ReadTimestampCounter() - data -> tscBase) * data -> mult) >> data -> shift;
+        nanoseconds += data -> nanoseconds;
+        seconds = data -> seconds;
+        bootTime = data -> bootTime;
+
+        asm volatile("" : : : "memory");
+    } while ((sequence & 1) || sequence != data -> sequence);
+
+    while(nanoseconds >= 1000000000){                           //Only loops more than once if the timer interrupt has been held off
+        nanoseconds -= 1000000000;
+        seconds++;
+    }
+
+    time -> tv_sec = seconds + (clockID == CLOCK_REALTIME ? bootTime : 0);
+    time -> tv_nsec = (uint32_t)nanoseconds;
+    return 0;
+
+}
+
+/**
+ * @details Get the ID of the calling process without a syscall
+ * @return The process ID
+ */
+pid_t OSlib::vdso::getpid(){
+
+    const VDSOData* data = GetPage();
+    return data -> pid;
+
+}
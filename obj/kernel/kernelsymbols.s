@@ -0,0 +1,2840 @@
+.section .note.GNU-stack,"",@progbits
+.section .rodata
+.global kernelSymbols
+.global numKernelSymbols
+numKernelSymbols: .long 1417
+kernelSymbols:
+    .long 0x0010000c, .LsymbolName0
+    .long 0x0010001d, .LsymbolName1
+    .long 0x00100022, .LsymbolName2
+    .long 0x00100022, .LsymbolName3
+    .long 0x00100170, .LsymbolName4
+    .long 0x00100170, .LsymbolName5
+    .long 0x00100180, .LsymbolName6
+    .long 0x00100194, .LsymbolName7
+    .long 0x001001a8, .LsymbolName8
+    .long 0x001001bc, .LsymbolName9
+    .long 0x001001d0, .LsymbolName10
+    .long 0x001001e4, .LsymbolName11
+    .long 0x001001fe, .LsymbolName12
+    .long 0x001001fe, .LsymbolName13
+    .long 0x001002da, .LsymbolName14
+    .long 0x00100350, .LsymbolName15
+    .long 0x001003d2, .LsymbolName16
+    .long 0x001003d6, .LsymbolName17
+    .long 0x001003da, .LsymbolName18
+    .long 0x001003da, .LsymbolName19
+    .long 0x0010043a, .LsymbolName20
+    .long 0x0010043a, .LsymbolName21
+    .long 0x00100460, .LsymbolName22
+    .long 0x0010054c, .LsymbolName23
+    .long 0x00100626, .LsymbolName24
+    .long 0x00100658, .LsymbolName25
+    .long 0x0010068a, .LsymbolName26
+    .long 0x0010069c, .LsymbolName27
+    .long 0x001006ae, .LsymbolName28
+    .long 0x001006da, .LsymbolName29
+    .long 0x00100706, .LsymbolName30
+    .long 0x00100721, .LsymbolName31
+    .long 0x0010073c, .LsymbolName32
+    .long 0x00100768, .LsymbolName33
+    .long 0x00100768, .LsymbolName34
+    .long 0x00100784, .LsymbolName35
+    .long 0x00100784, .LsymbolName36
+    .long 0x001007a0, .LsymbolName37
+    .long 0x001007b0, .LsymbolName38
+    .long 0x001007c0, .LsymbolName39
+    .long 0x001007d0, .LsymbolName40
+    .long 0x001007d0, .LsymbolName41
+    .long 0x001007f6, .LsymbolName42
+    .long 0x001007f6, .LsymbolName43
+    .long 0x0010081c, .LsymbolName44
+    .long 0x001008bc, .LsymbolName45
+    .long 0x00100970, .LsymbolName46
+    .long 0x001009e2, .LsymbolName47
+    .long 0x00100a16, .LsymbolName48
+    .long 0x00100a88, .LsymbolName49
+    .long 0x00100ac8, .LsymbolName50
+    .long 0x00100b1c, .LsymbolName51
+    .long 0x00100bb8, .LsymbolName52
+    .long 0x00100bfc, .LsymbolName53
+    .long 0x00100cc0, .LsymbolName54
+    .long 0x00100d09, .LsymbolName55
+    .long 0x00100d24, .LsymbolName56
+    .long 0x00100d24, .LsymbolName57
+    .long 0x00100d48, .LsymbolName58
+    .long 0x00100d48, .LsymbolName59
+    .long 0x00100d58, .LsymbolName60
+    .long 0x00100d58, .LsymbolName61
+    .long 0x00100d84, .LsymbolName62
+    .long 0x00100d84, .LsymbolName63
+    .long 0x00100da0, .LsymbolName64
+    .long 0x00100da0, .LsymbolName65
+    .long 0x00100dcc, .LsymbolName66
+    .long 0x00100dcc, .LsymbolName67
+    .long 0x00100de8, .LsymbolName68
+    .long 0x00100de8, .LsymbolName69
+    .long 0x00100e14, .LsymbolName70
+    .long 0x00100e14, .LsymbolName71
+    .long 0x00100e30, .LsymbolName72
+    .long 0x00100e30, .LsymbolName73
+    .long 0x00100e5c, .LsymbolName74
+    .long 0x00100e5c, .LsymbolName75
+    .long 0x00100e78, .LsymbolName76
+    .long 0x00100e86, .LsymbolName77
+    .long 0x00100e94, .LsymbolName78
+    .long 0x00100ea2, .LsymbolName79
+    .long 0x00100eb0, .LsymbolName80
+    .long 0x00100ebe, .LsymbolName81
+    .long 0x00100ecc, .LsymbolName82
+    .long 0x00100eda, .LsymbolName83
+    .long 0x00100ee8, .LsymbolName84
+    .long 0x00100ef4, .LsymbolName85
+    .long 0x00100f02, .LsymbolName86
+    .long 0x00100f0e, .LsymbolName87
+    .long 0x00100f1a, .LsymbolName88
+    .long 0x00100f26, .LsymbolName89
+    .long 0x00100f32, .LsymbolName90
+    .long 0x00100f3e, .LsymbolName91
+    .long 0x00100f4c, .LsymbolName92
+    .long 0x00100f5a, .LsymbolName93
+    .long 0x00100f66, .LsymbolName94
+    .long 0x00100f74, .LsymbolName95
+    .long 0x00100f82, .LsymbolName96
+    .long 0x00100f90, .LsymbolName97
+    .long 0x00100f9e, .LsymbolName98
+    .long 0x00100fac, .LsymbolName99
+    .long 0x00100fba, .LsymbolName100
+    .long 0x00100fc8, .LsymbolName101
+    .long 0x00100fd6, .LsymbolName102
+    .long 0x00100fe4, .LsymbolName103
+    .long 0x00100ff2, .LsymbolName104
+    .long 0x00101000, .LsymbolName105
+    .long 0x0010100e, .LsymbolName106
+    .long 0x0010101c, .LsymbolName107
+    .long 0x0010102a, .LsymbolName108
+    .long 0x00101038, .LsymbolName109
+    .long 0x00101046, .LsymbolName110
+    .long 0x00101054, .LsymbolName111
+    .long 0x00101062, .LsymbolName112
+    .long 0x00101070, .LsymbolName113
+    .long 0x0010107e, .LsymbolName114
+    .long 0x0010108c, .LsymbolName115
+    .long 0x0010109a, .LsymbolName116
+    .long 0x001010a8, .LsymbolName117
+    .long 0x001010b6, .LsymbolName118
+    .long 0x001010c4, .LsymbolName119
+    .long 0x001010d2, .LsymbolName120
+    .long 0x001010e0, .LsymbolName121
+    .long 0x001010ee, .LsymbolName122
+    .long 0x001010fc, .LsymbolName123
+    .long 0x0010110a, .LsymbolName124
+    .long 0x00101118, .LsymbolName125
+    .long 0x00101126, .LsymbolName126
+    .long 0x00101134, .LsymbolName127
+    .long 0x00101142, .LsymbolName128
+    .long 0x00101150, .LsymbolName129
+    .long 0x0010115e, .LsymbolName130
+    .long 0x0010116c, .LsymbolName131
+    .long 0x0010117a, .LsymbolName132
+    .long 0x00101188, .LsymbolName133
+    .long 0x00101196, .LsymbolName134
+    .long 0x001011a1, .LsymbolName135
+    .long 0x001011ac, .LsymbolName136
+    .long 0x001011b7, .LsymbolName137
+    .long 0x001011c2, .LsymbolName138
+    .long 0x001011cd, .LsymbolName139
+    .long 0x001011d8, .LsymbolName140
+    .long 0x001011e3, .LsymbolName141
+    .long 0x001011ee, .LsymbolName142
+    .long 0x001011f9, .LsymbolName143
+    .long 0x00101204, .LsymbolName144
+    .long 0x0010120f, .LsymbolName145
+    .long 0x0010121a, .LsymbolName146
+    .long 0x00101239, .LsymbolName147
+    .long 0x0010123a, .LsymbolName148
+    .long 0x0010123a, .LsymbolName149
+    .long 0x0010127e, .LsymbolName150
+    .long 0x0010127e, .LsymbolName151
+    .long 0x001012c8, .LsymbolName152
+    .long 0x001012da, .LsymbolName153
+    .long 0x00101374, .LsymbolName154
+    .long 0x00101374, .LsymbolName155
+    .long 0x00101b60, .LsymbolName156
+    .long 0x00101b60, .LsymbolName157
+    .long 0x00101bd6, .LsymbolName158
+    .long 0x00101c14, .LsymbolName159
+    .long 0x00101c3a, .LsymbolName160
+    .long 0x00101c7c, .LsymbolName161
+    .long 0x00101ff4, .LsymbolName162
+    .long 0x0010211a, .LsymbolName163
+    .long 0x00102178, .LsymbolName164
+    .long 0x0010224c, .LsymbolName165
+    .long 0x001022d0, .LsymbolName166
+    .long 0x001022fa, .LsymbolName167
+    .long 0x00102312, .LsymbolName168
+    .long 0x0010240e, .LsymbolName169
+    .long 0x001028da, .LsymbolName170
+    .long 0x001028f3, .LsymbolName171
+    .long 0x00102910, .LsymbolName172
+    .long 0x0010294a, .LsymbolName173
+    .long 0x0010296a, .LsymbolName174
+    .long 0x001029d8, .LsymbolName175
+    .long 0x001029d8, .LsymbolName176
+    .long 0x00102d3a, .LsymbolName177
+    .long 0x00102d3a, .LsymbolName178
+    .long 0x00102e12, .LsymbolName179
+    .long 0x00102e50, .LsymbolName180
+    .long 0x00102e9c, .LsymbolName181
+    .long 0x00102eda, .LsymbolName182
+    .long 0x00103142, .LsymbolName183
+    .long 0x0010326e, .LsymbolName184
+    .long 0x00103324, .LsymbolName185
+    .long 0x00103349, .LsymbolName186
+    .long 0x0010336b, .LsymbolName187
+    .long 0x0010338d, .LsymbolName188
+    .long 0x001033af, .LsymbolName189
+    .long 0x001033d4, .LsymbolName190
+    .long 0x001033f3, .LsymbolName191
+    .long 0x00103412, .LsymbolName192
+    .long 0x00103453, .LsymbolName193
+    .long 0x001034c8, .LsymbolName194
+    .long 0x001035aa, .LsymbolName195
+    .long 0x0010361a, .LsymbolName196
+    .long 0x00103692, .LsymbolName197
+    .long 0x001036a4, .LsymbolName198
+    .long 0x001036a4, .LsymbolName199
+    .long 0x0010388c, .LsymbolName200
+    .long 0x0010388c, .LsymbolName201
+    .long 0x001038b2, .LsymbolName202
+    .long 0x001038f2, .LsymbolName203
+    .long 0x001039ba, .LsymbolName204
+    .long 0x00103a88, .LsymbolName205
+    .long 0x00103aa2, .LsymbolName206
+    .long 0x00103bc8, .LsymbolName207
+    .long 0x00103eae, .LsymbolName208
+    .long 0x00103f8e, .LsymbolName209
+    .long 0x00104114, .LsymbolName210
+    .long 0x00104260, .LsymbolName211
+    .long 0x00104260, .LsymbolName212
+    .long 0x001042e0, .LsymbolName213
+    .long 0x001042e0, .LsymbolName214
+    .long 0x001042f0, .LsymbolName215
+    .long 0x0010430e, .LsymbolName216
+    .long 0x00104330, .LsymbolName217
+    .long 0x00104350, .LsymbolName218
+    .long 0x00104384, .LsymbolName219
+    .long 0x00104384, .LsymbolName220
+    .long 0x00104416, .LsymbolName221
+    .long 0x00104416, .LsymbolName222
+    .long 0x00104426, .LsymbolName223
+    .long 0x00104454, .LsymbolName224
+    .long 0x00104486, .LsymbolName225
+    .long 0x001044c0, .LsymbolName226
+    .long 0x0010455a, .LsymbolName227
+    .long 0x001045a8, .LsymbolName228
+    .long 0x001045a8, .LsymbolName229
+    .long 0x001047f8, .LsymbolName230
+    .long 0x001047f8, .LsymbolName231
+    .long 0x0010481e, .LsymbolName232
+    .long 0x0010483c, .LsymbolName233
+    .long 0x00104854, .LsymbolName234
+    .long 0x00104866, .LsymbolName235
+    .long 0x001048d4, .LsymbolName236
+    .long 0x00104932, .LsymbolName237
+    .long 0x001049c2, .LsymbolName238
+    .long 0x00104a40, .LsymbolName239
+    .long 0x00104a95, .LsymbolName240
+    .long 0x00104a9a, .LsymbolName241
+    .long 0x00104b22, .LsymbolName242
+    .long 0x00104b40, .LsymbolName243
+    .long 0x00104b40, .LsymbolName244
+    .long 0x00104b98, .LsymbolName245
+    .long 0x00104b98, .LsymbolName246
+    .long 0x00104bcc, .LsymbolName247
+    .long 0x00104e44, .LsymbolName248
+    .long 0x00104e9e, .LsymbolName249
+    .long 0x00104f6b, .LsymbolName250
+    .long 0x00104fef, .LsymbolName251
+    .long 0x00105070, .LsymbolName252
+    .long 0x00105080, .LsymbolName253
+    .long 0x00105090, .LsymbolName254
+    .long 0x001050a0, .LsymbolName255
+    .long 0x001050b9, .LsymbolName256
+    .long 0x001050d2, .LsymbolName257
+    .long 0x001050f7, .LsymbolName258
+    .long 0x00105178, .LsymbolName259
+    .long 0x00105198, .LsymbolName260
+    .long 0x001051b8, .LsymbolName261
+    .long 0x001051e2, .LsymbolName262
+    .long 0x0010520c, .LsymbolName263
+    .long 0x0010523b, .LsymbolName264
+    .long 0x00105265, .LsymbolName265
+    .long 0x00105290, .LsymbolName266
+    .long 0x001052be, .LsymbolName267
+    .long 0x001052eb, .LsymbolName268
+    .long 0x00105316, .LsymbolName269
+    .long 0x0010532c, .LsymbolName270
+    .long 0x0010534c, .LsymbolName271
+    .long 0x0010536c, .LsymbolName272
+    .long 0x001053da, .LsymbolName273
+    .long 0x00105410, .LsymbolName274
+    .long 0x0010544c, .LsymbolName275
+    .long 0x0010544c, .LsymbolName276
+    .long 0x0010558e, .LsymbolName277
+    .long 0x0010558e, .LsymbolName278
+    .long 0x00105630, .LsymbolName279
+    .long 0x001057ac, .LsymbolName280
+    .long 0x00105906, .LsymbolName281
+    .long 0x00105a2a, .LsymbolName282
+    .long 0x00105a88, .LsymbolName283
+    .long 0x00105d38, .LsymbolName284
+    .long 0x00105e46, .LsymbolName285
+    .long 0x00105e92, .LsymbolName286
+    .long 0x00105ea8, .LsymbolName287
+    .long 0x00105f16, .LsymbolName288
+    .long 0x00105f58, .LsymbolName289
+    .long 0x0010600c, .LsymbolName290
+    .long 0x00106022, .LsymbolName291
+    .long 0x00106022, .LsymbolName292
+    .long 0x0010603e, .LsymbolName293
+    .long 0x0010603e, .LsymbolName294
+    .long 0x0010605a, .LsymbolName295
+    .long 0x0010606e, .LsymbolName296
+    .long 0x00106082, .LsymbolName297
+    .long 0x00106096, .LsymbolName298
+    .long 0x001060aa, .LsymbolName299
+    .long 0x001060be, .LsymbolName300
+    .long 0x001060be, .LsymbolName301
+    .long 0x0010625e, .LsymbolName302
+    .long 0x0010625e, .LsymbolName303
+    .long 0x00106344, .LsymbolName304
+    .long 0x001064b6, .LsymbolName305
+    .long 0x001064d0, .LsymbolName306
+    .long 0x001064e6, .LsymbolName307
+    .long 0x00106574, .LsymbolName308
+    .long 0x00106600, .LsymbolName309
+    .long 0x00106718, .LsymbolName310
+    .long 0x00106724, .LsymbolName311
+    .long 0x00106750, .LsymbolName312
+    .long 0x0010677f, .LsymbolName313
+    .long 0x001067ad, .LsymbolName314
+    .long 0x001067db, .LsymbolName315
+    .long 0x00106802, .LsymbolName316
+    .long 0x001068f2, .LsymbolName317
+    .long 0x001069c0, .LsymbolName318
+    .long 0x00106a22, .LsymbolName319
+    .long 0x00106ae8, .LsymbolName320
+    .long 0x00106b32, .LsymbolName321
+    .long 0x00106d04, .LsymbolName322
+    .long 0x00106e28, .LsymbolName323
+    .long 0x00106eb0, .LsymbolName324
+    .long 0x00106fb4, .LsymbolName325
+    .long 0x00106ffa, .LsymbolName326
+    .long 0x00106ffa, .LsymbolName327
+    .long 0x0010724a, .LsymbolName328
+    .long 0x0010724a, .LsymbolName329
+    .long 0x00107270, .LsymbolName330
+    .long 0x001072da, .LsymbolName331
+    .long 0x0010737e, .LsymbolName332
+    .long 0x001073de, .LsymbolName333
+    .long 0x0010743e, .LsymbolName334
+    .long 0x00107454, .LsymbolName335
+    .long 0x00107468, .LsymbolName336
+    .long 0x0010747e, .LsymbolName337
+    .long 0x00107558, .LsymbolName338
+    .long 0x00107686, .LsymbolName339
+    .long 0x001076b2, .LsymbolName340
+    .long 0x00107776, .LsymbolName341
+    .long 0x001077e8, .LsymbolName342
+    .long 0x0010783c, .LsymbolName343
+    .long 0x00107876, .LsymbolName344
+    .long 0x0010792c, .LsymbolName345
+    .long 0x00107a1c, .LsymbolName346
+    .long 0x00107a9c, .LsymbolName347
+    .long 0x00107b68, .LsymbolName348
+    .long 0x00107d1a, .LsymbolName349
+    .long 0x00107e60, .LsymbolName350
+    .long 0x00107f6e, .LsymbolName351
+    .long 0x00107f84, .LsymbolName352
+    .long 0x00107f9a, .LsymbolName353
+    .long 0x00107f9a, .LsymbolName354
+    .long 0x00108166, .LsymbolName355
+    .long 0x00108166, .LsymbolName356
+    .long 0x0010818c, .LsymbolName357
+    .long 0x001081c0, .LsymbolName358
+    .long 0x0010821c, .LsymbolName359
+    .long 0x001082b4, .LsymbolName360
+    .long 0x0010849c, .LsymbolName361
+    .long 0x00108582, .LsymbolName362
+    .long 0x001086f2, .LsymbolName363
+    .long 0x00108830, .LsymbolName364
+    .long 0x0010887c, .LsymbolName365
+    .long 0x00108ac0, .LsymbolName366
+    .long 0x00108b86, .LsymbolName367
+    .long 0x00108c08, .LsymbolName368
+    .long 0x00108ea4, .LsymbolName369
+    .long 0x0010929e, .LsymbolName370
+    .long 0x001095da, .LsymbolName371
+    .long 0x00109780, .LsymbolName372
+    .long 0x001098c0, .LsymbolName373
+    .long 0x001099d4, .LsymbolName374
+    .long 0x00109a8a, .LsymbolName375
+    .long 0x00109aa2, .LsymbolName376
+    .long 0x00109aba, .LsymbolName377
+    .long 0x00109ad2, .LsymbolName378
+    .long 0x00109aea, .LsymbolName379
+    .long 0x00109b02, .LsymbolName380
+    .long 0x00109b06, .LsymbolName381
+    .long 0x00109b1e, .LsymbolName382
+    .long 0x00109b50, .LsymbolName383
+    .long 0x00109bd0, .LsymbolName384
+    .long 0x00109c10, .LsymbolName385
+    .long 0x00109c10, .LsymbolName386
+    .long 0x00109cf0, .LsymbolName387
+    .long 0x00109cf0, .LsymbolName388
+    .long 0x00109d7e, .LsymbolName389
+    .long 0x00109d96, .LsymbolName390
+    .long 0x00109dae, .LsymbolName391
+    .long 0x00109e24, .LsymbolName392
+    .long 0x00109e3a, .LsymbolName393
+    .long 0x00109e82, .LsymbolName394
+    .long 0x00109ed4, .LsymbolName395
+    .long 0x00109f10, .LsymbolName396
+    .long 0x0010a062, .LsymbolName397
+    .long 0x0010a12f, .LsymbolName398
+    .long 0x0010a184, .LsymbolName399
+    .long 0x0010a312, .LsymbolName400
+    .long 0x0010a599, .LsymbolName401
+    .long 0x0010a64f, .LsymbolName402
+    .long 0x0010a73c, .LsymbolName403
+    .long 0x0010aaec, .LsymbolName404
+    .long 0x0010ac2e, .LsymbolName405
+    .long 0x0010ac2e, .LsymbolName406
+    .long 0x0010ad20, .LsymbolName407
+    .long 0x0010ad20, .LsymbolName408
+    .long 0x0010ad9c, .LsymbolName409
+    .long 0x0010adba, .LsymbolName410
+    .long 0x0010add0, .LsymbolName411
+    .long 0x0010ae22, .LsymbolName412
+    .long 0x0010af2c, .LsymbolName413
+    .long 0x0010b004, .LsymbolName414
+    .long 0x0010b1a2, .LsymbolName415
+    .long 0x0010b364, .LsymbolName416
+    .long 0x0010b3ca, .LsymbolName417
+    .long 0x0010b45a, .LsymbolName418
+    .long 0x0010b556, .LsymbolName419
+    .long 0x0010b59e, .LsymbolName420
+    .long 0x0010b65e, .LsymbolName421
+    .long 0x0010b694, .LsymbolName422
+    .long 0x0010ba40, .LsymbolName423
+    .long 0x0010ba40, .LsymbolName424
+    .long 0x0010ba62, .LsymbolName425
+    .long 0x0010ba62, .LsymbolName426
+    .long 0x0010ba72, .LsymbolName427
+    .long 0x0010bb68, .LsymbolName428
+    .long 0x0010bb80, .LsymbolName429
+    .long 0x0010bcfc, .LsymbolName430
+    .long 0x0010bdb6, .LsymbolName431
+    .long 0x0010bdb6, .LsymbolName432
+    .long 0x0010bdc6, .LsymbolName433
+    .long 0x0010bdc6, .LsymbolName434
+    .long 0x0010bde0, .LsymbolName435
+    .long 0x0010bde0, .LsymbolName436
+    .long 0x0010be02, .LsymbolName437
+    .long 0x0010be02, .LsymbolName438
+    .long 0x0010be28, .LsymbolName439
+    .long 0x0010bff0, .LsymbolName440
+    .long 0x0010c0e8, .LsymbolName441
+    .long 0x0010c13a, .LsymbolName442
+    .long 0x0010c4da, .LsymbolName443
+    .long 0x0010c566, .LsymbolName444
+    .long 0x0010c730, .LsymbolName445
+    .long 0x0010c78c, .LsymbolName446
+    .long 0x0010c7e2, .LsymbolName447
+    .long 0x0010c804, .LsymbolName448
+    .long 0x0010c822, .LsymbolName449
+    .long 0x0010c822, .LsymbolName450
+    .long 0x0010c8d6, .LsymbolName451
+    .long 0x0010c8d6, .LsymbolName452
+    .long 0x0010ca58, .LsymbolName453
+    .long 0x0010ca58, .LsymbolName454
+    .long 0x0010cad4, .LsymbolName455
+    .long 0x0010cafa, .LsymbolName456
+    .long 0x0010cb8e, .LsymbolName457
+    .long 0x0010cc12, .LsymbolName458
+    .long 0x0010cc88, .LsymbolName459
+    .long 0x0010cd0c, .LsymbolName460
+    .long 0x0010cd4a, .LsymbolName461
+    .long 0x0010cd60, .LsymbolName462
+    .long 0x0010cd76, .LsymbolName463
+    .long 0x0010ce9a, .LsymbolName464
+    .long 0x0010cf94, .LsymbolName465
+    .long 0x0010d0af, .LsymbolName466
+    .long 0x0010d133, .LsymbolName467
+    .long 0x0010d1bc, .LsymbolName468
+    .long 0x0010d588, .LsymbolName469
+    .long 0x0010d588, .LsymbolName470
+    .long 0x0010d5f6, .LsymbolName471
+    .long 0x0010d5f6, .LsymbolName472
+    .long 0x0010d63e, .LsymbolName473
+    .long 0x0010d68a, .LsymbolName474
+    .long 0x0010d6ce, .LsymbolName475
+    .long 0x0010d724, .LsymbolName476
+    .long 0x0010d760, .LsymbolName477
+    .long 0x0010d824, .LsymbolName478
+    .long 0x0010d8a8, .LsymbolName479
+    .long 0x0010d9e0, .LsymbolName480
+    .long 0x0010d9e0, .LsymbolName481
+    .long 0x0010da34, .LsymbolName482
+    .long 0x0010da34, .LsymbolName483
+    .long 0x0010da7c, .LsymbolName484
+    .long 0x0010da7c, .LsymbolName485
+    .long 0x0010da8c, .LsymbolName486
+    .long 0x0010da8c, .LsymbolName487
+    .long 0x0010dc00, .LsymbolName488
+    .long 0x0010dc00, .LsymbolName489
+    .long 0x0010dc7e, .LsymbolName490
+    .long 0x0010dd16, .LsymbolName491
+    .long 0x0010de2e, .LsymbolName492
+    .long 0x0010df28, .LsymbolName493
+    .long 0x0010df42, .LsymbolName494
+    .long 0x0010df86, .LsymbolName495
+    .long 0x0010e032, .LsymbolName496
+    .long 0x0010e0f4, .LsymbolName497
+    .long 0x0010e3e0, .LsymbolName498
+    .long 0x0010e40a, .LsymbolName499
+    .long 0x0010e45a, .LsymbolName500
+    .long 0x0010e502, .LsymbolName501
+    .long 0x0010e5c8, .LsymbolName502
+    .long 0x0010e7d6, .LsymbolName503
+    .long 0x0010e8bc, .LsymbolName504
+    .long 0x0010e9a0, .LsymbolName505
+    .long 0x0010ea66, .LsymbolName506
+    .long 0x0010ed80, .LsymbolName507
+    .long 0x0010f046, .LsymbolName508
+    .long 0x0010f0f8, .LsymbolName509
+    .long 0x0010f274, .LsymbolName510
+    .long 0x0010f318, .LsymbolName511
+    .long 0x0010f3a0, .LsymbolName512
+    .long 0x0010f820, .LsymbolName513
+    .long 0x0010f96e, .LsymbolName514
+    .long 0x0010f96e, .LsymbolName515
+    .long 0x0010fa50, .LsymbolName516
+    .long 0x0010fa50, .LsymbolName517
+    .long 0x0010fa60, .LsymbolName518
+    .long 0x0010fa60, .LsymbolName519
+    .long 0x0010fa8a, .LsymbolName520
+    .long 0x0010fa8a, .LsymbolName521
+    .long 0x0010fa9a, .LsymbolName522
+    .long 0x0010fae8, .LsymbolName523
+    .long 0x0010fb94, .LsymbolName524
+    .long 0x0010fb94, .LsymbolName525
+    .long 0x0010fbb0, .LsymbolName526
+    .long 0x0010fbc0, .LsymbolName527
+    .long 0x0010fbd0, .LsymbolName528
+    .long 0x0010fbd0, .LsymbolName529
+    .long 0x0010fc56, .LsymbolName530
+    .long 0x0010fc56, .LsymbolName531
+    .long 0x0010fcca, .LsymbolName532
+    .long 0x0010fe41, .LsymbolName533
+    .long 0x0010fe4c, .LsymbolName534
+    .long 0x0010feb5, .LsymbolName535
+    .long 0x0010feda, .LsymbolName536
+    .long 0x0010feff, .LsymbolName537
+    .long 0x0010ff24, .LsymbolName538
+    .long 0x0010ff49, .LsymbolName539
+    .long 0x0010ff6e, .LsymbolName540
+    .long 0x0010ff93, .LsymbolName541
+    .long 0x0010ffb8, .LsymbolName542
+    .long 0x0010ffdd, .LsymbolName543
+    .long 0x00110002, .LsymbolName544
+    .long 0x00110027, .LsymbolName545
+    .long 0x0011004c, .LsymbolName546
+    .long 0x00110071, .LsymbolName547
+    .long 0x001100c6, .LsymbolName548
+    .long 0x0011011b, .LsymbolName549
+    .long 0x00110170, .LsymbolName550
+    .long 0x001101c5, .LsymbolName551
+    .long 0x0011021a, .LsymbolName552
+    .long 0x0011026f, .LsymbolName553
+    .long 0x001102c4, .LsymbolName554
+    .long 0x00110319, .LsymbolName555
+    .long 0x0011036e, .LsymbolName556
+    .long 0x001103c3, .LsymbolName557
+    .long 0x00110418, .LsymbolName558
+    .long 0x0011046d, .LsymbolName559
+    .long 0x001104c2, .LsymbolName560
+    .long 0x00110517, .LsymbolName561
+    .long 0x0011056c, .LsymbolName562
+    .long 0x001105c1, .LsymbolName563
+    .long 0x00110616, .LsymbolName564
+    .long 0x0011066b, .LsymbolName565
+    .long 0x001106c0, .LsymbolName566
+    .long 0x00110715, .LsymbolName567
+    .long 0x0011076a, .LsymbolName568
+    .long 0x001107bf, .LsymbolName569
+    .long 0x00110814, .LsymbolName570
+    .long 0x00110869, .LsymbolName571
+    .long 0x001108be, .LsymbolName572
+    .long 0x00110913, .LsymbolName573
+    .long 0x00110968, .LsymbolName574
+    .long 0x001109bd, .LsymbolName575
+    .long 0x00110a12, .LsymbolName576
+    .long 0x00110a67, .LsymbolName577
+    .long 0x00110abc, .LsymbolName578
+    .long 0x00110b11, .LsymbolName579
+    .long 0x00110b66, .LsymbolName580
+    .long 0x00110bbb, .LsymbolName581
+    .long 0x00110c10, .LsymbolName582
+    .long 0x00110c65, .LsymbolName583
+    .long 0x00110cba, .LsymbolName584
+    .long 0x00110d0f, .LsymbolName585
+    .long 0x00110d64, .LsymbolName586
+    .long 0x00110db9, .LsymbolName587
+    .long 0x00110e0e, .LsymbolName588
+    .long 0x00110e63, .LsymbolName589
+    .long 0x00110eb8, .LsymbolName590
+    .long 0x00110f0d, .LsymbolName591
+    .long 0x00110f62, .LsymbolName592
+    .long 0x00110fb7, .LsymbolName593
+    .long 0x0011100c, .LsymbolName594
+    .long 0x00111031, .LsymbolName595
+    .long 0x00111056, .LsymbolName596
+    .long 0x0011107b, .LsymbolName597
+    .long 0x001110a0, .LsymbolName598
+    .long 0x001110c5, .LsymbolName599
+    .long 0x001110ea, .LsymbolName600
+    .long 0x0011110f, .LsymbolName601
+    .long 0x00111124, .LsymbolName602
+    .long 0x00111149, .LsymbolName603
+    .long 0x0011116e, .LsymbolName604
+    .long 0x00111193, .LsymbolName605
+    .long 0x001111b8, .LsymbolName606
+    .long 0x001111dd, .LsymbolName607
+    .long 0x00111202, .LsymbolName608
+    .long 0x00111227, .LsymbolName609
+    .long 0x0011124c, .LsymbolName610
+    .long 0x00111271, .LsymbolName611
+    .long 0x00111296, .LsymbolName612
+    .long 0x001112bb, .LsymbolName613
+    .long 0x001112e0, .LsymbolName614
+    .long 0x00111305, .LsymbolName615
+    .long 0x00111327, .LsymbolName616
+    .long 0x00111349, .LsymbolName617
+    .long 0x0011135b, .LsymbolName618
+    .long 0x0011136d, .LsymbolName619
+    .long 0x0011139b, .LsymbolName620
+    .long 0x001113a8, .LsymbolName621
+    .long 0x001113a8, .LsymbolName622
+    .long 0x001113c4, .LsymbolName623
+    .long 0x001113d4, .LsymbolName624
+    .long 0x001113ee, .LsymbolName625
+    .long 0x00111408, .LsymbolName626
+    .long 0x00111418, .LsymbolName627
+    .long 0x00111418, .LsymbolName628
+    .long 0x0011149e, .LsymbolName629
+    .long 0x0011149e, .LsymbolName630
+    .long 0x00111512, .LsymbolName631
+    .long 0x0011168a, .LsymbolName632
+    .long 0x00111694, .LsymbolName633
+    .long 0x0011185c, .LsymbolName634
+    .long 0x0011185c, .LsymbolName635
+    .long 0x0011197c, .LsymbolName636
+    .long 0x0011197c, .LsymbolName637
+    .long 0x00111a66, .LsymbolName638
+    .long 0x00111ef2, .LsymbolName639
+    .long 0x00111f26, .LsymbolName640
+    .long 0x00111fe8, .LsymbolName641
+    .long 0x00112084, .LsymbolName642
+    .long 0x001120ec, .LsymbolName643
+    .long 0x001121ae, .LsymbolName644
+    .long 0x00112214, .LsymbolName645
+    .long 0x001122a2, .LsymbolName646
+    .long 0x001122a2, .LsymbolName647
+    .long 0x001122be, .LsymbolName648
+    .long 0x001122be, .LsymbolName649
+    .long 0x001122da, .LsymbolName650
+    .long 0x0011236a, .LsymbolName651
+    .long 0x001123ce, .LsymbolName652
+    .long 0x0011247c, .LsymbolName653
+    .long 0x00112492, .LsymbolName654
+    .long 0x001124a2, .LsymbolName655
+    .long 0x001124b2, .LsymbolName656
+    .long 0x001124c6, .LsymbolName657
+    .long 0x001124ea, .LsymbolName658
+    .long 0x001124fa, .LsymbolName659
+    .long 0x001124fa, .LsymbolName660
+    .long 0x0011253a, .LsymbolName661
+    .long 0x0011253a, .LsymbolName662
+    .long 0x00112562, .LsymbolName663
+    .long 0x00112578, .LsymbolName664
+    .long 0x001125c8, .LsymbolName665
+    .long 0x00112602, .LsymbolName666
+    .long 0x0011263e, .LsymbolName667
+    .long 0x0011267a, .LsymbolName668
+    .long 0x0011267a, .LsymbolName669
+    .long 0x001126c2, .LsymbolName670
+    .long 0x001126c2, .LsymbolName671
+    .long 0x001126ea, .LsymbolName672
+    .long 0x00112700, .LsymbolName673
+    .long 0x00112722, .LsymbolName674
+    .long 0x00112744, .LsymbolName675
+    .long 0x001127e4, .LsymbolName676
+    .long 0x00112820, .LsymbolName677
+    .long 0x00112854, .LsymbolName678
+    .long 0x00112854, .LsymbolName679
+    .long 0x001128f2, .LsymbolName680
+    .long 0x001128f2, .LsymbolName681
+    .long 0x0011291a, .LsymbolName682
+    .long 0x00112930, .LsymbolName683
+    .long 0x00112952, .LsymbolName684
+    .long 0x001129a0, .LsymbolName685
+    .long 0x00112a5e, .LsymbolName686
+    .long 0x00112adc, .LsymbolName687
+    .long 0x00112bb4, .LsymbolName688
+    .long 0x00112c2c, .LsymbolName689
+    .long 0x00112d96, .LsymbolName690
+    .long 0x00112dde, .LsymbolName691
+    .long 0x00112e66, .LsymbolName692
+    .long 0x00112e66, .LsymbolName693
+    .long 0x0011302e, .LsymbolName694
+    .long 0x0011302e, .LsymbolName695
+    .long 0x00113058, .LsymbolName696
+    .long 0x00113138, .LsymbolName697
+    .long 0x00113164, .LsymbolName698
+    .long 0x00113230, .LsymbolName699
+    .long 0x00113366, .LsymbolName700
+    .long 0x00113524, .LsymbolName701
+    .long 0x001135b0, .LsymbolName702
+    .long 0x00113798, .LsymbolName703
+    .long 0x001139b8, .LsymbolName704
+    .long 0x001139de, .LsymbolName705
+    .long 0x001139ee, .LsymbolName706
+    .long 0x001139fe, .LsymbolName707
+    .long 0x00113b5a, .LsymbolName708
+    .long 0x00113bd4, .LsymbolName709
+    .long 0x00113c46, .LsymbolName710
+    .long 0x00113cb8, .LsymbolName711
+    .long 0x00113d22, .LsymbolName712
+    .long 0x00113d60, .LsymbolName713
+    .long 0x00113dba, .LsymbolName714
+    .long 0x00113e30, .LsymbolName715
+    .long 0x00113e46, .LsymbolName716
+    .long 0x00113e5c, .LsymbolName717
+    .long 0x00113e74, .LsymbolName718
+    .long 0x00113e8c, .LsymbolName719
+    .long 0x00113f30, .LsymbolName720
+    .long 0x00113f90, .LsymbolName721
+    .long 0x0011411a, .LsymbolName722
+    .long 0x0011411a, .LsymbolName723
+    .long 0x0011425a, .LsymbolName724
+    .long 0x0011425a, .LsymbolName725
+    .long 0x00114340, .LsymbolName726
+    .long 0x00114366, .LsymbolName727
+    .long 0x00114390, .LsymbolName728
+    .long 0x0011441c, .LsymbolName729
+    .long 0x001144fa, .LsymbolName730
+    .long 0x001147a6, .LsymbolName731
+    .long 0x001149de, .LsymbolName732
+    .long 0x00114a5c, .LsymbolName733
+    .long 0x00114c3e, .LsymbolName734
+    .long 0x00114de8, .LsymbolName735
+    .long 0x00114eea, .LsymbolName736
+    .long 0x00114fe4, .LsymbolName737
+    .long 0x001151ae, .LsymbolName738
+    .long 0x001152e0, .LsymbolName739
+    .long 0x001153fe, .LsymbolName740
+    .long 0x00115420, .LsymbolName741
+    .long 0x00115796, .LsymbolName742
+    .long 0x001157b0, .LsymbolName743
+    .long 0x001157c7, .LsymbolName744
+    .long 0x0011581e, .LsymbolName745
+    .long 0x0011581e, .LsymbolName746
+    .long 0x001158e0, .LsymbolName747
+    .long 0x001158e0, .LsymbolName748
+    .long 0x0011599a, .LsymbolName749
+    .long 0x00115a54, .LsymbolName750
+    .long 0x00115d9a, .LsymbolName751
+    .long 0x00115db2, .LsymbolName752
+    .long 0x00115de2, .LsymbolName753
+    .long 0x00115e74, .LsymbolName754
+    .long 0x00115e7e, .LsymbolName755
+    .long 0x00115e93, .LsymbolName756
+    .long 0x00115ead, .LsymbolName757
+    .long 0x00115ec7, .LsymbolName758
+    .long 0x00115ee0, .LsymbolName759
+    .long 0x00115f07, .LsymbolName760
+    .long 0x00115f30, .LsymbolName761
+    .long 0x00115f4e, .LsymbolName762
+    .long 0x00115f4e, .LsymbolName763
+    .long 0x00116166, .LsymbolName764
+    .long 0x00116166, .LsymbolName765
+    .long 0x001161f0, .LsymbolName766
+    .long 0x0011622e, .LsymbolName767
+    .long 0x00116276, .LsymbolName768
+    .long 0x0011628c, .LsymbolName769
+    .long 0x001162a2, .LsymbolName770
+    .long 0x001162b8, .LsymbolName771
+    .long 0x001162ce, .LsymbolName772
+    .long 0x00116642, .LsymbolName773
+    .long 0x0011671e, .LsymbolName774
+    .long 0x001167c0, .LsymbolName775
+    .long 0x00116888, .LsymbolName776
+    .long 0x001168b2, .LsymbolName777
+    .long 0x00116918, .LsymbolName778
+    .long 0x0011692e, .LsymbolName779
+    .long 0x00116944, .LsymbolName780
+    .long 0x0011695a, .LsymbolName781
+    .long 0x0011695a, .LsymbolName782
+    .long 0x001169d6, .LsymbolName783
+    .long 0x001169d6, .LsymbolName784
+    .long 0x001169e6, .LsymbolName785
+    .long 0x00116d92, .LsymbolName786
+    .long 0x00116f14, .LsymbolName787
+    .long 0x00116f2a, .LsymbolName788
+    .long 0x00116fdc, .LsymbolName789
+    .long 0x00117126, .LsymbolName790
+    .long 0x00117170, .LsymbolName791
+    .long 0x001171c4, .LsymbolName792
+    .long 0x00117226, .LsymbolName793
+    .long 0x00117288, .LsymbolName794
+    .long 0x001172b6, .LsymbolName795
+    .long 0x001172e4, .LsymbolName796
+    .long 0x00117354, .LsymbolName797
+    .long 0x001173c6, .LsymbolName798
+    .long 0x00117436, .LsymbolName799
+    .long 0x0011751a, .LsymbolName800
+    .long 0x0011756e, .LsymbolName801
+    .long 0x001175a4, .LsymbolName802
+    .long 0x00117608, .LsymbolName803
+    .long 0x001179e6, .LsymbolName804
+    .long 0x00117aa2, .LsymbolName805
+    .long 0x00117b1e, .LsymbolName806
+    .long 0x00117c9c, .LsymbolName807
+    .long 0x00117c9c, .LsymbolName808
+    .long 0x00117cee, .LsymbolName809
+    .long 0x00117cee, .LsymbolName810
+    .long 0x00117d22, .LsymbolName811
+    .long 0x00117d6e, .LsymbolName812
+    .long 0x00117dac, .LsymbolName813
+    .long 0x00117dac, .LsymbolName814
+    .long 0x00117ee2, .LsymbolName815
+    .long 0x00117ee2, .LsymbolName816
+    .long 0x00118008, .LsymbolName817
+    .long 0x0011865e, .LsymbolName818
+    .long 0x001186dc, .LsymbolName819
+    .long 0x001188b0, .LsymbolName820
+    .long 0x00118b10, .LsymbolName821
+    .long 0x00118bee, .LsymbolName822
+    .long 0x00118c72, .LsymbolName823
+    .long 0x00118d9c, .LsymbolName824
+    .long 0x00118da6, .LsymbolName825
+    .long 0x00118e49, .LsymbolName826
+    .long 0x00118e54, .LsymbolName827
+    .long 0x00118f2a, .LsymbolName828
+    .long 0x00118faa, .LsymbolName829
+    .long 0x00118fea, .LsymbolName830
+    .long 0x00118ff2, .LsymbolName831
+    .long 0x0011900c, .LsymbolName832
+    .long 0x00119024, .LsymbolName833
+    .long 0x00119024, .LsymbolName834
+    .long 0x001190f4, .LsymbolName835
+    .long 0x001190f4, .LsymbolName836
+    .long 0x00119138, .LsymbolName837
+    .long 0x0011914e, .LsymbolName838
+    .long 0x001193a0, .LsymbolName839
+    .long 0x001193bc, .LsymbolName840
+    .long 0x001195ae, .LsymbolName841
+    .long 0x0011967c, .LsymbolName842
+    .long 0x00119728, .LsymbolName843
+    .long 0x00119784, .LsymbolName844
+    .long 0x00119800, .LsymbolName845
+    .long 0x001198aa, .LsymbolName846
+    .long 0x0011994c, .LsymbolName847
+    .long 0x001199c0, .LsymbolName848
+    .long 0x001199f8, .LsymbolName849
+    .long 0x00119a1c, .LsymbolName850
+    .long 0x00119a1c, .LsymbolName851
+    .long 0x00119cc8, .LsymbolName852
+    .long 0x00119cc8, .LsymbolName853
+    .long 0x00119dea, .LsymbolName854
+    .long 0x00119e70, .LsymbolName855
+    .long 0x00119eba, .LsymbolName856
+    .long 0x00119f41, .LsymbolName857
+    .long 0x00119fe6, .LsymbolName858
+    .long 0x0011a2e2, .LsymbolName859
+    .long 0x0011a2fc, .LsymbolName860
+    .long 0x0011a314, .LsymbolName861
+    .long 0x0011a648, .LsymbolName862
+    .long 0x0011a672, .LsymbolName863
+    .long 0x0011a720, .LsymbolName864
+    .long 0x0011a85e, .LsymbolName865
+    .long 0x0011a8ba, .LsymbolName866
+    .long 0x0011a8ee, .LsymbolName867
+    .long 0x0011ac0a, .LsymbolName868
+    .long 0x0011b072, .LsymbolName869
+    .long 0x0011b41c, .LsymbolName870
+    .long 0x0011b484, .LsymbolName871
+    .long 0x0011b4da, .LsymbolName872
+    .long 0x0011b530, .LsymbolName873
+    .long 0x0011b586, .LsymbolName874
+    .long 0x0011b5f0, .LsymbolName875
+    .long 0x0011b78c, .LsymbolName876
+    .long 0x0011b796, .LsymbolName877
+    .long 0x0011b7e2, .LsymbolName878
+    .long 0x0011b80a, .LsymbolName879
+    .long 0x0011b812, .LsymbolName880
+    .long 0x0011b9dd, .LsymbolName881
+    .long 0x0011b9e8, .LsymbolName882
+    .long 0x0011bbcc, .LsymbolName883
+    .long 0x0011bbd6, .LsymbolName884
+    .long 0x0011bc2a, .LsymbolName885
+    .long 0x0011bc32, .LsymbolName886
+    .long 0x0011bc32, .LsymbolName887
+    .long 0x0011bc6a, .LsymbolName888
+    .long 0x0011bc6a, .LsymbolName889
+    .long 0x0011bc9c, .LsymbolName890
+    .long 0x0011bcb0, .LsymbolName891
+    .long 0x0011bce5, .LsymbolName892
+    .long 0x0011bd24, .LsymbolName893
+    .long 0x0011bd24, .LsymbolName894
+    .long 0x0011c530, .LsymbolName895
+    .long 0x0011c530, .LsymbolName896
+    .long 0x0011c632, .LsymbolName897
+    .long 0x0011c7ca, .LsymbolName898
+    .long 0x0011c834, .LsymbolName899
+    .long 0x0011c9c9, .LsymbolName900
+    .long 0x0011c9d4, .LsymbolName901
+    .long 0x0011cb38, .LsymbolName902
+    .long 0x0011cb72, .LsymbolName903
+    .long 0x0011cb7a, .LsymbolName904
+    .long 0x0011cd42, .LsymbolName905
+    .long 0x0011cd5e, .LsymbolName906
+    .long 0x0011cd80, .LsymbolName907
+    .long 0x0011cd9c, .LsymbolName908
+    .long 0x0011cdb4, .LsymbolName909
+    .long 0x0011cdb4, .LsymbolName910
+    .long 0x0011ce4a, .LsymbolName911
+    .long 0x0011ce4a, .LsymbolName912
+    .long 0x0011ce66, .LsymbolName913
+    .long 0x0011cea2, .LsymbolName914
+    .long 0x0011cf06, .LsymbolName915
+    .long 0x0011cfa2, .LsymbolName916
+    .long 0x0011cffa, .LsymbolName917
+    .long 0x0011d036, .LsymbolName918
+    .long 0x0011d050, .LsymbolName919
+    .long 0x0011d060, .LsymbolName920
+    .long 0x0011d060, .LsymbolName921
+    .long 0x0011d0dc, .LsymbolName922
+    .long 0x0011d0dc, .LsymbolName923
+    .long 0x0011d104, .LsymbolName924
+    .long 0x0011d14e, .LsymbolName925
+    .long 0x0011d194, .LsymbolName926
+    .long 0x0011d1fe, .LsymbolName927
+    .long 0x0011d2cc, .LsymbolName928
+    .long 0x0011d39a, .LsymbolName929
+    .long 0x0011d55e, .LsymbolName930
+    .long 0x0011d5a0, .LsymbolName931
+    .long 0x0011d5e6, .LsymbolName932
+    .long 0x0011d5e6, .LsymbolName933
+    .long 0x0011d656, .LsymbolName934
+    .long 0x0011d656, .LsymbolName935
+    .long 0x0011d68a, .LsymbolName936
+    .long 0x0011d6d0, .LsymbolName937
+    .long 0x0011d710, .LsymbolName938
+    .long 0x0011d77a, .LsymbolName939
+    .long 0x0011d80c, .LsymbolName940
+    .long 0x0011d80c, .LsymbolName941
+    .long 0x0011d8c0, .LsymbolName942
+    .long 0x0011d8c0, .LsymbolName943
+    .long 0x0011d902, .LsymbolName944
+    .long 0x0011da44, .LsymbolName945
+    .long 0x0011da8d, .LsymbolName946
+    .long 0x0011da98, .LsymbolName947
+    .long 0x0011dae1, .LsymbolName948
+    .long 0x0011daec, .LsymbolName949
+    .long 0x0011dbd5, .LsymbolName950
+    .long 0x0011dbe2, .LsymbolName951
+    .long 0x0011dbe6, .LsymbolName952
+    .long 0x0011dbe6, .LsymbolName953
+    .long 0x0011dc18, .LsymbolName954
+    .long 0x0011dc18, .LsymbolName955
+    .long 0x0011dc4c, .LsymbolName956
+    .long 0x0011dd2c, .LsymbolName957
+    .long 0x0011dde0, .LsymbolName958
+    .long 0x0011dde0, .LsymbolName959
+    .long 0x0011de52, .LsymbolName960
+    .long 0x0011de52, .LsymbolName961
+    .long 0x0011de86, .LsymbolName962
+    .long 0x0011e01a, .LsymbolName963
+    .long 0x0011e036, .LsymbolName964
+    .long 0x0011e036, .LsymbolName965
+    .long 0x0011e150, .LsymbolName966
+    .long 0x0011e150, .LsymbolName967
+    .long 0x0011e160, .LsymbolName968
+    .long 0x0011e2bc, .LsymbolName969
+    .long 0x0011e59c, .LsymbolName970
+    .long 0x0011e60c, .LsymbolName971
+    .long 0x0011e690, .LsymbolName972
+    .long 0x0011e738, .LsymbolName973
+    .long 0x0011e738, .LsymbolName974
+    .long 0x0011e796, .LsymbolName975
+    .long 0x0011e796, .LsymbolName976
+    .long 0x0011e7ca, .LsymbolName977
+    .long 0x0011e7de, .LsymbolName978
+    .long 0x0011e826, .LsymbolName979
+    .long 0x0011e826, .LsymbolName980
+    .long 0x0011e880, .LsymbolName981
+    .long 0x0011e880, .LsymbolName982
+    .long 0x0011e8b4, .LsymbolName983
+    .long 0x0011ea28, .LsymbolName984
+    .long 0x0011eb82, .LsymbolName985
+    .long 0x0011ebac, .LsymbolName986
+    .long 0x0011ebd6, .LsymbolName987
+    .long 0x0011ebd6, .LsymbolName988
+    .long 0x0011ec1e, .LsymbolName989
+    .long 0x0011ec1e, .LsymbolName990
+    .long 0x0011ec52, .LsymbolName991
+    .long 0x0011ee2e, .LsymbolName992
+    .long 0x0011eedc, .LsymbolName993
+    .long 0x0011ef36, .LsymbolName994
+    .long 0x0011efb4, .LsymbolName995
+    .long 0x0011efb8, .LsymbolName996
+    .long 0x0011f001, .LsymbolName997
+    .long 0x0011f032, .LsymbolName998
+    .long 0x0011f06b, .LsymbolName999
+    .long 0x0011f0a1, .LsymbolName1000
+    .long 0x0011f150, .LsymbolName1001
+    .long 0x0011f175, .LsymbolName1002
+    .long 0x0011f195, .LsymbolName1003
+    .long 0x0011f1b5, .LsymbolName1004
+    .long 0x0011f1d7, .LsymbolName1005
+    .long 0x0011f21a, .LsymbolName1006
+    .long 0x0011f263, .LsymbolName1007
+    .long 0x0011f283, .LsymbolName1008
+    .long 0x0011f2bd, .LsymbolName1009
+    .long 0x0011f37e, .LsymbolName1010
+    .long 0x001205fb, .LsymbolName1011
+    .long 0x00120766, .LsymbolName1012
+    .long 0x0012078a, .LsymbolName1013
+    .long 0x001207ae, .LsymbolName1014
+    .long 0x0012093a, .LsymbolName1015
+    .long 0x0012093a, .LsymbolName1016
+    .long 0x00120a54, .LsymbolName1017
+    .long 0x00120c96, .LsymbolName1018
+    .long 0x00120c96, .LsymbolName1019
+    .long 0x00120cc8, .LsymbolName1020
+    .long 0x00120cf4, .LsymbolName1021
+    .long 0x00120d8c, .LsymbolName1022
+    .long 0x00120db8, .LsymbolName1023
+    .long 0x00120e43, .LsymbolName1024
+    .long 0x00120e79, .LsymbolName1025
+    .long 0x00120eb2, .LsymbolName1026
+    .long 0x00120fe2, .LsymbolName1027
+    .long 0x00121004, .LsymbolName1028
+    .long 0x00121008, .LsymbolName1029
+    .long 0x0012100c, .LsymbolName1030
+    .long 0x00121010, .LsymbolName1031
+    .long 0x00121014, .LsymbolName1032
+    .long 0x00121018, .LsymbolName1033
+    .long 0x0012101c, .LsymbolName1034
+    .long 0x00121020, .LsymbolName1035
+    .long 0x00121024, .LsymbolName1036
+    .long 0x00121030, .LsymbolName1037
+    .long 0x00121034, .LsymbolName1038
+    .long 0x00121038, .LsymbolName1039
+    .long 0x0012103c, .LsymbolName1040
+    .long 0x00121040, .LsymbolName1041
+    .long 0x00121044, .LsymbolName1042
+    .long 0x00121048, .LsymbolName1043
+    .long 0x0012104c, .LsymbolName1044
+    .long 0x00121050, .LsymbolName1045
+    .long 0x00121054, .LsymbolName1046
+    .long 0x00121058, .LsymbolName1047
+    .long 0x0012105c, .LsymbolName1048
+    .long 0x00121060, .LsymbolName1049
+    .long 0x00121064, .LsymbolName1050
+    .long 0x00121068, .LsymbolName1051
+    .long 0x0012106c, .LsymbolName1052
+    .long 0x00121140, .LsymbolName1053
+    .long 0x00121144, .LsymbolName1054
+    .long 0x00121148, .LsymbolName1055
+    .long 0x0012114c, .LsymbolName1056
+    .long 0x00121150, .LsymbolName1057
+    .long 0x00121154, .LsymbolName1058
+    .long 0x00121158, .LsymbolName1059
+    .long 0x0012115c, .LsymbolName1060
+    .long 0x00121160, .LsymbolName1061
+    .long 0x001213e8, .LsymbolName1062
+    .long 0x001213fc, .LsymbolName1063
+    .long 0x00121400, .LsymbolName1064
+    .long 0x00121404, .LsymbolName1065
+    .long 0x00121408, .LsymbolName1066
+    .long 0x0012140c, .LsymbolName1067
+    .long 0x00121410, .LsymbolName1068
+    .long 0x00121414, .LsymbolName1069
+    .long 0x00121418, .LsymbolName1070
+    .long 0x0012141c, .LsymbolName1071
+    .long 0x00121420, .LsymbolName1072
+    .long 0x00121440, .LsymbolName1073
+    .long 0x00121444, .LsymbolName1074
+    .long 0x00121448, .LsymbolName1075
+    .long 0x0012144c, .LsymbolName1076
+    .long 0x00121450, .LsymbolName1077
+    .long 0x00121454, .LsymbolName1078
+    .long 0x00121458, .LsymbolName1079
+    .long 0x0012145c, .LsymbolName1080
+    .long 0x00121460, .LsymbolName1081
+    .long 0x00121464, .LsymbolName1082
+    .long 0x00121468, .LsymbolName1083
+    .long 0x0012146c, .LsymbolName1084
+    .long 0x00121470, .LsymbolName1085
+    .long 0x00121474, .LsymbolName1086
+    .long 0x00121478, .LsymbolName1087
+    .long 0x0012147c, .LsymbolName1088
+    .long 0x00121480, .LsymbolName1089
+    .long 0x00121484, .LsymbolName1090
+    .long 0x00121488, .LsymbolName1091
+    .long 0x0012148c, .LsymbolName1092
+    .long 0x00121490, .LsymbolName1093
+    .long 0x00121494, .LsymbolName1094
+    .long 0x00121498, .LsymbolName1095
+    .long 0x0012149c, .LsymbolName1096
+    .long 0x001214a0, .LsymbolName1097
+    .long 0x001214a4, .LsymbolName1098
+    .long 0x001214a8, .LsymbolName1099
+    .long 0x001214ac, .LsymbolName1100
+    .long 0x001214e0, .LsymbolName1101
+    .long 0x001214e4, .LsymbolName1102
+    .long 0x001214e8, .LsymbolName1103
+    .long 0x001214ec, .LsymbolName1104
+    .long 0x001214f0, .LsymbolName1105
+    .long 0x001214f4, .LsymbolName1106
+    .long 0x001214f8, .LsymbolName1107
+    .long 0x001214fc, .LsymbolName1108
+    .long 0x00121500, .LsymbolName1109
+    .long 0x00121504, .LsymbolName1110
+    .long 0x00121508, .LsymbolName1111
+    .long 0x0012150c, .LsymbolName1112
+    .long 0x00121510, .LsymbolName1113
+    .long 0x00121528, .LsymbolName1114
+    .long 0x0012152c, .LsymbolName1115
+    .long 0x00121530, .LsymbolName1116
+    .long 0x00121534, .LsymbolName1117
+    .long 0x00121538, .LsymbolName1118
+    .long 0x0012153c, .LsymbolName1119
+    .long 0x00121540, .LsymbolName1120
+    .long 0x00121544, .LsymbolName1121
+    .long 0x00121548, .LsymbolName1122
+    .long 0x0012154c, .LsymbolName1123
+    .long 0x00121550, .LsymbolName1124
+    .long 0x00121554, .LsymbolName1125
+    .long 0x00121558, .LsymbolName1126
+    .long 0x0012155c, .LsymbolName1127
+    .long 0x0012157c, .LsymbolName1128
+    .long 0x00121580, .LsymbolName1129
+    .long 0x00121584, .LsymbolName1130
+    .long 0x00121588, .LsymbolName1131
+    .long 0x0012158c, .LsymbolName1132
+    .long 0x00121590, .LsymbolName1133
+    .long 0x00121594, .LsymbolName1134
+    .long 0x00121598, .LsymbolName1135
+    .long 0x0012159c, .LsymbolName1136
+    .long 0x001215a0, .LsymbolName1137
+    .long 0x001215a4, .LsymbolName1138
+    .long 0x001215a8, .LsymbolName1139
+    .long 0x001215ac, .LsymbolName1140
+    .long 0x001215b0, .LsymbolName1141
+    .long 0x001215b4, .LsymbolName1142
+    .long 0x001215b8, .LsymbolName1143
+    .long 0x001215bc, .LsymbolName1144
+    .long 0x001215c0, .LsymbolName1145
+    .long 0x001215c4, .LsymbolName1146
+    .long 0x001215c8, .LsymbolName1147
+    .long 0x001215d0, .LsymbolName1148
+    .long 0x001215d4, .LsymbolName1149
+    .long 0x001215d8, .LsymbolName1150
+    .long 0x001215dc, .LsymbolName1151
+    .long 0x001215e0, .LsymbolName1152
+    .long 0x001215e4, .LsymbolName1153
+    .long 0x001215e8, .LsymbolName1154
+    .long 0x001215ec, .LsymbolName1155
+    .long 0x001215f0, .LsymbolName1156
+    .long 0x001215f4, .LsymbolName1157
+    .long 0x001215f8, .LsymbolName1158
+    .long 0x001215fc, .LsymbolName1159
+    .long 0x001216e0, .LsymbolName1160
+    .long 0x001216e4, .LsymbolName1161
+    .long 0x001216e8, .LsymbolName1162
+    .long 0x001216ec, .LsymbolName1163
+    .long 0x001216f0, .LsymbolName1164
+    .long 0x001216f4, .LsymbolName1165
+    .long 0x001216f8, .LsymbolName1166
+    .long 0x001216fc, .LsymbolName1167
+    .long 0x00121700, .LsymbolName1168
+    .long 0x00121704, .LsymbolName1169
+    .long 0x00121708, .LsymbolName1170
+    .long 0x00121780, .LsymbolName1171
+    .long 0x00121784, .LsymbolName1172
+    .long 0x00121788, .LsymbolName1173
+    .long 0x0012178c, .LsymbolName1174
+    .long 0x00121790, .LsymbolName1175
+    .long 0x00121794, .LsymbolName1176
+    .long 0x00121798, .LsymbolName1177
+    .long 0x0012179c, .LsymbolName1178
+    .long 0x001217a0, .LsymbolName1179
+    .long 0x00121824, .LsymbolName1180
+    .long 0x00121828, .LsymbolName1181
+    .long 0x0012182c, .LsymbolName1182
+    .long 0x00121830, .LsymbolName1183
+    .long 0x00121834, .LsymbolName1184
+    .long 0x00121838, .LsymbolName1185
+    .long 0x0012183c, .LsymbolName1186
+    .long 0x00121840, .LsymbolName1187
+    .long 0x00121844, .LsymbolName1188
+    .long 0x00121848, .LsymbolName1189
+    .long 0x0012184c, .LsymbolName1190
+    .long 0x00121850, .LsymbolName1191
+    .long 0x00121854, .LsymbolName1192
+    .long 0x00121858, .LsymbolName1193
+    .long 0x0012185c, .LsymbolName1194
+    .long 0x00121860, .LsymbolName1195
+    .long 0x00121864, .LsymbolName1196
+    .long 0x00121868, .LsymbolName1197
+    .long 0x0012186c, .LsymbolName1198
+    .long 0x00121870, .LsymbolName1199
+    .long 0x00121874, .LsymbolName1200
+    .long 0x00121878, .LsymbolName1201
+    .long 0x0012187c, .LsymbolName1202
+    .long 0x00121880, .LsymbolName1203
+    .long 0x00121884, .LsymbolName1204
+    .long 0x00121888, .LsymbolName1205
+    .long 0x0012188c, .LsymbolName1206
+    .long 0x00121890, .LsymbolName1207
+    .long 0x00121894, .LsymbolName1208
+    .long 0x00121898, .LsymbolName1209
+    .long 0x0012189c, .LsymbolName1210
+    .long 0x001218a0, .LsymbolName1211
+    .long 0x001218a4, .LsymbolName1212
+    .long 0x001218a8, .LsymbolName1213
+    .long 0x001218ac, .LsymbolName1214
+    .long 0x001218b0, .LsymbolName1215
+    .long 0x001218b4, .LsymbolName1216
+    .long 0x001218b8, .LsymbolName1217
+    .long 0x001218bc, .LsymbolName1218
+    .long 0x001218c0, .LsymbolName1219
+    .long 0x001218c4, .LsymbolName1220
+    .long 0x00121900, .LsymbolName1221
+    .long 0x00121904, .LsymbolName1222
+    .long 0x00121908, .LsymbolName1223
+    .long 0x0012190c, .LsymbolName1224
+    .long 0x00121910, .LsymbolName1225
+    .long 0x00121914, .LsymbolName1226
+    .long 0x00121918, .LsymbolName1227
+    .long 0x0012191c, .LsymbolName1228
+    .long 0x00121920, .LsymbolName1229
+    .long 0x00121980, .LsymbolName1230
+    .long 0x00121984, .LsymbolName1231
+    .long 0x00121988, .LsymbolName1232
+    .long 0x0012198c, .LsymbolName1233
+    .long 0x00121990, .LsymbolName1234
+    .long 0x00121994, .LsymbolName1235
+    .long 0x00121998, .LsymbolName1236
+    .long 0x0012199c, .LsymbolName1237
+    .long 0x001219a0, .LsymbolName1238
+    .long 0x00121ee0, .LsymbolName1239
+    .long 0x00121ee4, .LsymbolName1240
+    .long 0x00121ee8, .LsymbolName1241
+    .long 0x00121eec, .LsymbolName1242
+    .long 0x00121ef0, .LsymbolName1243
+    .long 0x00121ef4, .LsymbolName1244
+    .long 0x00121ef8, .LsymbolName1245
+    .long 0x00121efc, .LsymbolName1246
+    .long 0x00121f00, .LsymbolName1247
+    .long 0x00121f04, .LsymbolName1248
+    .long 0x00121f08, .LsymbolName1249
+    .long 0x00121f0c, .LsymbolName1250
+    .long 0x00121f10, .LsymbolName1251
+    .long 0x00121f14, .LsymbolName1252
+    .long 0x00121f18, .LsymbolName1253
+    .long 0x00121f1c, .LsymbolName1254
+    .long 0x00121f20, .LsymbolName1255
+    .long 0x00121f24, .LsymbolName1256
+    .long 0x00121f28, .LsymbolName1257
+    .long 0x00121f2c, .LsymbolName1258
+    .long 0x00121f30, .LsymbolName1259
+    .long 0x00121f34, .LsymbolName1260
+    .long 0x00121f38, .LsymbolName1261
+    .long 0x00121f3c, .LsymbolName1262
+    .long 0x00121f40, .LsymbolName1263
+    .long 0x00121f44, .LsymbolName1264
+    .long 0x00121f48, .LsymbolName1265
+    .long 0x00121f68, .LsymbolName1266
+    .long 0x00121f6c, .LsymbolName1267
+    .long 0x00121f70, .LsymbolName1268
+    .long 0x00121f74, .LsymbolName1269
+    .long 0x00121f78, .LsymbolName1270
+    .long 0x00121f7c, .LsymbolName1271
+    .long 0x00121f80, .LsymbolName1272
+    .long 0x00121f84, .LsymbolName1273
+    .long 0x00121f88, .LsymbolName1274
+    .long 0x00121f8c, .LsymbolName1275
+    .long 0x00121f90, .LsymbolName1276
+    .long 0x00121f94, .LsymbolName1277
+    .long 0x00121f98, .LsymbolName1278
+    .long 0x00121ff0, .LsymbolName1279
+    .long 0x00121ff4, .LsymbolName1280
+    .long 0x00121ff8, .LsymbolName1281
+    .long 0x00121ffc, .LsymbolName1282
+    .long 0x00122000, .LsymbolName1283
+    .long 0x00122004, .LsymbolName1284
+    .long 0x00122008, .LsymbolName1285
+    .long 0x0012200c, .LsymbolName1286
+    .long 0x00122010, .LsymbolName1287
+    .long 0x00122014, .LsymbolName1288
+    .long 0x00122016, .LsymbolName1289
+    .long 0x00122018, .LsymbolName1290
+    .long 0x0012201a, .LsymbolName1291
+    .long 0x0012201c, .LsymbolName1292
+    .long 0x00122020, .LsymbolName1293
+    .long 0x00122024, .LsymbolName1294
+    .long 0x00122028, .LsymbolName1295
+    .long 0x0012202c, .LsymbolName1296
+    .long 0x00122030, .LsymbolName1297
+    .long 0x00122034, .LsymbolName1298
+    .long 0x00122038, .LsymbolName1299
+    .long 0x0012203c, .LsymbolName1300
+    .long 0x00122040, .LsymbolName1301
+    .long 0x00122044, .LsymbolName1302
+    .long 0x001220d8, .LsymbolName1303
+    .long 0x001220dc, .LsymbolName1304
+    .long 0x001220e0, .LsymbolName1305
+    .long 0x001220e4, .LsymbolName1306
+    .long 0x001220e8, .LsymbolName1307
+    .long 0x001220ec, .LsymbolName1308
+    .long 0x001220f0, .LsymbolName1309
+    .long 0x001220f4, .LsymbolName1310
+    .long 0x001220f8, .LsymbolName1311
+    .long 0x0012212c, .LsymbolName1312
+    .long 0x00122130, .LsymbolName1313
+    .long 0x00122134, .LsymbolName1314
+    .long 0x00122138, .LsymbolName1315
+    .long 0x0012213c, .LsymbolName1316
+    .long 0x00122140, .LsymbolName1317
+    .long 0x00122144, .LsymbolName1318
+    .long 0x00122148, .LsymbolName1319
+    .long 0x0012214c, .LsymbolName1320
+    .long 0x00122150, .LsymbolName1321
+    .long 0x00122154, .LsymbolName1322
+    .long 0x00122158, .LsymbolName1323
+    .long 0x001221f4, .LsymbolName1324
+    .long 0x001221f8, .LsymbolName1325
+    .long 0x001221fc, .LsymbolName1326
+    .long 0x00122200, .LsymbolName1327
+    .long 0x00122204, .LsymbolName1328
+    .long 0x00122208, .LsymbolName1329
+    .long 0x0012220c, .LsymbolName1330
+    .long 0x00122210, .LsymbolName1331
+    .long 0x00122214, .LsymbolName1332
+    .long 0x00122218, .LsymbolName1333
+    .long 0x0012221c, .LsymbolName1334
+    .long 0x00122220, .LsymbolName1335
+    .long 0x00122224, .LsymbolName1336
+    .long 0x00122228, .LsymbolName1337
+    .long 0x0012222c, .LsymbolName1338
+    .long 0x00122230, .LsymbolName1339
+    .long 0x00122234, .LsymbolName1340
+    .long 0x00122238, .LsymbolName1341
+    .long 0x0012223c, .LsymbolName1342
+    .long 0x00122240, .LsymbolName1343
+    .long 0x00122244, .LsymbolName1344
+    .long 0x00122248, .LsymbolName1345
+    .long 0x0012224c, .LsymbolName1346
+    .long 0x00122250, .LsymbolName1347
+    .long 0x00122254, .LsymbolName1348
+    .long 0x00122258, .LsymbolName1349
+    .long 0x0012225c, .LsymbolName1350
+    .long 0x00122260, .LsymbolName1351
+    .long 0x00122264, .LsymbolName1352
+    .long 0x00122268, .LsymbolName1353
+    .long 0x0012226c, .LsymbolName1354
+    .long 0x00122270, .LsymbolName1355
+    .long 0x00122274, .LsymbolName1356
+    .long 0x00122278, .LsymbolName1357
+    .long 0x0012227c, .LsymbolName1358
+    .long 0x00122280, .LsymbolName1359
+    .long 0x00122284, .LsymbolName1360
+    .long 0x00122288, .LsymbolName1361
+    .long 0x0012228c, .LsymbolName1362
+    .long 0x00122290, .LsymbolName1363
+    .long 0x00122294, .LsymbolName1364
+    .long 0x00122298, .LsymbolName1365
+    .long 0x0012229c, .LsymbolName1366
+    .long 0x001222a0, .LsymbolName1367
+    .long 0x001222a4, .LsymbolName1368
+    .long 0x001222a8, .LsymbolName1369
+    .long 0x001222ac, .LsymbolName1370
+    .long 0x001222b0, .LsymbolName1371
+    .long 0x001222b4, .LsymbolName1372
+    .long 0x001222b8, .LsymbolName1373
+    .long 0x001222bc, .LsymbolName1374
+    .long 0x001222c0, .LsymbolName1375
+    .long 0x001222c4, .LsymbolName1376
+    .long 0x001222c8, .LsymbolName1377
+    .long 0x001223e0, .LsymbolName1378
+    .long 0x001223e4, .LsymbolName1379
+    .long 0x001223e8, .LsymbolName1380
+    .long 0x001223ec, .LsymbolName1381
+    .long 0x001223f0, .LsymbolName1382
+    .long 0x001223f4, .LsymbolName1383
+    .long 0x001223f8, .LsymbolName1384
+    .long 0x001223fc, .LsymbolName1385
+    .long 0x00122400, .LsymbolName1386
+    .long 0x00122404, .LsymbolName1387
+    .long 0x00122408, .LsymbolName1388
+    .long 0x0012240c, .LsymbolName1389
+    .long 0x00122410, .LsymbolName1390
+    .long 0x00122414, .LsymbolName1391
+    .long 0x00122418, .LsymbolName1392
+    .long 0x0012241c, .LsymbolName1393
+    .long 0x00122420, .LsymbolName1394
+    .long 0x00122424, .LsymbolName1395
+    .long 0x00122428, .LsymbolName1396
+    .long 0x0012242c, .LsymbolName1397
+    .long 0x00122430, .LsymbolName1398
+    .long 0x00122434, .LsymbolName1399
+    .long 0x00122438, .LsymbolName1400
+    .long 0x0012243c, .LsymbolName1401
+    .long 0x00122440, .LsymbolName1402
+    .long 0x00122444, .LsymbolName1403
+    .long 0x00122448, .LsymbolName1404
+    .long 0x0012244c, .LsymbolName1405
+    .long 0x00122450, .LsymbolName1406
+    .long 0x00122454, .LsymbolName1407
+    .long 0x00122458, .LsymbolName1408
+    .long 0x0012245c, .LsymbolName1409
+    .long 0x00122460, .LsymbolName1410
+    .long 0x00122464, .LsymbolName1411
+    .long 0x00122468, .LsymbolName1412
+    .long 0x0012246c, .LsymbolName1413
+    .long 0x00122470, .LsymbolName1414
+    .long 0x00122bf3, .LsymbolName1415
+    .long 0x00122bf7, .LsymbolName1416
+.LsymbolName0: .asciz "loader"
+.LsymbolName1: .asciz "_stop"
+.LsymbolName2: .asciz "maxOS::system::GlobalDescriptorTable::GlobalDescriptorTable"
+.LsymbolName3: .asciz "maxOS::system::GlobalDescriptorTable::GlobalDescriptorTable"
+.LsymbolName4: .asciz "maxOS::system::GlobalDescriptorTable::~GlobalDescriptorTable"
+.LsymbolName5: .asciz "maxOS::system::GlobalDescriptorTable::~GlobalDescriptorTable"
+.LsymbolName6: .asciz "maxOS::system::GlobalDescriptorTable::DataSegmentSelector"
+.LsymbolName7: .asciz "maxOS::system::GlobalDescriptorTable::CodeSegmentSelector"
+.LsymbolName8: .asciz "maxOS::system::GlobalDescriptorTable::UserCodeSegmentSelector"
+.LsymbolName9: .asciz "maxOS::system::GlobalDescriptorTable::UserDataSegmentSelector"
+.LsymbolName10: .asciz "maxOS::system::GlobalDescriptorTable::TaskStateSegmentSelector"
+.LsymbolName11: .asciz "maxOS::system::GlobalDescriptorTable::SetKernelStack"
+.LsymbolName12: .asciz "maxOS::system::GlobalDescriptorTable::SegmentDescriptor::SegmentDescriptor"
+.LsymbolName13: .asciz "maxOS::system::GlobalDescriptorTable::SegmentDescriptor::SegmentDescriptor"
+.LsymbolName14: .asciz "maxOS::system::GlobalDescriptorTable::SegmentDescriptor::Base"
+.LsymbolName15: .asciz "maxOS::system::GlobalDescriptorTable::SegmentDescriptor::Limit"
+.LsymbolName16: .asciz "__x86.get_pc_thunk.ax"
+.LsymbolName17: .asciz "__x86.get_pc_thunk.bx"
+.LsymbolName18: .asciz "maxOS::system::MemoryManager::MemoryManager"
+.LsymbolName19: .asciz "maxOS::system::MemoryManager::MemoryManager"
+.LsymbolName20: .asciz "maxOS::system::MemoryManager::~MemoryManager"
+.LsymbolName21: .asciz "maxOS::system::MemoryManager::~MemoryManager"
+.LsymbolName22: .asciz "maxOS::system::MemoryManager::malloc"
+.LsymbolName23: .asciz "maxOS::system::MemoryManager::free"
+.LsymbolName24: .asciz "operator new"
+.LsymbolName25: .asciz "operator new[]"
+.LsymbolName26: .asciz "operator new"
+.LsymbolName27: .asciz "operator new[]"
+.LsymbolName28: .asciz "operator delete"
+.LsymbolName29: .asciz "operator delete[]"
+.LsymbolName30: .asciz "operator delete"
+.LsymbolName31: .asciz "operator delete[]"
+.LsymbolName32: .asciz "Pause"
+.LsymbolName33: .asciz "maxOS::drivers::Driver::Driver"
+.LsymbolName34: .asciz "maxOS::drivers::Driver::Driver"
+.LsymbolName35: .asciz "maxOS::drivers::Driver::~Driver"
+.LsymbolName36: .asciz "maxOS::drivers::Driver::~Driver"
+.LsymbolName37: .asciz "maxOS::drivers::Driver::Activate"
+.LsymbolName38: .asciz "maxOS::drivers::Driver::Deactivate"
+.LsymbolName39: .asciz "maxOS::drivers::Driver::Reset"
+.LsymbolName40: .asciz "maxOS::drivers::DriverManager::DriverManager"
+.LsymbolName41: .asciz "maxOS::drivers::DriverManager::DriverManager"
+.LsymbolName42: .asciz "maxOS::drivers::DriverManager::~DriverManager"
+.LsymbolName43: .asciz "maxOS::drivers::DriverManager::~DriverManager"
+.LsymbolName44: .asciz "maxOS::drivers::DriverManager::AddDriver"
+.LsymbolName45: .asciz "maxOS::drivers::DriverManager::AddDependency"
+.LsymbolName46: .asciz "maxOS::drivers::DriverManager::DependenciesActive"
+.LsymbolName47: .asciz "maxOS::drivers::DriverManager::Claim"
+.LsymbolName48: .asciz "maxOS::drivers::DriverManager::Activate"
+.LsymbolName49: .asciz "maxOS::drivers::DriverManager::ActivateAll"
+.LsymbolName50: .asciz "maxOS::drivers::DriverManager::ActivateRequired"
+.LsymbolName51: .asciz "maxOS::drivers::DriverManager::ActivatePending"
+.LsymbolName52: .asciz "maxOS::drivers::DriverManager::IsActive"
+.LsymbolName53: .asciz "maxOS::drivers::DriverManager::WaitFor"
+.LsymbolName54: .asciz "maxOS::drivers::DriverManager::Worker"
+.LsymbolName55: .asciz "maxOS::hardwarecommunication::DisableInterrupts"
+.LsymbolName56: .asciz "maxOS::hardwarecommunication::Port::Port"
+.LsymbolName57: .asciz "maxOS::hardwarecommunication::Port::Port"
+.LsymbolName58: .asciz "maxOS::hardwarecommunication::Port::~Port"
+.LsymbolName59: .asciz "maxOS::hardwarecommunication::Port::~Port"
+.LsymbolName60: .asciz "maxOS::hardwarecommunication::Port8Bit::Port8Bit"
+.LsymbolName61: .asciz "maxOS::hardwarecommunication::Port8Bit::Port8Bit"
+.LsymbolName62: .asciz "maxOS::hardwarecommunication::Port8Bit::~Port8Bit"
+.LsymbolName63: .asciz "maxOS::hardwarecommunication::Port8Bit::~Port8Bit"
+.LsymbolName64: .asciz "maxOS::hardwarecommunication::Port8BitSlow::Port8BitSlow"
+.LsymbolName65: .asciz "maxOS::hardwarecommunication::Port8BitSlow::Port8BitSlow"
+.LsymbolName66: .asciz "maxOS::hardwarecommunication::Port8BitSlow::~Port8BitSlow"
+.LsymbolName67: .asciz "maxOS::hardwarecommunication::Port8BitSlow::~Port8BitSlow"
+.LsymbolName68: .asciz "maxOS::hardwarecommunication::Port16Bit::Port16Bit"
+.LsymbolName69: .asciz "maxOS::hardwarecommunication::Port16Bit::Port16Bit"
+.LsymbolName70: .asciz "maxOS::hardwarecommunication::Port16Bit::~Port16Bit"
+.LsymbolName71: .asciz "maxOS::hardwarecommunication::Port16Bit::~Port16Bit"
+.LsymbolName72: .asciz "maxOS::hardwarecommunication::Port32Bit::Port32Bit"
+.LsymbolName73: .asciz "maxOS::hardwarecommunication::Port32Bit::Port32Bit"
+.LsymbolName74: .asciz "maxOS::hardwarecommunication::Port32Bit::~Port32Bit"
+.LsymbolName75: .asciz "maxOS::hardwarecommunication::Port32Bit::~Port32Bit"
+.LsymbolName76: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleException0x00"
+.LsymbolName77: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleException0x01"
+.LsymbolName78: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleException0x02"
+.LsymbolName79: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleException0x03"
+.LsymbolName80: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleException0x04"
+.LsymbolName81: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleException0x05"
+.LsymbolName82: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleException0x06"
+.LsymbolName83: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleException0x07"
+.LsymbolName84: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleException0x08"
+.LsymbolName85: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleException0x09"
+.LsymbolName86: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleException0x0A"
+.LsymbolName87: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleException0x0B"
+.LsymbolName88: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleException0x0C"
+.LsymbolName89: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleException0x0D"
+.LsymbolName90: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleException0x0E"
+.LsymbolName91: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleException0x0F"
+.LsymbolName92: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleException0x10"
+.LsymbolName93: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleException0x11"
+.LsymbolName94: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleException0x12"
+.LsymbolName95: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleException0x13"
+.LsymbolName96: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x00"
+.LsymbolName97: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x01"
+.LsymbolName98: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x02"
+.LsymbolName99: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x03"
+.LsymbolName100: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x04"
+.LsymbolName101: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x05"
+.LsymbolName102: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x06"
+.LsymbolName103: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x07"
+.LsymbolName104: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x08"
+.LsymbolName105: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x09"
+.LsymbolName106: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x0A"
+.LsymbolName107: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x0B"
+.LsymbolName108: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x0C"
+.LsymbolName109: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x0D"
+.LsymbolName110: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x0E"
+.LsymbolName111: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x0F"
+.LsymbolName112: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x10"
+.LsymbolName113: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x11"
+.LsymbolName114: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x12"
+.LsymbolName115: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x13"
+.LsymbolName116: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x14"
+.LsymbolName117: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x15"
+.LsymbolName118: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x16"
+.LsymbolName119: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x17"
+.LsymbolName120: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x18"
+.LsymbolName121: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x19"
+.LsymbolName122: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x1A"
+.LsymbolName123: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x1B"
+.LsymbolName124: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x1C"
+.LsymbolName125: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x1D"
+.LsymbolName126: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x1E"
+.LsymbolName127: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x1F"
+.LsymbolName128: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x20"
+.LsymbolName129: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x21"
+.LsymbolName130: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x22"
+.LsymbolName131: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x23"
+.LsymbolName132: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x24"
+.LsymbolName133: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x25"
+.LsymbolName134: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x26"
+.LsymbolName135: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x27"
+.LsymbolName136: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x28"
+.LsymbolName137: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x29"
+.LsymbolName138: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x2A"
+.LsymbolName139: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x2B"
+.LsymbolName140: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x2C"
+.LsymbolName141: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x2D"
+.LsymbolName142: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x2E"
+.LsymbolName143: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x2F"
+.LsymbolName144: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x31"
+.LsymbolName145: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterruptRequest0x80"
+.LsymbolName146: .asciz "int_bottom"
+.LsymbolName147: .asciz "maxOS::hardwarecommunication::InterruptManager::InterruptIgnore"
+.LsymbolName148: .asciz "maxOS::hardwarecommunication::InterruptHandler::InterruptHandler"
+.LsymbolName149: .asciz "maxOS::hardwarecommunication::InterruptHandler::InterruptHandler"
+.LsymbolName150: .asciz "maxOS::hardwarecommunication::InterruptHandler::~InterruptHandler"
+.LsymbolName151: .asciz "maxOS::hardwarecommunication::InterruptHandler::~InterruptHandler"
+.LsymbolName152: .asciz "maxOS::hardwarecommunication::InterruptHandler::HandleInterrupt"
+.LsymbolName153: .asciz "maxOS::hardwarecommunication::InterruptManager::SetInterruptDescriptorTableEntry"
+.LsymbolName154: .asciz "maxOS::hardwarecommunication::InterruptManager::InterruptManager"
+.LsymbolName155: .asciz "maxOS::hardwarecommunication::InterruptManager::InterruptManager"
+.LsymbolName156: .asciz "maxOS::hardwarecommunication::InterruptManager::~InterruptManager"
+.LsymbolName157: .asciz "maxOS::hardwarecommunication::InterruptManager::~InterruptManager"
+.LsymbolName158: .asciz "maxOS::hardwarecommunication::InterruptManager::Activate"
+.LsymbolName159: .asciz "maxOS::hardwarecommunication::InterruptManager::Deactivate"
+.LsymbolName160: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleInterrupt"
+.LsymbolName161: .asciz "maxOS::hardwarecommunication::InterruptManager::DoHandleInterrupt"
+.LsymbolName162: .asciz "maxOS::hardwarecommunication::InterruptManager::HandleFault"
+.LsymbolName163: .asciz "maxOS::hardwarecommunication::InterruptManager::UseAPIC"
+.LsymbolName164: .asciz "maxOS::hardwarecommunication::InterruptManager::AllocateMessageVectors"
+.LsymbolName165: .asciz "maxOS::hardwarecommunication::InterruptManager::FreeMessageVectors"
+.LsymbolName166: .asciz "maxOS::hardwarecommunication::InterruptManager::Statistics"
+.LsymbolName167: .asciz "maxOS::hardwarecommunication::InterruptManager::UnhandledInterrupts"
+.LsymbolName168: .asciz "maxOS::hardwarecommunication::InterruptManager::ResetStatistics"
+.LsymbolName169: .asciz "maxOS::hardwarecommunication::InterruptManager::DumpStatistics"
+.LsymbolName170: .asciz "maxOS::hardwarecommunication::InterruptManager::HardwareInterruptOffset"
+.LsymbolName171: .asciz "maxOS::hardwarecommunication::RestoreInterrupts"
+.LsymbolName172: .asciz "maxOS::system::Clock::ReadTimestampCounter"
+.LsymbolName173: .asciz "maxOS::hardwarecommunication::LocalAPIC::EndOfInterrupt"
+.LsymbolName174: .asciz "maxOS::system::Tracer::Trace"
+.LsymbolName175: .asciz "maxOS::hardwarecommunication::serial::serial"
+.LsymbolName176: .asciz "maxOS::hardwarecommunication::serial::serial"
+.LsymbolName177: .asciz "maxOS::hardwarecommunication::serial::~serial"
+.LsymbolName178: .asciz "maxOS::hardwarecommunication::serial::~serial"
+.LsymbolName179: .asciz "maxOS::hardwarecommunication::serial::receive"
+.LsymbolName180: .asciz "maxOS::hardwarecommunication::serial::Read"
+.LsymbolName181: .asciz "maxOS::hardwarecommunication::serial::isTransmitEmpty"
+.LsymbolName182: .asciz "maxOS::hardwarecommunication::serial::printHeader"
+.LsymbolName183: .asciz "maxOS::hardwarecommunication::serial::Test"
+.LsymbolName184: .asciz "maxOS::hardwarecommunication::serial::Write"
+.LsymbolName185: .asciz ".L45"
+.LsymbolName186: .asciz ".L44"
+.LsymbolName187: .asciz ".L43"
+.LsymbolName188: .asciz ".L42"
+.LsymbolName189: .asciz ".L41"
+.LsymbolName190: .asciz ".L40"
+.LsymbolName191: .asciz ".L39"
+.LsymbolName192: .asciz ".L37"
+.LsymbolName193: .asciz ".L51"
+.LsymbolName194: .asciz "maxOS::hardwarecommunication::serial::WriteNumber"
+.LsymbolName195: .asciz "maxOS::hardwarecommunication::serial::WriteHex"
+.LsymbolName196: .asciz "maxOS::hardwarecommunication::serial::WriteBytes"
+.LsymbolName197: .asciz "maxOS::hardwarecommunication::serial::HandleInterrupt"
+.LsymbolName198: .asciz "maxOS::hardwarecommunication::AdvancedConfigurationAndPowerInterface::AdvancedConfigurationAndPowerInterface"
+.LsymbolName199: .asciz "maxOS::hardwarecommunication::AdvancedConfigurationAndPowerInterface::AdvancedConfigurationAndPowerInterface"
+.LsymbolName200: .asciz "maxOS::hardwarecommunication::AdvancedConfigurationAndPowerInterface::~AdvancedConfigurationAndPowerInterface"
+.LsymbolName201: .asciz "maxOS::hardwarecommunication::AdvancedConfigurationAndPowerInterface::~AdvancedConfigurationAndPowerInterface"
+.LsymbolName202: .asciz "maxOS::hardwarecommunication::AdvancedConfigurationAndPowerInterface::ValidChecksum"
+.LsymbolName203: .asciz "maxOS::hardwarecommunication::AdvancedConfigurationAndPowerInterface::FindRootPointer"
+.LsymbolName204: .asciz "maxOS::hardwarecommunication::AdvancedConfigurationAndPowerInterface::MapTable"
+.LsymbolName205: .asciz "maxOS::hardwarecommunication::AdvancedConfigurationAndPowerInterface::IsPresent"
+.LsymbolName206: .asciz "maxOS::hardwarecommunication::AdvancedConfigurationAndPowerInterface::FindTable"
+.LsymbolName207: .asciz "maxOS::hardwarecommunication::AdvancedConfigurationAndPowerInterface::ParseMADT"
+.LsymbolName208: .asciz "maxOS::hardwarecommunication::AdvancedConfigurationAndPowerInterface::ParseHPET"
+.LsymbolName209: .asciz "maxOS::hardwarecommunication::AdvancedConfigurationAndPowerInterface::ParseFADT"
+.LsymbolName210: .asciz "maxOS::hardwarecommunication::AdvancedConfigurationAndPowerInterface::ParseMCFG"
+.LsymbolName211: .asciz "maxOS::hardwarecommunication::LocalAPIC::LocalAPIC"
+.LsymbolName212: .asciz "maxOS::hardwarecommunication::LocalAPIC::LocalAPIC"
+.LsymbolName213: .asciz "maxOS::hardwarecommunication::LocalAPIC::~LocalAPIC"
+.LsymbolName214: .asciz "maxOS::hardwarecommunication::LocalAPIC::~LocalAPIC"
+.LsymbolName215: .asciz "maxOS::hardwarecommunication::LocalAPIC::Read"
+.LsymbolName216: .asciz "maxOS::hardwarecommunication::LocalAPIC::Write"
+.LsymbolName217: .asciz "maxOS::hardwarecommunication::LocalAPIC::ID"
+.LsymbolName218: .asciz "maxOS::hardwarecommunication::LocalAPIC::SetTaskPriority"
+.LsymbolName219: .asciz "maxOS::hardwarecommunication::IOAPIC::IOAPIC"
+.LsymbolName220: .asciz "maxOS::hardwarecommunication::IOAPIC::IOAPIC"
+.LsymbolName221: .asciz "maxOS::hardwarecommunication::IOAPIC::~IOAPIC"
+.LsymbolName222: .asciz "maxOS::hardwarecommunication::IOAPIC::~IOAPIC"
+.LsymbolName223: .asciz "maxOS::hardwarecommunication::IOAPIC::Read"
+.LsymbolName224: .asciz "maxOS::hardwarecommunication::IOAPIC::Write"
+.LsymbolName225: .asciz "maxOS::hardwarecommunication::IOAPIC::Handles"
+.LsymbolName226: .asciz "maxOS::hardwarecommunication::IOAPIC::SetRedirection"
+.LsymbolName227: .asciz "maxOS::hardwarecommunication::IOAPIC::Mask"
+.LsymbolName228: .asciz "maxOS::hardwarecommunication::AdvancedProgrammableInterruptController::AdvancedProgrammableInterruptController"
+.LsymbolName229: .asciz "maxOS::hardwarecommunication::AdvancedProgrammableInterruptController::AdvancedProgrammableInterruptController"
+.LsymbolName230: .asciz "maxOS::hardwarecommunication::AdvancedProgrammableInterruptController::~AdvancedProgrammableInterruptController"
+.LsymbolName231: .asciz "maxOS::hardwarecommunication::AdvancedProgrammableInterruptController::~AdvancedProgrammableInterruptController"
+.LsymbolName232: .asciz "maxOS::hardwarecommunication::AdvancedProgrammableInterruptController::IsAvailable"
+.LsymbolName233: .asciz "maxOS::hardwarecommunication::AdvancedProgrammableInterruptController::Local"
+.LsymbolName234: .asciz "maxOS::hardwarecommunication::AdvancedProgrammableInterruptController::Description"
+.LsymbolName235: .asciz "maxOS::hardwarecommunication::AdvancedProgrammableInterruptController::CurrentCPU"
+.LsymbolName236: .asciz "maxOS::hardwarecommunication::AdvancedProgrammableInterruptController::FindIOAPIC"
+.LsymbolName237: .asciz "maxOS::hardwarecommunication::AdvancedProgrammableInterruptController::GlobalSystemInterrupt"
+.LsymbolName238: .asciz "maxOS::hardwarecommunication::AdvancedProgrammableInterruptController::RouteIRQ"
+.LsymbolName239: .asciz "maxOS::hardwarecommunication::AdvancedProgrammableInterruptController::MaskIRQ"
+.LsymbolName240: .asciz "__x86.get_pc_thunk.si"
+.LsymbolName241: .asciz "IsCallerMemory"
+.LsymbolName242: .asciz "IsPrivileged"
+.LsymbolName243: .asciz "maxOS::system::SyscallHandler::SyscallHandler"
+.LsymbolName244: .asciz "maxOS::system::SyscallHandler::SyscallHandler"
+.LsymbolName245: .asciz "maxOS::system::SyscallHandler::~SyscallHandler"
+.LsymbolName246: .asciz "maxOS::system::SyscallHandler::~SyscallHandler"
+.LsymbolName247: .asciz "maxOS::system::SyscallHandler::HandleInterrupt"
+.LsymbolName248: .asciz ".L28"
+.LsymbolName249: .asciz ".L27"
+.LsymbolName250: .asciz ".L26"
+.LsymbolName251: .asciz ".L25"
+.LsymbolName252: .asciz ".L66"
+.LsymbolName253: .asciz ".L65"
+.LsymbolName254: .asciz ".L64"
+.LsymbolName255: .asciz ".L63"
+.LsymbolName256: .asciz ".L62"
+.LsymbolName257: .asciz ".L60"
+.LsymbolName258: .asciz ".L23"
+.LsymbolName259: .asciz "sys_exit"
+.LsymbolName260: .asciz "sys_fork"
+.LsymbolName261: .asciz "sys_read"
+.LsymbolName262: .asciz "sys_write"
+.LsymbolName263: .asciz "sys_open"
+.LsymbolName264: .asciz "sys_close"
+.LsymbolName265: .asciz "sys_waitpid"
+.LsymbolName266: .asciz "sys_creat"
+.LsymbolName267: .asciz "sys_link"
+.LsymbolName268: .asciz "sys_unlink"
+.LsymbolName269: .asciz "maxOS::system::VirtualDynamicSharedObject::Page"
+.LsymbolName270: .asciz "maxOS::system::VirtualDynamicSharedObject::BeginWrite"
+.LsymbolName271: .asciz "maxOS::system::VirtualDynamicSharedObject::EndWrite"
+.LsymbolName272: .asciz "maxOS::system::VirtualDynamicSharedObject::UpdateClock"
+.LsymbolName273: .asciz "maxOS::system::VirtualDynamicSharedObject::SetProcess"
+.LsymbolName274: .asciz "Divide64"
+.LsymbolName275: .asciz "maxOS::system::Clock::Clock"
+.LsymbolName276: .asciz "maxOS::system::Clock::Clock"
+.LsymbolName277: .asciz "maxOS::system::Clock::~Clock"
+.LsymbolName278: .asciz "maxOS::system::Clock::~Clock"
+.LsymbolName279: .asciz "maxOS::system::Clock::MeasureWithPIT"
+.LsymbolName280: .asciz "maxOS::system::Clock::MeasureWithHPET"
+.LsymbolName281: .asciz "maxOS::system::Clock::Calibrate"
+.LsymbolName282: .asciz "maxOS::system::Clock::ReadCMOS"
+.LsymbolName283: .asciz "maxOS::system::Clock::ReadRealTimeClock"
+.LsymbolName284: .asciz "maxOS::system::Clock::Update"
+.LsymbolName285: .asciz "maxOS::system::Clock::HandleInterrupt"
+.LsymbolName286: .asciz "maxOS::system::Clock::TicksPerMillisecond"
+.LsymbolName287: .asciz "maxOS::system::Clock::TicksToMicroseconds"
+.LsymbolName288: .asciz "maxOS::system::Clock::MicrosecondsToTicks"
+.LsymbolName289: .asciz "maxOS::system::Clock::GetTime"
+.LsymbolName290: .asciz "maxOS::system::Clock::BootTime"
+.LsymbolName291: .asciz "maxOS::system::IORingFile::IORingFile"
+.LsymbolName292: .asciz "maxOS::system::IORingFile::IORingFile"
+.LsymbolName293: .asciz "maxOS::system::IORingFile::~IORingFile"
+.LsymbolName294: .asciz "maxOS::system::IORingFile::~IORingFile"
+.LsymbolName295: .asciz "maxOS::system::IORingFile::Read"
+.LsymbolName296: .asciz "maxOS::system::IORingFile::Write"
+.LsymbolName297: .asciz "maxOS::system::IORingFile::Send"
+.LsymbolName298: .asciz "maxOS::system::IORingFile::Receive"
+.LsymbolName299: .asciz "maxOS::system::IORingFile::Sync"
+.LsymbolName300: .asciz "maxOS::system::IORing::IORing"
+.LsymbolName301: .asciz "maxOS::system::IORing::IORing"
+.LsymbolName302: .asciz "maxOS::system::IORing::~IORing"
+.LsymbolName303: .asciz "maxOS::system::IORing::~IORing"
+.LsymbolName304: .asciz "maxOS::system::IORing::MapQueues"
+.LsymbolName305: .asciz "maxOS::system::IORing::IsValid"
+.LsymbolName306: .asciz "maxOS::system::IORing::Queues"
+.LsymbolName307: .asciz "maxOS::system::IORing::Complete"
+.LsymbolName308: .asciz "maxOS::system::IORing::IsOwnerMemory"
+.LsymbolName309: .asciz "maxOS::system::IORing::Execute"
+.LsymbolName310: .asciz ".L87"
+.LsymbolName311: .asciz ".L86"
+.LsymbolName312: .asciz ".L85"
+.LsymbolName313: .asciz ".L84"
+.LsymbolName314: .asciz ".L83"
+.LsymbolName315: .asciz ".L82"
+.LsymbolName316: .asciz ".L80"
+.LsymbolName317: .asciz "maxOS::system::IORing::ExpireTimeouts"
+.LsymbolName318: .asciz "maxOS::system::IORing::Wait"
+.LsymbolName319: .asciz "maxOS::system::IORing::Submit"
+.LsymbolName320: .asciz "maxOS::system::IORing::RegisterFile"
+.LsymbolName321: .asciz "maxOS::system::IORing::Setup"
+.LsymbolName322: .asciz "maxOS::system::IORing::Enter"
+.LsymbolName323: .asciz "maxOS::system::IORing::Release"
+.LsymbolName324: .asciz "maxOS::system::IORing::Poller"
+.LsymbolName325: .asciz "ZeroPage"
+.LsymbolName326: .asciz "maxOS::system::PageManager::PageManager"
+.LsymbolName327: .asciz "maxOS::system::PageManager::PageManager"
+.LsymbolName328: .asciz "maxOS::system::PageManager::~PageManager"
+.LsymbolName329: .asciz "maxOS::system::PageManager::~PageManager"
+.LsymbolName330: .asciz "maxOS::system::PageManager::AllocateFrame"
+.LsymbolName331: .asciz "maxOS::system::PageManager::FreeFrame"
+.LsymbolName332: .asciz "maxOS::system::PageManager::ShareFrame"
+.LsymbolName333: .asciz "maxOS::system::PageManager::FrameReferences"
+.LsymbolName334: .asciz "maxOS::system::PageManager::FreeFrames"
+.LsymbolName335: .asciz "maxOS::system::PageManager::KernelAddressSpace"
+.LsymbolName336: .asciz "maxOS::system::PageManager::CurrentAddressSpace"
+.LsymbolName337: .asciz "maxOS::system::PageManager::CreateAddressSpace"
+.LsymbolName338: .asciz "maxOS::system::PageManager::DestroyAddressSpace"
+.LsymbolName339: .asciz "maxOS::system::PageManager::SwitchAddressSpace"
+.LsymbolName340: .asciz "maxOS::system::PageManager::GetPageTableEntry"
+.LsymbolName341: .asciz "maxOS::system::PageManager::Map"
+.LsymbolName342: .asciz "maxOS::system::PageManager::Unmap"
+.LsymbolName343: .asciz "maxOS::system::PageManager::Lookup"
+.LsymbolName344: .asciz "maxOS::system::PageManager::PhysicalAddress"
+.LsymbolName345: .asciz "maxOS::system::PageManager::AllocateKernelStack"
+.LsymbolName346: .asciz "maxOS::system::PageManager::SetKernelEntry"
+.LsymbolName347: .asciz "maxOS::system::PageManager::SplitKernelEntry"
+.LsymbolName348: .asciz "maxOS::system::PageManager::MapKernelPages"
+.LsymbolName349: .asciz "maxOS::system::PageManager::MapDeviceWindow"
+.LsymbolName350: .asciz "maxOS::system::PageManager::MapPhysicalMemory"
+.LsymbolName351: .asciz "maxOS::system::PageManager::SupportsWriteCombining"
+.LsymbolName352: .asciz "maxOS::system::PageManager::FlushPage"
+.LsymbolName353: .asciz "maxOS::system::PageCache::PageCache"
+.LsymbolName354: .asciz "maxOS::system::PageCache::PageCache"
+.LsymbolName355: .asciz "maxOS::system::PageCache::~PageCache"
+.LsymbolName356: .asciz "maxOS::system::PageCache::~PageCache"
+.LsymbolName357: .asciz "maxOS::system::PageCache::Hash"
+.LsymbolName358: .asciz "maxOS::system::PageCache::MicrosecondsToTicks"
+.LsymbolName359: .asciz "maxOS::system::PageCache::Find"
+.LsymbolName360: .asciz "maxOS::system::PageCache::Insert"
+.LsymbolName361: .asciz "maxOS::system::PageCache::Remove"
+.LsymbolName362: .asciz "maxOS::system::PageCache::GetPage"
+.LsymbolName363: .asciz "maxOS::system::PageCache::Evict"
+.LsymbolName364: .asciz "maxOS::system::PageCache::AllocateIO"
+.LsymbolName365: .asciz "maxOS::system::PageCache::StartIO"
+.LsymbolName366: .asciz "maxOS::system::PageCache::IODone"
+.LsymbolName367: .asciz "maxOS::system::PageCache::WaitIO"
+.LsymbolName368: .asciz "maxOS::system::PageCache::ReadAhead"
+.LsymbolName369: .asciz "maxOS::system::PageCache::Read"
+.LsymbolName370: .asciz "maxOS::system::PageCache::Write"
+.LsymbolName371: .asciz "maxOS::system::PageCache::WriteBack"
+.LsymbolName372: .asciz "maxOS::system::PageCache::WriteBackExpired"
+.LsymbolName373: .asciz "maxOS::system::PageCache::Sync"
+.LsymbolName374: .asciz "maxOS::system::PageCache::WriteBackThread"
+.LsymbolName375: .asciz "maxOS::system::PageCache::Hits"
+.LsymbolName376: .asciz "maxOS::system::PageCache::Misses"
+.LsymbolName377: .asciz "maxOS::system::PageCache::ReadAheads"
+.LsymbolName378: .asciz "maxOS::system::PageCache::WriteBacks"
+.LsymbolName379: .asciz "maxOS::system::PageCache::DirtyPages"
+.LsymbolName380: .asciz "__x86.get_pc_thunk.cx"
+.LsymbolName381: .asciz "maxOS::system::KernelSymbols::Count"
+.LsymbolName382: .asciz "maxOS::system::KernelSymbols::Get"
+.LsymbolName383: .asciz "maxOS::system::KernelSymbols::Find"
+.LsymbolName384: .asciz "maxOS::system::KernelSymbols::Name"
+.LsymbolName385: .asciz "maxOS::system::Profiler::Profiler"
+.LsymbolName386: .asciz "maxOS::system::Profiler::Profiler"
+.LsymbolName387: .asciz "maxOS::system::Profiler::~Profiler"
+.LsymbolName388: .asciz "maxOS::system::Profiler::~Profiler"
+.LsymbolName389: .asciz "maxOS::system::Profiler::Start"
+.LsymbolName390: .asciz "maxOS::system::Profiler::Stop"
+.LsymbolName391: .asciz "maxOS::system::Profiler::Reset"
+.LsymbolName392: .asciz "maxOS::system::Profiler::IsRunning"
+.LsymbolName393: .asciz "maxOS::system::Profiler::Samples"
+.LsymbolName394: .asciz "maxOS::system::Profiler::CurrentCPU"
+.LsymbolName395: .asciz "maxOS::system::Profiler::ValidFrame"
+.LsymbolName396: .asciz "maxOS::system::Profiler::Sample"
+.LsymbolName397: .asciz "SampleFrames"
+.LsymbolName398: .asciz "FrameName"
+.LsymbolName399: .asciz "maxOS::system::Profiler::CountSymbols"
+.LsymbolName400: .asciz "maxOS::system::Profiler::DumpFlat"
+.LsymbolName401: .asciz "Tally"
+.LsymbolName402: .asciz "WriteTally"
+.LsymbolName403: .asciz "maxOS::system::Profiler::DumpCallGraph"
+.LsymbolName404: .asciz "maxOS::system::Profiler::DumpFoldedStacks"
+.LsymbolName405: .asciz "maxOS::system::Tracer::Tracer"
+.LsymbolName406: .asciz "maxOS::system::Tracer::Tracer"
+.LsymbolName407: .asciz "maxOS::system::Tracer::~Tracer"
+.LsymbolName408: .asciz "maxOS::system::Tracer::~Tracer"
+.LsymbolName409: .asciz "maxOS::system::Tracer::Enable"
+.LsymbolName410: .asciz "maxOS::system::Tracer::EnabledEvents"
+.LsymbolName411: .asciz "maxOS::system::Tracer::CurrentCPU"
+.LsymbolName412: .asciz "maxOS::system::Tracer::Record"
+.LsymbolName413: .asciz "maxOS::system::Tracer::WriteFrame"
+.LsymbolName414: .asciz "maxOS::system::Tracer::DescribeEvents"
+.LsymbolName415: .asciz "maxOS::system::Tracer::DrainRing"
+.LsymbolName416: .asciz "maxOS::system::Tracer::Drain"
+.LsymbolName417: .asciz "maxOS::system::Tracer::Drainer"
+.LsymbolName418: .asciz "maxOS::system::BootTimeline::Stage"
+.LsymbolName419: .asciz "maxOS::system::BootTimeline::Finish"
+.LsymbolName420: .asciz "maxOS::system::BootTimeline::BeginProbe"
+.LsymbolName421: .asciz "maxOS::system::BootTimeline::EndProbe"
+.LsymbolName422: .asciz "maxOS::system::BootTimeline::Report"
+.LsymbolName423: .asciz "maxOS::system::ElfLoader::ElfLoader"
+.LsymbolName424: .asciz "maxOS::system::ElfLoader::ElfLoader"
+.LsymbolName425: .asciz "maxOS::system::ElfLoader::~ElfLoader"
+.LsymbolName426: .asciz "maxOS::system::ElfLoader::~ElfLoader"
+.LsymbolName427: .asciz "maxOS::system::ElfLoader::IsValid"
+.LsymbolName428: .asciz "maxOS::system::ElfLoader::EntryPoint"
+.LsymbolName429: .asciz "maxOS::system::ElfLoader::Load"
+.LsymbolName430: .asciz "maxOS::Thread::init"
+.LsymbolName431: .asciz "maxOS::Thread::~Thread"
+.LsymbolName432: .asciz "maxOS::Thread::~Thread"
+.LsymbolName433: .asciz "maxOS::ThreadManager::ThreadManager"
+.LsymbolName434: .asciz "maxOS::ThreadManager::ThreadManager"
+.LsymbolName435: .asciz "maxOS::ThreadManager::ThreadManager"
+.LsymbolName436: .asciz "maxOS::ThreadManager::ThreadManager"
+.LsymbolName437: .asciz "maxOS::ThreadManager::~ThreadManager"
+.LsymbolName438: .asciz "maxOS::ThreadManager::~ThreadManager"
+.LsymbolName439: .asciz "maxOS::ThreadManager::CreateThread"
+.LsymbolName440: .asciz "maxOS::ThreadManager::CreateUserThread"
+.LsymbolName441: .asciz "maxOS::ThreadManager::CurrentPID"
+.LsymbolName442: .asciz "maxOS::ThreadManager::Schedule"
+.LsymbolName443: .asciz "maxOS::ThreadManager::AccountInterrupt"
+.LsymbolName444: .asciz "maxOS::ThreadManager::GetStatistics"
+.LsymbolName445: .asciz "maxOS::ThreadManager::TerminateThread"
+.LsymbolName446: .asciz "maxOS::ThreadManager::JoinThreads"
+.LsymbolName447: .asciz "maxOS::ThreadManager::YieldThreads"
+.LsymbolName448: .asciz "maxOS::ThreadManager::CheckThreads"
+.LsymbolName449: .asciz "maxOS::system::Process::Process"
+.LsymbolName450: .asciz "maxOS::system::Process::Process"
+.LsymbolName451: .asciz "maxOS::system::Process::Process"
+.LsymbolName452: .asciz "maxOS::system::Process::Process"
+.LsymbolName453: .asciz "maxOS::system::Process::~Process"
+.LsymbolName454: .asciz "maxOS::system::Process::~Process"
+.LsymbolName455: .asciz "maxOS::system::Process::threadMain"
+.LsymbolName456: .asciz "maxOS::system::Process::CreateChildThread"
+.LsymbolName457: .asciz "maxOS::system::Process::KillChildThread"
+.LsymbolName458: .asciz "maxOS::system::Process::KillAllChildThreads"
+.LsymbolName459: .asciz "maxOS::system::Process::RefreshProcess"
+.LsymbolName460: .asciz "maxOS::system::Process::Kill"
+.LsymbolName461: .asciz "maxOS::system::Process::GetPID"
+.LsymbolName462: .asciz "maxOS::system::Process::AddressSpace"
+.LsymbolName463: .asciz "maxOS::system::Process::AddRegion"
+.LsymbolName464: .asciz "maxOS::system::Process::IsUserMemory"
+.LsymbolName465: .asciz "maxOS::system::Process::FaultIn"
+.LsymbolName466: .asciz "AllocateProcessFrame"
+.LsymbolName467: .asciz "IsShareable"
+.LsymbolName468: .asciz "maxOS::system::Process::HandlePageFault"
+.LsymbolName469: .asciz "maxOS::system::ProcessManager::ProcessManager"
+.LsymbolName470: .asciz "maxOS::system::ProcessManager::ProcessManager"
+.LsymbolName471: .asciz "maxOS::system::ProcessManager::~ProcessManager"
+.LsymbolName472: .asciz "maxOS::system::ProcessManager::~ProcessManager"
+.LsymbolName473: .asciz "maxOS::system::ProcessManager::AddProcess"
+.LsymbolName474: .asciz "maxOS::system::ProcessManager::RemoveProcess"
+.LsymbolName475: .asciz "maxOS::system::ProcessManager::GetProcess"
+.LsymbolName476: .asciz "maxOS::system::ProcessManager::CurrentProcess"
+.LsymbolName477: .asciz "maxOS::system::ProcessManager::Spawn"
+.LsymbolName478: .asciz "maxOS::system::ProcessManager::Exit"
+.LsymbolName479: .asciz "maxOS::system::ProcessManager::HandleInterrupt"
+.LsymbolName480: .asciz "maxOS::hardwarecommunication::BaseAdressRegister::BaseAdressRegister"
+.LsymbolName481: .asciz "maxOS::hardwarecommunication::BaseAdressRegister::BaseAdressRegister"
+.LsymbolName482: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectDeviceDescriptor::PeripheralComponentInterconnectDeviceDescriptor"
+.LsymbolName483: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectDeviceDescriptor::PeripheralComponentInterconnectDeviceDescriptor"
+.LsymbolName484: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectDeviceDescriptor::~PeripheralComponentInterconnectDeviceDescriptor"
+.LsymbolName485: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectDeviceDescriptor::~PeripheralComponentInterconnectDeviceDescriptor"
+.LsymbolName486: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::PeripheralComponentInterconnectController"
+.LsymbolName487: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::PeripheralComponentInterconnectController"
+.LsymbolName488: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::~PeripheralComponentInterconnectController"
+.LsymbolName489: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::~PeripheralComponentInterconnectController"
+.LsymbolName490: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::ECAMAddress"
+.LsymbolName491: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::Read"
+.LsymbolName492: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::Write"
+.LsymbolName493: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::HasExtendedConfigSpace"
+.LsymbolName494: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::DeviceHasFunctions"
+.LsymbolName495: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::Enumerate"
+.LsymbolName496: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::EnumerateBus"
+.LsymbolName497: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::EnumerateFunction"
+.LsymbolName498: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::NumDevices"
+.LsymbolName499: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::GetDevice"
+.LsymbolName500: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::FindDevice"
+.LsymbolName501: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::FindClass"
+.LsymbolName502: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::SelectDrivers"
+.LsymbolName503: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::FindCapability"
+.LsymbolName504: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::FindExtendedCapability"
+.LsymbolName505: .asciz "MessageAddress"
+.LsymbolName506: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::EnableMSI"
+.LsymbolName507: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::EnableMSIX"
+.LsymbolName508: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::AllocateMSIXVector"
+.LsymbolName509: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::GetDeviceDescriptor"
+.LsymbolName510: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::Matches"
+.LsymbolName511: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::GetDriver"
+.LsymbolName512: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::GetBaseAdressRegister"
+.LsymbolName513: .asciz "maxOS::hardwarecommunication::PeripheralComponentInterconnectController::MapBaseAdressRegister"
+.LsymbolName514: .asciz "maxOS::system::Task::Task"
+.LsymbolName515: .asciz "maxOS::system::Task::Task"
+.LsymbolName516: .asciz "maxOS::system::Task::~Task"
+.LsymbolName517: .asciz "maxOS::system::Task::~Task"
+.LsymbolName518: .asciz "maxOS::system::TaskManager::TaskManager"
+.LsymbolName519: .asciz "maxOS::system::TaskManager::TaskManager"
+.LsymbolName520: .asciz "maxOS::system::TaskManager::~TaskManager"
+.LsymbolName521: .asciz "maxOS::system::TaskManager::~TaskManager"
+.LsymbolName522: .asciz "maxOS::system::TaskManager::AddTask"
+.LsymbolName523: .asciz "maxOS::system::TaskManager::Schedule"
+.LsymbolName524: .asciz "maxOS::drivers::KeyboardEventHandler::KeyboardEventHandler"
+.LsymbolName525: .asciz "maxOS::drivers::KeyboardEventHandler::KeyboardEventHandler"
+.LsymbolName526: .asciz "maxOS::drivers::KeyboardEventHandler::OnKeyDown"
+.LsymbolName527: .asciz "maxOS::drivers::KeyboardEventHandler::OnKeyUp"
+.LsymbolName528: .asciz "maxOS::drivers::KeyboardDriver::KeyboardDriver"
+.LsymbolName529: .asciz "maxOS::drivers::KeyboardDriver::KeyboardDriver"
+.LsymbolName530: .asciz "maxOS::drivers::KeyboardDriver::~KeyboardDriver"
+.LsymbolName531: .asciz "maxOS::drivers::KeyboardDriver::~KeyboardDriver"
+.LsymbolName532: .asciz "maxOS::drivers::KeyboardDriver::Activate"
+.LsymbolName533: .asciz "non-virtual thunk to maxOS::drivers::KeyboardDriver::Activate"
+.LsymbolName534: .asciz "maxOS::drivers::KeyboardDriver::HandleInterrupt"
+.LsymbolName535: .asciz ".L51"
+.LsymbolName536: .asciz ".L50"
+.LsymbolName537: .asciz ".L49"
+.LsymbolName538: .asciz ".L48"
+.LsymbolName539: .asciz ".L47"
+.LsymbolName540: .asciz ".L46"
+.LsymbolName541: .asciz ".L45"
+.LsymbolName542: .asciz ".L44"
+.LsymbolName543: .asciz ".L43"
+.LsymbolName544: .asciz ".L42"
+.LsymbolName545: .asciz ".L27"
+.LsymbolName546: .asciz ".L26"
+.LsymbolName547: .asciz ".L68"
+.LsymbolName548: .asciz ".L107"
+.LsymbolName549: .asciz ".L106"
+.LsymbolName550: .asciz ".L105"
+.LsymbolName551: .asciz ".L104"
+.LsymbolName552: .asciz ".L103"
+.LsymbolName553: .asciz ".L102"
+.LsymbolName554: .asciz ".L101"
+.LsymbolName555: .asciz ".L100"
+.LsymbolName556: .asciz ".L99"
+.LsymbolName557: .asciz ".L98"
+.LsymbolName558: .asciz ".L97"
+.LsymbolName559: .asciz ".L96"
+.LsymbolName560: .asciz ".L93"
+.LsymbolName561: .asciz ".L92"
+.LsymbolName562: .asciz ".L91"
+.LsymbolName563: .asciz ".L90"
+.LsymbolName564: .asciz ".L89"
+.LsymbolName565: .asciz ".L88"
+.LsymbolName566: .asciz ".L87"
+.LsymbolName567: .asciz ".L86"
+.LsymbolName568: .asciz ".L85"
+.LsymbolName569: .asciz ".L84"
+.LsymbolName570: .asciz ".L83"
+.LsymbolName571: .asciz ".L82"
+.LsymbolName572: .asciz ".L79"
+.LsymbolName573: .asciz ".L78"
+.LsymbolName574: .asciz ".L77"
+.LsymbolName575: .asciz ".L76"
+.LsymbolName576: .asciz ".L75"
+.LsymbolName577: .asciz ".L74"
+.LsymbolName578: .asciz ".L73"
+.LsymbolName579: .asciz ".L72"
+.LsymbolName580: .asciz ".L71"
+.LsymbolName581: .asciz ".L70"
+.LsymbolName582: .asciz ".L69"
+.LsymbolName583: .asciz ".L67"
+.LsymbolName584: .asciz ".L66"
+.LsymbolName585: .asciz ".L65"
+.LsymbolName586: .asciz ".L64"
+.LsymbolName587: .asciz ".L63"
+.LsymbolName588: .asciz ".L62"
+.LsymbolName589: .asciz ".L61"
+.LsymbolName590: .asciz ".L60"
+.LsymbolName591: .asciz ".L59"
+.LsymbolName592: .asciz ".L58"
+.LsymbolName593: .asciz ".L57"
+.LsymbolName594: .asciz ".L36"
+.LsymbolName595: .asciz ".L33"
+.LsymbolName596: .asciz ".L81"
+.LsymbolName597: .asciz ".L53"
+.LsymbolName598: .asciz ".L94"
+.LsymbolName599: .asciz ".L80"
+.LsymbolName600: .asciz ".L25"
+.LsymbolName601: .asciz ".L52"
+.LsymbolName602: .asciz ".L54"
+.LsymbolName603: .asciz ".L108"
+.LsymbolName604: .asciz ".L55"
+.LsymbolName605: .asciz ".L40"
+.LsymbolName606: .asciz ".L29"
+.LsymbolName607: .asciz ".L39"
+.LsymbolName608: .asciz ".L28"
+.LsymbolName609: .asciz ".L32"
+.LsymbolName610: .asciz ".L30"
+.LsymbolName611: .asciz ".L37"
+.LsymbolName612: .asciz ".L38"
+.LsymbolName613: .asciz ".L31"
+.LsymbolName614: .asciz ".L35"
+.LsymbolName615: .asciz ".L34"
+.LsymbolName616: .asciz ".L95"
+.LsymbolName617: .asciz ".L56"
+.LsymbolName618: .asciz ".L24"
+.LsymbolName619: .asciz ".L20"
+.LsymbolName620: .asciz ".L205"
+.LsymbolName621: .asciz "maxOS::drivers::MouseEventHandler::MouseEventHandler"
+.LsymbolName622: .asciz "maxOS::drivers::MouseEventHandler::MouseEventHandler"
+.LsymbolName623: .asciz "maxOS::drivers::MouseEventHandler::OnActivate"
+.LsymbolName624: .asciz "maxOS::drivers::MouseEventHandler::OnMouseDown"
+.LsymbolName625: .asciz "maxOS::drivers::MouseEventHandler::OnMouseUp"
+.LsymbolName626: .asciz "maxOS::drivers::MouseEventHandler::OnMouseMove"
+.LsymbolName627: .asciz "maxOS::drivers::MouseDriver::MouseDriver"
+.LsymbolName628: .asciz "maxOS::drivers::MouseDriver::MouseDriver"
+.LsymbolName629: .asciz "maxOS::drivers::MouseDriver::~MouseDriver"
+.LsymbolName630: .asciz "maxOS::drivers::MouseDriver::~MouseDriver"
+.LsymbolName631: .asciz "maxOS::drivers::MouseDriver::Activate"
+.LsymbolName632: .asciz "non-virtual thunk to maxOS::drivers::MouseDriver::Activate"
+.LsymbolName633: .asciz "maxOS::drivers::MouseDriver::HandleInterrupt"
+.LsymbolName634: .asciz "maxOS::drivers::VideoGraphicsArray::VideoGraphicsArray"
+.LsymbolName635: .asciz "maxOS::drivers::VideoGraphicsArray::VideoGraphicsArray"
+.LsymbolName636: .asciz "maxOS::drivers::VideoGraphicsArray::~VideoGraphicsArray"
+.LsymbolName637: .asciz "maxOS::drivers::VideoGraphicsArray::~VideoGraphicsArray"
+.LsymbolName638: .asciz "maxOS::drivers::VideoGraphicsArray::WriteRegisters"
+.LsymbolName639: .asciz "maxOS::drivers::VideoGraphicsArray::SupportsMode"
+.LsymbolName640: .asciz "maxOS::drivers::VideoGraphicsArray::SetMode"
+.LsymbolName641: .asciz "maxOS::drivers::VideoGraphicsArray::GetFrameBufferSegment"
+.LsymbolName642: .asciz "maxOS::drivers::VideoGraphicsArray::PutPixel"
+.LsymbolName643: .asciz "maxOS::drivers::VideoGraphicsArray::GetColourIndex"
+.LsymbolName644: .asciz "maxOS::drivers::VideoGraphicsArray::PutPixel"
+.LsymbolName645: .asciz "maxOS::drivers::VideoGraphicsArray::FillRectangle"
+.LsymbolName646: .asciz "maxOS::drivers::IOScheduler::IOScheduler"
+.LsymbolName647: .asciz "maxOS::drivers::IOScheduler::IOScheduler"
+.LsymbolName648: .asciz "maxOS::drivers::IOScheduler::~IOScheduler"
+.LsymbolName649: .asciz "maxOS::drivers::IOScheduler::~IOScheduler"
+.LsymbolName650: .asciz "maxOS::drivers::IOScheduler::InsertSorted"
+.LsymbolName651: .asciz "maxOS::drivers::IOScheduler::Unlink"
+.LsymbolName652: .asciz "maxOS::drivers::IOScheduler::FindAdjacent"
+.LsymbolName653: .asciz "maxOS::drivers::IOScheduler::Name"
+.LsymbolName654: .asciz "maxOS::drivers::IOScheduler::Add"
+.LsymbolName655: .asciz "maxOS::drivers::IOScheduler::Remove"
+.LsymbolName656: .asciz "maxOS::drivers::IOScheduler::Next"
+.LsymbolName657: .asciz "maxOS::drivers::IOScheduler::FindMerge"
+.LsymbolName658: .asciz "maxOS::drivers::IOScheduler::Merged"
+.LsymbolName659: .asciz "maxOS::drivers::NoopIOScheduler::NoopIOScheduler"
+.LsymbolName660: .asciz "maxOS::drivers::NoopIOScheduler::NoopIOScheduler"
+.LsymbolName661: .asciz "maxOS::drivers::NoopIOScheduler::~NoopIOScheduler"
+.LsymbolName662: .asciz "maxOS::drivers::NoopIOScheduler::~NoopIOScheduler"
+.LsymbolName663: .asciz "maxOS::drivers::NoopIOScheduler::Name"
+.LsymbolName664: .asciz "maxOS::drivers::NoopIOScheduler::Add"
+.LsymbolName665: .asciz "maxOS::drivers::NoopIOScheduler::Remove"
+.LsymbolName666: .asciz "maxOS::drivers::NoopIOScheduler::Next"
+.LsymbolName667: .asciz "maxOS::drivers::NoopIOScheduler::FindMerge"
+.LsymbolName668: .asciz "maxOS::drivers::CLOOKIOScheduler::CLOOKIOScheduler"
+.LsymbolName669: .asciz "maxOS::drivers::CLOOKIOScheduler::CLOOKIOScheduler"
+.LsymbolName670: .asciz "maxOS::drivers::CLOOKIOScheduler::~CLOOKIOScheduler"
+.LsymbolName671: .asciz "maxOS::drivers::CLOOKIOScheduler::~CLOOKIOScheduler"
+.LsymbolName672: .asciz "maxOS::drivers::CLOOKIOScheduler::Name"
+.LsymbolName673: .asciz "maxOS::drivers::CLOOKIOScheduler::Add"
+.LsymbolName674: .asciz "maxOS::drivers::CLOOKIOScheduler::Remove"
+.LsymbolName675: .asciz "maxOS::drivers::CLOOKIOScheduler::Next"
+.LsymbolName676: .asciz "maxOS::drivers::CLOOKIOScheduler::FindMerge"
+.LsymbolName677: .asciz "maxOS::drivers::CLOOKIOScheduler::Merged"
+.LsymbolName678: .asciz "maxOS::drivers::DeadlineIOScheduler::DeadlineIOScheduler"
+.LsymbolName679: .asciz "maxOS::drivers::DeadlineIOScheduler::DeadlineIOScheduler"
+.LsymbolName680: .asciz "maxOS::drivers::DeadlineIOScheduler::~DeadlineIOScheduler"
+.LsymbolName681: .asciz "maxOS::drivers::DeadlineIOScheduler::~DeadlineIOScheduler"
+.LsymbolName682: .asciz "maxOS::drivers::DeadlineIOScheduler::Name"
+.LsymbolName683: .asciz "maxOS::drivers::DeadlineIOScheduler::Direction"
+.LsymbolName684: .asciz "maxOS::drivers::DeadlineIOScheduler::Expired"
+.LsymbolName685: .asciz "maxOS::drivers::DeadlineIOScheduler::InsertFIFO"
+.LsymbolName686: .asciz "maxOS::drivers::DeadlineIOScheduler::UnlinkFIFO"
+.LsymbolName687: .asciz "maxOS::drivers::DeadlineIOScheduler::Add"
+.LsymbolName688: .asciz "maxOS::drivers::DeadlineIOScheduler::Remove"
+.LsymbolName689: .asciz "maxOS::drivers::DeadlineIOScheduler::Next"
+.LsymbolName690: .asciz "maxOS::drivers::DeadlineIOScheduler::FindMerge"
+.LsymbolName691: .asciz "maxOS::drivers::DeadlineIOScheduler::Merged"
+.LsymbolName692: .asciz "maxOS::drivers::BlockDevice::BlockDevice"
+.LsymbolName693: .asciz "maxOS::drivers::BlockDevice::BlockDevice"
+.LsymbolName694: .asciz "maxOS::drivers::BlockDevice::~BlockDevice"
+.LsymbolName695: .asciz "maxOS::drivers::BlockDevice::~BlockDevice"
+.LsymbolName696: .asciz "maxOS::drivers::BlockDevice::AllocateRequest"
+.LsymbolName697: .asciz "maxOS::drivers::BlockDevice::FreeRequest"
+.LsymbolName698: .asciz "maxOS::drivers::BlockDevice::Queue"
+.LsymbolName699: .asciz "maxOS::drivers::BlockDevice::Merge"
+.LsymbolName700: .asciz "maxOS::drivers::BlockDevice::Coalesce"
+.LsymbolName701: .asciz "maxOS::drivers::BlockDevice::ReleaseHeld"
+.LsymbolName702: .asciz "maxOS::drivers::BlockDevice::Run"
+.LsymbolName703: .asciz "maxOS::drivers::BlockDevice::Complete"
+.LsymbolName704: .asciz "maxOS::drivers::BlockDevice::StartRequest"
+.LsymbolName705: .asciz "maxOS::drivers::BlockDevice::CommitRequests"
+.LsymbolName706: .asciz "maxOS::drivers::BlockDevice::Poll"
+.LsymbolName707: .asciz "maxOS::drivers::BlockDevice::SubmitIO"
+.LsymbolName708: .asciz "maxOS::drivers::BlockDevice::Wait"
+.LsymbolName709: .asciz "maxOS::drivers::BlockDevice::ReadSectors"
+.LsymbolName710: .asciz "maxOS::drivers::BlockDevice::WriteSectors"
+.LsymbolName711: .asciz "maxOS::drivers::BlockDevice::FlushCache"
+.LsymbolName712: .asciz "maxOS::drivers::BlockDevice::Plug"
+.LsymbolName713: .asciz "maxOS::drivers::BlockDevice::Unplug"
+.LsymbolName714: .asciz "maxOS::drivers::BlockDevice::SetScheduler"
+.LsymbolName715: .asciz "maxOS::drivers::BlockDevice::Scheduler"
+.LsymbolName716: .asciz "maxOS::drivers::BlockDevice::Limits"
+.LsymbolName717: .asciz "maxOS::drivers::BlockDevice::Capacity"
+.LsymbolName718: .asciz "maxOS::drivers::BlockDevice::Statistics"
+.LsymbolName719: .asciz "CopyIdentityString"
+.LsymbolName720: .asciz "AllocateZeroedFrame"
+.LsymbolName721: .asciz "AddRegions"
+.LsymbolName722: .asciz "maxOS::drivers::AdvancedHostControllerInterfacePort::AdvancedHostControllerInterfacePort"
+.LsymbolName723: .asciz "maxOS::drivers::AdvancedHostControllerInterfacePort::AdvancedHostControllerInterfacePort"
+.LsymbolName724: .asciz "maxOS::drivers::AdvancedHostControllerInterfacePort::~AdvancedHostControllerInterfacePort"
+.LsymbolName725: .asciz "maxOS::drivers::AdvancedHostControllerInterfacePort::~AdvancedHostControllerInterfacePort"
+.LsymbolName726: .asciz "maxOS::drivers::AdvancedHostControllerInterfacePort::Read"
+.LsymbolName727: .asciz "maxOS::drivers::AdvancedHostControllerInterfacePort::Write"
+.LsymbolName728: .asciz "maxOS::drivers::AdvancedHostControllerInterfacePort::StartEngine"
+.LsymbolName729: .asciz "maxOS::drivers::AdvancedHostControllerInterfacePort::StopEngine"
+.LsymbolName730: .asciz "maxOS::drivers::AdvancedHostControllerInterfacePort::Initialize"
+.LsymbolName731: .asciz "maxOS::drivers::AdvancedHostControllerInterfacePort::BuildCommand"
+.LsymbolName732: .asciz "maxOS::drivers::AdvancedHostControllerInterfacePort::Issue"
+.LsymbolName733: .asciz "maxOS::drivers::AdvancedHostControllerInterfacePort::BuildRegions"
+.LsymbolName734: .asciz "maxOS::drivers::AdvancedHostControllerInterfacePort::IssueNext"
+.LsymbolName735: .asciz "maxOS::drivers::AdvancedHostControllerInterfacePort::Advance"
+.LsymbolName736: .asciz "maxOS::drivers::AdvancedHostControllerInterfacePort::Finish"
+.LsymbolName737: .asciz "maxOS::drivers::AdvancedHostControllerInterfacePort::Recover"
+.LsymbolName738: .asciz "maxOS::drivers::AdvancedHostControllerInterfacePort::Service"
+.LsymbolName739: .asciz "maxOS::drivers::AdvancedHostControllerInterfacePort::StartRequest"
+.LsymbolName740: .asciz "maxOS::drivers::AdvancedHostControllerInterfacePort::Poll"
+.LsymbolName741: .asciz "maxOS::drivers::AdvancedHostControllerInterfacePort::Identify"
+.LsymbolName742: .asciz "maxOS::drivers::AdvancedHostControllerInterfacePort::IsPresent"
+.LsymbolName743: .asciz "maxOS::drivers::AdvancedHostControllerInterfacePort::Identity"
+.LsymbolName744: .asciz "CreateAdvancedHostControllerInterface"
+.LsymbolName745: .asciz "maxOS::drivers::AdvancedHostControllerInterface::AdvancedHostControllerInterface"
+.LsymbolName746: .asciz "maxOS::drivers::AdvancedHostControllerInterface::AdvancedHostControllerInterface"
+.LsymbolName747: .asciz "maxOS::drivers::AdvancedHostControllerInterface::~AdvancedHostControllerInterface"
+.LsymbolName748: .asciz "maxOS::drivers::AdvancedHostControllerInterface::~AdvancedHostControllerInterface"
+.LsymbolName749: .asciz "maxOS::drivers::AdvancedHostControllerInterface::TakeOwnership"
+.LsymbolName750: .asciz "maxOS::drivers::AdvancedHostControllerInterface::Activate"
+.LsymbolName751: .asciz "maxOS::drivers::AdvancedHostControllerInterface::NumPorts"
+.LsymbolName752: .asciz "maxOS::drivers::AdvancedHostControllerInterface::GetPort"
+.LsymbolName753: .asciz "maxOS::drivers::AdvancedHostControllerInterface::HandleInterrupt"
+.LsymbolName754: .asciz "non-virtual thunk to maxOS::drivers::AdvancedHostControllerInterface::HandleInterrupt"
+.LsymbolName755: .asciz "MemoryBarrier"
+.LsymbolName756: .asciz "Read8"
+.LsymbolName757: .asciz "Read16"
+.LsymbolName758: .asciz "Read32"
+.LsymbolName759: .asciz "Write8"
+.LsymbolName760: .asciz "Write16"
+.LsymbolName761: .asciz "Write32"
+.LsymbolName762: .asciz "maxOS::drivers::VirtualIOQueue::VirtualIOQueue"
+.LsymbolName763: .asciz "maxOS::drivers::VirtualIOQueue::VirtualIOQueue"
+.LsymbolName764: .asciz "maxOS::drivers::VirtualIOQueue::~VirtualIOQueue"
+.LsymbolName765: .asciz "maxOS::drivers::VirtualIOQueue::~VirtualIOQueue"
+.LsymbolName766: .asciz "maxOS::drivers::VirtualIOQueue::UsedOffset"
+.LsymbolName767: .asciz "maxOS::drivers::VirtualIOQueue::IsValid"
+.LsymbolName768: .asciz "maxOS::drivers::VirtualIOQueue::Index"
+.LsymbolName769: .asciz "maxOS::drivers::VirtualIOQueue::Size"
+.LsymbolName770: .asciz "maxOS::drivers::VirtualIOQueue::NumFree"
+.LsymbolName771: .asciz "maxOS::drivers::VirtualIOQueue::HasIndirect"
+.LsymbolName772: .asciz "maxOS::drivers::VirtualIOQueue::Add"
+.LsymbolName773: .asciz "maxOS::drivers::VirtualIOQueue::Kick"
+.LsymbolName774: .asciz "maxOS::drivers::VirtualIOQueue::FreeChain"
+.LsymbolName775: .asciz "maxOS::drivers::VirtualIOQueue::NextUsed"
+.LsymbolName776: .asciz "maxOS::drivers::VirtualIOQueue::DisableCallbacks"
+.LsymbolName777: .asciz "maxOS::drivers::VirtualIOQueue::EnableCallbacks"
+.LsymbolName778: .asciz "maxOS::drivers::VirtualIOQueue::DescriptorAddress"
+.LsymbolName779: .asciz "maxOS::drivers::VirtualIOQueue::AvailableAddress"
+.LsymbolName780: .asciz "maxOS::drivers::VirtualIOQueue::UsedAddress"
+.LsymbolName781: .asciz "maxOS::drivers::VirtualIODevice::VirtualIODevice"
+.LsymbolName782: .asciz "maxOS::drivers::VirtualIODevice::VirtualIODevice"
+.LsymbolName783: .asciz "maxOS::drivers::VirtualIODevice::~VirtualIODevice"
+.LsymbolName784: .asciz "maxOS::drivers::VirtualIODevice::~VirtualIODevice"
+.LsymbolName785: .asciz "maxOS::drivers::VirtualIODevice::FindCapabilities"
+.LsymbolName786: .asciz "maxOS::drivers::VirtualIODevice::Initialize"
+.LsymbolName787: .asciz "maxOS::drivers::VirtualIODevice::IsModern"
+.LsymbolName788: .asciz "maxOS::drivers::VirtualIODevice::DeviceFeatures"
+.LsymbolName789: .asciz "maxOS::drivers::VirtualIODevice::SetFeatures"
+.LsymbolName790: .asciz "maxOS::drivers::VirtualIODevice::HasFeature"
+.LsymbolName791: .asciz "maxOS::drivers::VirtualIODevice::Status"
+.LsymbolName792: .asciz "maxOS::drivers::VirtualIODevice::SetStatus"
+.LsymbolName793: .asciz "maxOS::drivers::VirtualIODevice::Reset"
+.LsymbolName794: .asciz "maxOS::drivers::VirtualIODevice::Ready"
+.LsymbolName795: .asciz "maxOS::drivers::VirtualIODevice::Fail"
+.LsymbolName796: .asciz "maxOS::drivers::VirtualIODevice::ReadConfig8"
+.LsymbolName797: .asciz "maxOS::drivers::VirtualIODevice::ReadConfig16"
+.LsymbolName798: .asciz "maxOS::drivers::VirtualIODevice::ReadConfig32"
+.LsymbolName799: .asciz "maxOS::drivers::VirtualIODevice::ReadConfig64"
+.LsymbolName800: .asciz "maxOS::drivers::VirtualIODevice::ReadISR"
+.LsymbolName801: .asciz "maxOS::drivers::VirtualIODevice::NumQueues"
+.LsymbolName802: .asciz "maxOS::drivers::VirtualIODevice::SelectQueue"
+.LsymbolName803: .asciz "maxOS::drivers::VirtualIODevice::CreateQueue"
+.LsymbolName804: .asciz "maxOS::drivers::VirtualIODevice::SetConfigVector"
+.LsymbolName805: .asciz "maxOS::drivers::VirtualIODevice::Notify"
+.LsymbolName806: .asciz "AddSegments"
+.LsymbolName807: .asciz "maxOS::drivers::VirtualIOBlockInterruptHandler::VirtualIOBlockInterruptHandler"
+.LsymbolName808: .asciz "maxOS::drivers::VirtualIOBlockInterruptHandler::VirtualIOBlockInterruptHandler"
+.LsymbolName809: .asciz "maxOS::drivers::VirtualIOBlockInterruptHandler::~VirtualIOBlockInterruptHandler"
+.LsymbolName810: .asciz "maxOS::drivers::VirtualIOBlockInterruptHandler::~VirtualIOBlockInterruptHandler"
+.LsymbolName811: .asciz "maxOS::drivers::VirtualIOBlockInterruptHandler::HandleInterrupt"
+.LsymbolName812: .asciz "CreateVirtualIOBlockDevice"
+.LsymbolName813: .asciz "maxOS::drivers::VirtualIOBlockDevice::VirtualIOBlockDevice"
+.LsymbolName814: .asciz "maxOS::drivers::VirtualIOBlockDevice::VirtualIOBlockDevice"
+.LsymbolName815: .asciz "maxOS::drivers::VirtualIOBlockDevice::~VirtualIOBlockDevice"
+.LsymbolName816: .asciz "maxOS::drivers::VirtualIOBlockDevice::~VirtualIOBlockDevice"
+.LsymbolName817: .asciz "maxOS::drivers::VirtualIOBlockDevice::Activate"
+.LsymbolName818: .asciz "maxOS::drivers::VirtualIOBlockDevice::CurrentQueue"
+.LsymbolName819: .asciz "maxOS::drivers::VirtualIOBlockDevice::BuildSegments"
+.LsymbolName820: .asciz "maxOS::drivers::VirtualIOBlockDevice::IssueNext"
+.LsymbolName821: .asciz "maxOS::drivers::VirtualIOBlockDevice::Advance"
+.LsymbolName822: .asciz "maxOS::drivers::VirtualIOBlockDevice::Finish"
+.LsymbolName823: .asciz "maxOS::drivers::VirtualIOBlockDevice::StartRequest"
+.LsymbolName824: .asciz "non-virtual thunk to maxOS::drivers::VirtualIOBlockDevice::StartRequest"
+.LsymbolName825: .asciz "maxOS::drivers::VirtualIOBlockDevice::CommitRequests"
+.LsymbolName826: .asciz "non-virtual thunk to maxOS::drivers::VirtualIOBlockDevice::CommitRequests"
+.LsymbolName827: .asciz "maxOS::drivers::VirtualIOBlockDevice::Service"
+.LsymbolName828: .asciz "maxOS::drivers::VirtualIOBlockDevice::ServiceShared"
+.LsymbolName829: .asciz "maxOS::drivers::VirtualIOBlockDevice::Poll"
+.LsymbolName830: .asciz "non-virtual thunk to maxOS::drivers::VirtualIOBlockDevice::Poll"
+.LsymbolName831: .asciz "maxOS::drivers::VirtualIOBlockDevice::IsPresent"
+.LsymbolName832: .asciz "maxOS::drivers::VirtualIOBlockDevice::NumQueues"
+.LsymbolName833: .asciz "maxOS::drivers::AdvancedTechnologyAttachmentChannel::AdvancedTechnologyAttachmentChannel"
+.LsymbolName834: .asciz "maxOS::drivers::AdvancedTechnologyAttachmentChannel::AdvancedTechnologyAttachmentChannel"
+.LsymbolName835: .asciz "maxOS::drivers::AdvancedTechnologyAttachmentChannel::~AdvancedTechnologyAttachmentChannel"
+.LsymbolName836: .asciz "maxOS::drivers::AdvancedTechnologyAttachmentChannel::~AdvancedTechnologyAttachmentChannel"
+.LsymbolName837: .asciz "maxOS::drivers::AdvancedTechnologyAttachmentChannel::PortBase"
+.LsymbolName838: .asciz "maxOS::drivers::AdvancedTechnologyAttachmentChannel::EnableDMA"
+.LsymbolName839: .asciz "maxOS::drivers::AdvancedTechnologyAttachmentChannel::HasDMA"
+.LsymbolName840: .asciz "maxOS::drivers::AdvancedTechnologyAttachmentChannel::BuildRegions"
+.LsymbolName841: .asciz "maxOS::drivers::AdvancedTechnologyAttachmentChannel::StartDMA"
+.LsymbolName842: .asciz "maxOS::drivers::AdvancedTechnologyAttachmentChannel::CheckCompletion"
+.LsymbolName843: .asciz "maxOS::drivers::AdvancedTechnologyAttachmentChannel::StopDMA"
+.LsymbolName844: .asciz "maxOS::drivers::AdvancedTechnologyAttachmentChannel::Submit"
+.LsymbolName845: .asciz "maxOS::drivers::AdvancedTechnologyAttachmentChannel::StartNext"
+.LsymbolName846: .asciz "maxOS::drivers::AdvancedTechnologyAttachmentChannel::Service"
+.LsymbolName847: .asciz "maxOS::drivers::AdvancedTechnologyAttachmentChannel::Wait"
+.LsymbolName848: .asciz "maxOS::drivers::AdvancedTechnologyAttachmentChannel::Poll"
+.LsymbolName849: .asciz "maxOS::drivers::AdvancedTechnologyAttachmentChannel::HandleInterrupt"
+.LsymbolName850: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::AdvancedTechnologyAttachment"
+.LsymbolName851: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::AdvancedTechnologyAttachment"
+.LsymbolName852: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::~AdvancedTechnologyAttachment"
+.LsymbolName853: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::~AdvancedTechnologyAttachment"
+.LsymbolName854: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::Activate"
+.LsymbolName855: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::Delay"
+.LsymbolName856: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::WaitData"
+.LsymbolName857: .asciz "CopyIdentityString"
+.LsymbolName858: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::Identify"
+.LsymbolName859: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::IsPresent"
+.LsymbolName860: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::Identity"
+.LsymbolName861: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::SelectSector"
+.LsymbolName862: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::MaxSectorsPerCommand"
+.LsymbolName863: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::SectorAddress"
+.LsymbolName864: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::TransferPIO"
+.LsymbolName865: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::CanAccess"
+.LsymbolName866: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::Fail"
+.LsymbolName867: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::Start"
+.LsymbolName868: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::IssueNext"
+.LsymbolName869: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::Service"
+.LsymbolName870: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::Submit"
+.LsymbolName871: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::Execute"
+.LsymbolName872: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::Read"
+.LsymbolName873: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::Write"
+.LsymbolName874: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::Flush"
+.LsymbolName875: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::StartRequest"
+.LsymbolName876: .asciz "non-virtual thunk to maxOS::drivers::AdvancedTechnologyAttachment::StartRequest"
+.LsymbolName877: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::BlockRequestDone"
+.LsymbolName878: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::Poll"
+.LsymbolName879: .asciz "non-virtual thunk to maxOS::drivers::AdvancedTechnologyAttachment::Poll"
+.LsymbolName880: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::Read"
+.LsymbolName881: .asciz "non-virtual thunk to maxOS::drivers::AdvancedTechnologyAttachment::Read"
+.LsymbolName882: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::Write"
+.LsymbolName883: .asciz "non-virtual thunk to maxOS::drivers::AdvancedTechnologyAttachment::Write"
+.LsymbolName884: .asciz "maxOS::drivers::AdvancedTechnologyAttachment::Sync"
+.LsymbolName885: .asciz "non-virtual thunk to maxOS::drivers::AdvancedTechnologyAttachment::Sync"
+.LsymbolName886: .asciz "maxOS::drivers::RawDataHandler::RawDataHandler"
+.LsymbolName887: .asciz "maxOS::drivers::RawDataHandler::RawDataHandler"
+.LsymbolName888: .asciz "maxOS::drivers::RawDataHandler::~RawDataHandler"
+.LsymbolName889: .asciz "maxOS::drivers::RawDataHandler::~RawDataHandler"
+.LsymbolName890: .asciz "maxOS::drivers::RawDataHandler::OnRawDataReceived"
+.LsymbolName891: .asciz "maxOS::drivers::RawDataHandler::Send"
+.LsymbolName892: .asciz "Createamd_am79c973"
+.LsymbolName893: .asciz "maxOS::drivers::amd_am79c973::amd_am79c973"
+.LsymbolName894: .asciz "maxOS::drivers::amd_am79c973::amd_am79c973"
+.LsymbolName895: .asciz "maxOS::drivers::amd_am79c973::~amd_am79c973"
+.LsymbolName896: .asciz "maxOS::drivers::amd_am79c973::~amd_am79c973"
+.LsymbolName897: .asciz "maxOS::drivers::amd_am79c973::Activate"
+.LsymbolName898: .asciz "maxOS::drivers::amd_am79c973::Reset"
+.LsymbolName899: .asciz "maxOS::drivers::amd_am79c973::HandleInterrupt"
+.LsymbolName900: .asciz "non-virtual thunk to maxOS::drivers::amd_am79c973::HandleInterrupt"
+.LsymbolName901: .asciz "maxOS::drivers::amd_am79c973::Send"
+.LsymbolName902: .asciz "maxOS::drivers::amd_am79c973::Send"
+.LsymbolName903: .asciz "non-virtual thunk to maxOS::drivers::amd_am79c973::Send"
+.LsymbolName904: .asciz "maxOS::drivers::amd_am79c973::Receive"
+.LsymbolName905: .asciz "maxOS::drivers::amd_am79c973::SetHandler"
+.LsymbolName906: .asciz "maxOS::drivers::amd_am79c973::SetIPAddress"
+.LsymbolName907: .asciz "maxOS::drivers::amd_am79c973::GetMACAddress"
+.LsymbolName908: .asciz "maxOS::drivers::amd_am79c973::GetIPAddress"
+.LsymbolName909: .asciz "maxOS::gui::Widget::Widget"
+.LsymbolName910: .asciz "maxOS::gui::Widget::Widget"
+.LsymbolName911: .asciz "maxOS::gui::Widget::~Widget"
+.LsymbolName912: .asciz "maxOS::gui::Widget::~Widget"
+.LsymbolName913: .asciz "maxOS::gui::Widget::GetFocus"
+.LsymbolName914: .asciz "maxOS::gui::Widget::ModelToScreen"
+.LsymbolName915: .asciz "maxOS::gui::Widget::Draw"
+.LsymbolName916: .asciz "maxOS::gui::Widget::ContainsCoordinate"
+.LsymbolName917: .asciz "maxOS::gui::Widget::OnMouseDown"
+.LsymbolName918: .asciz "maxOS::gui::Widget::OnMouseUp"
+.LsymbolName919: .asciz "maxOS::gui::Widget::OnMouseMove"
+.LsymbolName920: .asciz "maxOS::gui::CompositeWidget::CompositeWidget"
+.LsymbolName921: .asciz "maxOS::gui::CompositeWidget::CompositeWidget"
+.LsymbolName922: .asciz "maxOS::gui::CompositeWidget::~CompositeWidget"
+.LsymbolName923: .asciz "maxOS::gui::CompositeWidget::~CompositeWidget"
+.LsymbolName924: .asciz "maxOS::gui::CompositeWidget::GetFocus"
+.LsymbolName925: .asciz "maxOS::gui::CompositeWidget::AddChild"
+.LsymbolName926: .asciz "maxOS::gui::CompositeWidget::Draw"
+.LsymbolName927: .asciz "maxOS::gui::CompositeWidget::OnMouseDown"
+.LsymbolName928: .asciz "maxOS::gui::CompositeWidget::OnMouseUp"
+.LsymbolName929: .asciz "maxOS::gui::CompositeWidget::OnMouseMove"
+.LsymbolName930: .asciz "maxOS::gui::CompositeWidget::OnKeyDown"
+.LsymbolName931: .asciz "maxOS::gui::CompositeWidget::OnKeyUp"
+.LsymbolName932: .asciz "maxOS::gui::Window::Window"
+.LsymbolName933: .asciz "maxOS::gui::Window::Window"
+.LsymbolName934: .asciz "maxOS::gui::Window::~Window"
+.LsymbolName935: .asciz "maxOS::gui::Window::~Window"
+.LsymbolName936: .asciz "maxOS::gui::Window::OnMouseDown"
+.LsymbolName937: .asciz "maxOS::gui::Window::OnMouseUp"
+.LsymbolName938: .asciz "maxOS::gui::Window::OnMouseMove"
+.LsymbolName939: .asciz "maxOS::gui::Window::Draw"
+.LsymbolName940: .asciz "maxOS::gui::Desktop::Desktop"
+.LsymbolName941: .asciz "maxOS::gui::Desktop::Desktop"
+.LsymbolName942: .asciz "maxOS::gui::Desktop::~Desktop"
+.LsymbolName943: .asciz "maxOS::gui::Desktop::~Desktop"
+.LsymbolName944: .asciz "maxOS::gui::Desktop::Draw"
+.LsymbolName945: .asciz "maxOS::gui::Desktop::OnMouseUp"
+.LsymbolName946: .asciz "non-virtual thunk to maxOS::gui::Desktop::OnMouseUp"
+.LsymbolName947: .asciz "maxOS::gui::Desktop::OnMouseDown"
+.LsymbolName948: .asciz "non-virtual thunk to maxOS::gui::Desktop::OnMouseDown"
+.LsymbolName949: .asciz "maxOS::gui::Desktop::OnMouseMove"
+.LsymbolName950: .asciz "non-virtual thunk to maxOS::gui::Desktop::OnMouseMove"
+.LsymbolName951: .asciz "__x86.get_pc_thunk.dx"
+.LsymbolName952: .asciz "maxOS::gui::Render::Render"
+.LsymbolName953: .asciz "maxOS::gui::Render::Render"
+.LsymbolName954: .asciz "maxOS::gui::Render::~Render"
+.LsymbolName955: .asciz "maxOS::gui::Render::~Render"
+.LsymbolName956: .asciz "maxOS::gui::Render::display"
+.LsymbolName957: .asciz "maxOS::gui::Render::PutPixel"
+.LsymbolName958: .asciz "maxOS::gui::Text::Text"
+.LsymbolName959: .asciz "maxOS::gui::Text::Text"
+.LsymbolName960: .asciz "maxOS::gui::Text::~Text"
+.LsymbolName961: .asciz "maxOS::gui::Text::~Text"
+.LsymbolName962: .asciz "maxOS::gui::Text::Draw"
+.LsymbolName963: .asciz "maxOS::gui::Text::UpdateText"
+.LsymbolName964: .asciz "maxOS::common::Console::Console"
+.LsymbolName965: .asciz "maxOS::common::Console::Console"
+.LsymbolName966: .asciz "maxOS::common::Console::~Console"
+.LsymbolName967: .asciz "maxOS::common::Console::~Console"
+.LsymbolName968: .asciz "maxOS::common::Console::put_string_gui"
+.LsymbolName969: .asciz "maxOS::common::Console::put_string"
+.LsymbolName970: .asciz "maxOS::common::Console::put_hex"
+.LsymbolName971: .asciz "maxOS::common::Console::moveCursor"
+.LsymbolName972: .asciz "maxOS::common::Console::backspace"
+.LsymbolName973: .asciz "maxOS::net::EtherFrameHandler::EtherFrameHandler"
+.LsymbolName974: .asciz "maxOS::net::EtherFrameHandler::EtherFrameHandler"
+.LsymbolName975: .asciz "maxOS::net::EtherFrameHandler::~EtherFrameHandler"
+.LsymbolName976: .asciz "maxOS::net::EtherFrameHandler::~EtherFrameHandler"
+.LsymbolName977: .asciz "maxOS::net::EtherFrameHandler::OnEtherFrameReceived"
+.LsymbolName978: .asciz "maxOS::net::EtherFrameHandler::Send"
+.LsymbolName979: .asciz "maxOS::net::EtherFrameProvider::EtherFrameProvider"
+.LsymbolName980: .asciz "maxOS::net::EtherFrameProvider::EtherFrameProvider"
+.LsymbolName981: .asciz "maxOS::net::EtherFrameProvider::~EtherFrameProvider"
+.LsymbolName982: .asciz "maxOS::net::EtherFrameProvider::~EtherFrameProvider"
+.LsymbolName983: .asciz "maxOS::net::EtherFrameProvider::OnRawDataReceived"
+.LsymbolName984: .asciz "maxOS::net::EtherFrameProvider::Send"
+.LsymbolName985: .asciz "maxOS::net::EtherFrameProvider::GetIPAddress"
+.LsymbolName986: .asciz "maxOS::net::EtherFrameProvider::GetMACAddress"
+.LsymbolName987: .asciz "maxOS::net::AddressResolutionProtocol::AddressResolutionProtocol"
+.LsymbolName988: .asciz "maxOS::net::AddressResolutionProtocol::AddressResolutionProtocol"
+.LsymbolName989: .asciz "maxOS::net::AddressResolutionProtocol::~AddressResolutionProtocol"
+.LsymbolName990: .asciz "maxOS::net::AddressResolutionProtocol::~AddressResolutionProtocol"
+.LsymbolName991: .asciz "maxOS::net::AddressResolutionProtocol::OnEtherFrameReceived"
+.LsymbolName992: .asciz "maxOS::net::AddressResolutionProtocol::RequestMACAddress"
+.LsymbolName993: .asciz "maxOS::net::AddressResolutionProtocol::GetMACFromCache"
+.LsymbolName994: .asciz "maxOS::net::AddressResolutionProtocol::Resolve"
+.LsymbolName995: .asciz "__x86.get_pc_thunk.di"
+.LsymbolName996: .asciz "strcmp"
+.LsymbolName997: .asciz "printf_gui"
+.LsymbolName998: .asciz "printf"
+.LsymbolName999: .asciz "printfHex"
+.LsymbolName1000: .asciz "printfInt"
+.LsymbolName1001: .asciz "sys_printf"
+.LsymbolName1002: .asciz "sys_getpid"
+.LsymbolName1003: .asciz "sys_kill"
+.LsymbolName1004: .asciz "temp_sys_kill"
+.LsymbolName1005: .asciz "proc_exit"
+.LsymbolName1006: .asciz "taskA"
+.LsymbolName1007: .asciz "taskB"
+.LsymbolName1008: .asciz "callConstructors"
+.LsymbolName1009: .asciz "kernProc"
+.LsymbolName1010: .asciz "kernelMain"
+.LsymbolName1011: .asciz "__static_initialization_and_destruction_0"
+.LsymbolName1012: .asciz "_GLOBAL__sub_I__Z6strcmpPKcS0_"
+.LsymbolName1013: .asciz "_GLOBAL__sub_D__Z6strcmpPKcS0_"
+.LsymbolName1014: .asciz "PrintfKeyboardEventHandler::OnKeyDown"
+.LsymbolName1015: .asciz "MouseToConsole::MouseToConsole"
+.LsymbolName1016: .asciz "MouseToConsole::MouseToConsole"
+.LsymbolName1017: .asciz "MouseToConsole::OnMouseMove"
+.LsymbolName1018: .asciz "PrintfKeyboardEventHandler::PrintfKeyboardEventHandler"
+.LsymbolName1019: .asciz "PrintfKeyboardEventHandler::PrintfKeyboardEventHandler"
+.LsymbolName1020: .asciz "maxOS::hardwarecommunication::InterruptHandler::operator="
+.LsymbolName1021: .asciz "maxOS::hardwarecommunication::serial::operator="
+.LsymbolName1022: .asciz "maxOS::net::EtherFrameHandler::operator="
+.LsymbolName1023: .asciz "maxOS::net::AddressResolutionProtocol::operator="
+.LsymbolName1024: .asciz "GetPage"
+.LsymbolName1025: .asciz "ReadTimestampCounter"
+.LsymbolName1026: .asciz "OSlib::vdso::clock_gettime"
+.LsymbolName1027: .asciz "OSlib::vdso::getpid"
+.LsymbolName1028: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1029: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1030: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1031: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1032: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1033: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1034: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1035: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1036: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1037: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1038: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1039: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1040: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1041: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1042: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1043: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1044: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1045: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1046: .asciz "maxOS::system::TRACE_MAX_CPUS"
+.LsymbolName1047: .asciz "maxOS::system::TRACE_RECORDS_PER_CPU"
+.LsymbolName1048: .asciz "maxOS::system::USER_STACK_TOP"
+.LsymbolName1049: .asciz "maxOS::system::USER_STACK_SIZE"
+.LsymbolName1050: .asciz "maxOS::system::USER_VDSO_ADDRESS"
+.LsymbolName1051: .asciz "maxOS::system::USER_IORING_START"
+.LsymbolName1052: .asciz "maxOS::system::USER_IORING_SIZE"
+.LsymbolName1053: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1054: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1055: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1056: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1057: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1058: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1059: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1060: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1061: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1062: .asciz "maxOS::hardwarecommunication::serial::WriteHex"
+.LsymbolName1063: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1064: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1065: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1066: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1067: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1068: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1069: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1070: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1071: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1072: .asciz "maxOS::hardwarecommunication::AdvancedConfigurationAndPowerInterface::FindRootPointer"
+.LsymbolName1073: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1074: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1075: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1076: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1077: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1078: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1079: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1080: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1081: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1082: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1083: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1084: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1085: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1086: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1087: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1088: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1089: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1090: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1091: .asciz "maxOS::system::USER_STACK_TOP"
+.LsymbolName1092: .asciz "maxOS::system::USER_STACK_SIZE"
+.LsymbolName1093: .asciz "maxOS::system::USER_VDSO_ADDRESS"
+.LsymbolName1094: .asciz "maxOS::system::USER_IORING_START"
+.LsymbolName1095: .asciz "maxOS::system::USER_IORING_SIZE"
+.LsymbolName1096: .asciz "maxOS::system::PROFILER_MAX_DEPTH"
+.LsymbolName1097: .asciz "maxOS::system::PROFILER_MAX_CPUS"
+.LsymbolName1098: .asciz "maxOS::system::PROFILER_SAMPLES_PER_CPU"
+.LsymbolName1099: .asciz "maxOS::system::TRACE_MAX_CPUS"
+.LsymbolName1100: .asciz "maxOS::system::TRACE_RECORDS_PER_CPU"
+.LsymbolName1101: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1102: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1103: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1104: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1105: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1106: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1107: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1108: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1109: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1110: .asciz "maxOS::system::PROFILER_MAX_DEPTH"
+.LsymbolName1111: .asciz "maxOS::system::PROFILER_MAX_CPUS"
+.LsymbolName1112: .asciz "maxOS::system::PROFILER_SAMPLES_PER_CPU"
+.LsymbolName1113: .asciz "maxOS::system::Clock::ReadRealTimeClock"
+.LsymbolName1114: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1115: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1116: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1117: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1118: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1119: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1120: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1121: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1122: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1123: .asciz "maxOS::system::USER_STACK_TOP"
+.LsymbolName1124: .asciz "maxOS::system::USER_STACK_SIZE"
+.LsymbolName1125: .asciz "maxOS::system::USER_VDSO_ADDRESS"
+.LsymbolName1126: .asciz "maxOS::system::USER_IORING_START"
+.LsymbolName1127: .asciz "maxOS::system::USER_IORING_SIZE"
+.LsymbolName1128: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1129: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1130: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1131: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1132: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1133: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1134: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1135: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1136: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1137: .asciz "PAGE_TABLE_PAT"
+.LsymbolName1138: .asciz "PAGE_INHERITED"
+.LsymbolName1139: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1140: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1141: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1142: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1143: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1144: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1145: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1146: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1147: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1148: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1149: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1150: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1151: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1152: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1153: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1154: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1155: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1156: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1157: .asciz "maxOS::system::PROFILER_MAX_DEPTH"
+.LsymbolName1158: .asciz "maxOS::system::PROFILER_MAX_CPUS"
+.LsymbolName1159: .asciz "maxOS::system::PROFILER_SAMPLES_PER_CPU"
+.LsymbolName1160: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1161: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1162: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1163: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1164: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1165: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1166: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1167: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1168: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1169: .asciz "maxOS::system::TRACE_MAX_CPUS"
+.LsymbolName1170: .asciz "maxOS::system::TRACE_RECORDS_PER_CPU"
+.LsymbolName1171: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1172: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1173: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1174: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1175: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1176: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1177: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1178: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1179: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1180: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1181: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1182: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1183: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1184: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1185: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1186: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1187: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1188: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1189: .asciz "maxOS::system::USER_STACK_TOP"
+.LsymbolName1190: .asciz "maxOS::system::USER_STACK_SIZE"
+.LsymbolName1191: .asciz "maxOS::system::USER_VDSO_ADDRESS"
+.LsymbolName1192: .asciz "maxOS::system::USER_IORING_START"
+.LsymbolName1193: .asciz "maxOS::system::USER_IORING_SIZE"
+.LsymbolName1194: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1195: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1196: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1197: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1198: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1199: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1200: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1201: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1202: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1203: .asciz "maxOS::system::TRACE_MAX_CPUS"
+.LsymbolName1204: .asciz "maxOS::system::TRACE_RECORDS_PER_CPU"
+.LsymbolName1205: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1206: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1207: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1208: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1209: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1210: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1211: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1212: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1213: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1214: .asciz "maxOS::system::USER_STACK_TOP"
+.LsymbolName1215: .asciz "maxOS::system::USER_STACK_SIZE"
+.LsymbolName1216: .asciz "maxOS::system::USER_VDSO_ADDRESS"
+.LsymbolName1217: .asciz "maxOS::system::USER_IORING_START"
+.LsymbolName1218: .asciz "maxOS::system::USER_IORING_SIZE"
+.LsymbolName1219: .asciz "maxOS::system::TRACE_MAX_CPUS"
+.LsymbolName1220: .asciz "maxOS::system::TRACE_RECORDS_PER_CPU"
+.LsymbolName1221: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1222: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1223: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1224: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1225: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1226: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1227: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1228: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1229: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1230: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1231: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1232: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1233: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1234: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1235: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1236: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1237: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1238: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1239: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1240: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1241: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1242: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1243: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1244: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1245: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1246: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1247: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1248: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1249: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1250: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1251: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1252: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1253: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1254: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1255: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1256: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1257: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1258: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1259: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1260: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1261: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1262: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1263: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1264: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1265: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1266: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1267: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1268: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1269: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1270: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1271: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1272: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1273: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1274: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1275: .asciz "maxOS::drivers::AHCI_MAX_REGIONS"
+.LsymbolName1276: .asciz "portSize"
+.LsymbolName1277: .asciz "spinLimit"
+.LsymbolName1278: .asciz "ahciIDs"
+.LsymbolName1279: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1280: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1281: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1282: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1283: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1284: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1285: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1286: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1287: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1288: .asciz "maxOS::drivers::VIRTIO_NO_VECTOR"
+.LsymbolName1289: .asciz "PCI_CAPABILITY_VENDOR"
+.LsymbolName1290: .asciz "VIRTIO_AVAILABLE_NO_INTERRUPT"
+.LsymbolName1291: .asciz "VIRTIO_USED_NO_NOTIFY"
+.LsymbolName1292: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1293: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1294: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1295: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1296: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1297: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1298: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1299: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1300: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1301: .asciz "maxOS::drivers::VIRTIO_NO_VECTOR"
+.LsymbolName1302: .asciz "virtioBlockIDs"
+.LsymbolName1303: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1304: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1305: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1306: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1307: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1308: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1309: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1310: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1311: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1312: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1313: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1314: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1315: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1316: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1317: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1318: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1319: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1320: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1321: .asciz "maxOS::system::TRACE_MAX_CPUS"
+.LsymbolName1322: .asciz "maxOS::system::TRACE_RECORDS_PER_CPU"
+.LsymbolName1323: .asciz "amd_am79c973IDs"
+.LsymbolName1324: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1325: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1326: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1327: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1328: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1329: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1330: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1331: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1332: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1333: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1334: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1335: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1336: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1337: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1338: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1339: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1340: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1341: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1342: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1343: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1344: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1345: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1346: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1347: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1348: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1349: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1350: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1351: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1352: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1353: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1354: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1355: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1356: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1357: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1358: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1359: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1360: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1361: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1362: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1363: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1364: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1365: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1366: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1367: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1368: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1369: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1370: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1371: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1372: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1373: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1374: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1375: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1376: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1377: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1378: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1379: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1380: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1381: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1382: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1383: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1384: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1385: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1386: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1387: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1388: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1389: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1390: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1391: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1392: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1393: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1394: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1395: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1396: .asciz "maxOS::system::PAGE_SIZE"
+.LsymbolName1397: .asciz "maxOS::system::KERNEL_IDENTITY_END"
+.LsymbolName1398: .asciz "maxOS::system::USER_SPACE_START"
+.LsymbolName1399: .asciz "maxOS::system::USER_SPACE_END"
+.LsymbolName1400: .asciz "maxOS::system::DEVICE_WINDOW_START"
+.LsymbolName1401: .asciz "maxOS::system::DEVICE_WINDOW_END"
+.LsymbolName1402: .asciz "maxOS::system::KERNEL_STACKS_START"
+.LsymbolName1403: .asciz "maxOS::system::KERNEL_STACK_SLOT"
+.LsymbolName1404: .asciz "maxOS::system::KERNEL_STACK_SIZE"
+.LsymbolName1405: .asciz "maxOS::system::USER_STACK_TOP"
+.LsymbolName1406: .asciz "maxOS::system::USER_STACK_SIZE"
+.LsymbolName1407: .asciz "maxOS::system::USER_VDSO_ADDRESS"
+.LsymbolName1408: .asciz "maxOS::system::USER_IORING_START"
+.LsymbolName1409: .asciz "maxOS::system::USER_IORING_SIZE"
+.LsymbolName1410: .asciz "maxOS::system::PROFILER_MAX_DEPTH"
+.LsymbolName1411: .asciz "maxOS::system::PROFILER_MAX_CPUS"
+.LsymbolName1412: .asciz "maxOS::system::PROFILER_SAMPLES_PER_CPU"
+.LsymbolName1413: .asciz "maxOS::system::TRACE_MAX_CPUS"
+.LsymbolName1414: .asciz "maxOS::system::TRACE_RECORDS_PER_CPU"
+.LsymbolName1415: .asciz "numKernelSymbols"
+.LsymbolName1416: .asciz "kernelSymbols"
@@ -15,13 +15,14 @@ Test::~Test(){
 
 };
 
-void _start(void)
+/**
+ * @details Entry point, only talks to the kernel through int 0x80: asks for its pid and exits with it as the status
+ */
+extern "C" void _start(void)
 {
-    //Print on screen, TEST: Use LIB or kernel wont allow this code
-    int i;
-    for (i = 0; i < 3; i++) {
-        *videomem++ = (0x07 << 8) | ('0' + i);
-    }
+    int pid;
+    asm volatile("int $0x80" : "=a"(pid) : "a"(20) : "memory");          //getpid
+    asm volatile("int $0x80" : : "a"(1), "b"(pid) : "memory");          //exit
 
     while(1);
-}
\ No newline at end of file
+}
@@ -0,0 +1,38 @@
+#!/bin/sh
+# Writes the function symbols of a kernel image as an assembly file holding a table sorted by
+# address (see kernel/include/system/symbols.h). Without an image the table is empty, which is
+# what the first link uses before there is an image to read the symbols from.
+#
+# Usage: symbols.sh [maxOS.bin] > symbols.s
+
+echo ".section .note.GNU-stack,\"\",@progbits"
+echo ".section .rodata"
+echo ".global kernelSymbols"
+echo ".global numKernelSymbols"
+
+if [ -z "$1" ] || [ ! -f "$1" ]; then
+    echo "numKernelSymbols: .long 0"
+    echo "kernelSymbols:"
+    exit 0
+fi
+
+# Only code symbols, demangled and without the argument lists to keep the table (and the profiles) short
+nm -n -C --defined-only "$1" | awk '
+    BEGIN { count = 0 }
+    $2 ~ /^[tTwW]$/ {
+        name = substr($0, index($0, $3))
+        sub(/\(.*$/, "", name)
+        gsub(/\\/, "\\\\", name)
+        gsub(/"/, "\\\"", name)
+        addresses[count] = $1
+        names[count] = name
+        count++
+    }
+    END {
+        print "numKernelSymbols: .long " count
+        print "kernelSymbols:"
+        for(i = 0; i < count; i++)
+            print "    .long 0x" addresses[i] ", .LsymbolName" i
+        for(i = 0; i < count; i++)
+            print ".LsymbolName" i ": .asciz \"" names[i] "\""
+    }'
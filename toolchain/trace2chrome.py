@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+# Turns a capture of the serial port (e.g. qemu -serial file:serial.log) into Chrome trace JSON that can be
+# opened in chrome://tracing or ui.perfetto.dev. The kernel sends the trace as binary frames (see
+# kernel/include/system/trace.h) mixed in with the normal text log, anything that isn't a valid frame is skipped.
+#
+# Usage: trace2chrome.py serial.log > trace.json
+
+import json
+import struct
+import sys
+
+FRAME_DESCRIPTION = 0
+FRAME_CLOCK = 1
+FRAME_RECORDS = 2
+FRAME_DROPPED = 3
+
+PHASES = {0: "i", 1: "B", 2: "E"}
+RECORD = struct.Struct("<QHHII")
+
+
+def frames(data):
+    """Yield (type, cpu, payload) for every frame with a valid checksum"""
+    position = data.find(b"MXTR")
+    while position != -1 and position + 8 <= len(data):
+        frame_type, cpu, length = struct.unpack_from("<BBH", data, position + 4)
+        end = position + 8 + length
+        if end < len(data):
+            payload = data[position + 8:end]
+            if sum(payload) & 0xFF == data[end]:
+                yield frame_type, cpu, payload
+                position = data.find(b"MXTR", end + 1)
+                continue
+        position = data.find(b"MXTR", position + 1)
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit("usage: trace2chrome.py serial.log > trace.json")
+
+    with open(sys.argv[1], "rb") as capture:
+        data = capture.read()
+
+    events = {}
+    ticks_per_us = None
+    first_timestamp = None
+    records = []
+    dropped = {}
+
+    for frame_type, cpu, payload in frames(data):
+        if frame_type == FRAME_DESCRIPTION:
+            names = payload[2:].split(b"\0")
+            events[payload[0]] = (PHASES.get(payload[1], "i"), names[0].decode(errors="replace"),
+                                  [name.decode(errors="replace") for name in names[1:3]])
+        elif frame_type == FRAME_CLOCK:
+            ticks_per_us = struct.unpack("<I", payload)[0] / 1000.0
+        elif frame_type == FRAME_RECORDS:
+            for offset in range(0, len(payload) - RECORD.size + 1, RECORD.size):
+                records.append((cpu,) + RECORD.unpack_from(payload, offset))
+        elif frame_type == FRAME_DROPPED:
+            dropped[cpu] = struct.unpack("<I", payload)[0]
+
+    if not ticks_per_us:
+        sys.exit("no clock frame found, the TSC frequency is unknown")
+
+    trace = []
+    for cpu, timestamp, event, pid, argument0, argument1 in sorted(records, key=lambda record: record[1]):
+        if first_timestamp is None:
+            first_timestamp = timestamp
+
+        phase, name, argument_names = events.get(event, ("i", "event %d" % event, ["arg0", "arg1"]))
+        entry = {
+            "name": name,
+            "cat": "maxOS",
+            "ph": phase,
+            "ts": (timestamp - first_timestamp) / ticks_per_us,
+            "pid": 0,
+            "tid": cpu,
+            "args": {"pid": pid},
+        }
+        for argument_name, value in zip(argument_names, (argument0, argument1)):
+            if argument_name:
+                entry["args"][argument_name] = value
+        if phase == "i":
+            entry["s"] = "t"
+        trace.append(entry)
+
+    metadata = [{"name": "thread_name", "ph": "M", "pid": 0, "tid": cpu, "args": {"name": "CPU %d" % cpu}}
+                for cpu in sorted(set(record[0] for record in records))]
+
+    for cpu, count in dropped.items():
+        sys.stderr.write("CPU %d dropped %d records\n" % (cpu, count))
+
+    json.dump({"traceEvents": metadata + trace, "displayTimeUnit": "ns"}, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()